@@ -194,6 +194,12 @@ public:
      */
     void clear();
 
+    /**
+     * @brief Check if both configs contain the same properties.
+     */
+    bool operator==(const Config &other) const;
+    bool operator!=(const Config &other) const;
+
 private:
     struct Private;
     Private *dptr;
@@ -0,0 +1,133 @@
+#ifndef LMS_CONFIG_BINDING_H
+#define LMS_CONFIG_BINDING_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+#include "config.h"
+
+namespace lms {
+
+/**
+ * @brief Typed config values that are parsed once instead of on every
+ * Config::get or Config::getArray call.
+ *
+ * get() and getArray() return references to the parsed values. The
+ * references stay valid for the lifetime of the binding and see the new
+ * values after update() was called with a changed config.
+ *
+ * **Example code**
+ *
+ * ~~~~~{.cpp}
+ * // in init()
+ * m_width = &configBinding().get<int>("width", 300);
+ * m_ids = &configBinding().getArray<int>("ids");
+ *
+ * // in cycle(), no parsing
+ * for (int id : *m_ids) { ... }
+ * ~~~~~
+ *
+ * Values are bound once per key and type. Calling get() or getArray() again
+ * with the same key and type returns the existing reference and does not
+ * allocate, the default value of the first call is kept.
+ *
+ * This class is not thread-safe.
+ */
+class ConfigBinding {
+public:
+    ConfigBinding() {}
+
+    /**
+     * @brief Bind to the given config.
+     */
+    explicit ConfigBinding(const Config &config) : m_config(config) {}
+
+    ConfigBinding(const ConfigBinding &) = delete;
+    ConfigBinding &operator=(const ConfigBinding &) = delete;
+
+    /**
+     * @brief Parse all bound values again from a changed config.
+     */
+    void update(const Config &config);
+
+    /**
+     * @brief Parse a value once, see Config::get.
+     * @return reference to the parsed value that is updated by update()
+     */
+    template <typename T>
+    const T &get(const std::string &key, const T &defaultValue = T()) {
+        return bind<Scalar<T>>(key, defaultValue);
+    }
+
+    /**
+     * @brief Parse a comma separated list once, see Config::getArray.
+     * @return reference to the parsed values that is updated by update()
+     */
+    template <typename T>
+    const std::vector<T> &
+    getArray(const std::string &key,
+             const std::vector<T> &defaultValue = std::vector<T>()) {
+        return bind<Array<T>>(key, defaultValue);
+    }
+
+    /**
+     * @brief The config that values are parsed from.
+     */
+    const Config &config() const { return m_config; }
+
+private:
+    struct Value {
+        virtual ~Value() {}
+        virtual void parse(const Config &config) = 0;
+    };
+
+    template <typename T> struct Scalar : public Value {
+        Scalar(const std::string &key, const T &defaultValue)
+            : key(key), defaultValue(defaultValue) {}
+        void parse(const Config &config) override {
+            value = config.get<T>(key, defaultValue);
+        }
+        std::string key;
+        T defaultValue;
+        T value;
+    };
+
+    template <typename T> struct Array : public Value {
+        Array(const std::string &key, const std::vector<T> &defaultValue)
+            : key(key), defaultValue(defaultValue) {}
+        void parse(const Config &config) override {
+            value = config.getArray<T>(key, defaultValue);
+        }
+        std::string key;
+        std::vector<T> defaultValue;
+        std::vector<T> value;
+    };
+
+    template <typename V, typename D>
+    const decltype(V::value) &bind(const std::string &key,
+                                   const D &defaultValue) {
+        // find() takes the key by reference, it is only copied when the
+        // value is bound for the first time
+        std::map<std::string, std::unique_ptr<Value>> &values =
+            m_values[std::type_index(typeid(V))];
+        auto it = values.find(key);
+        if (it == values.end()) {
+            std::unique_ptr<Value> value(new V(key, defaultValue));
+            value->parse(m_config);
+            it = values.emplace(key, std::move(value)).first;
+        }
+        return static_cast<V *>(it->second.get())->value;
+    }
+
+    Config m_config;
+    std::map<std::type_index, std::map<std::string, std::unique_ptr<Value>>>
+        m_values;
+};
+
+}  // namespace lms
+
+#endif  // LMS_CONFIG_BINDING_H
@@ -8,12 +8,16 @@
 #include <memory>
 #include <typeinfo>
 #include <type_traits>
+#include <atomic>
+#include <cstring>
+#include <mutex>
 
 #include "logger.h"
 #include "type.h"
 #include "serializable.h"
 #include "exception.h"
 #include "inheritance.h"
+#include "shared_memory.h"
 
 namespace lms {
 
@@ -74,6 +78,39 @@ struct ObjectBase {
     virtual bool isVoid() const = 0;
     virtual bool supportsInheritance() const = 0;
 
+    /**
+     * @brief Called by DataChannel::publish().
+     */
+    virtual void published(lms::Time t) { (void)t; }
+
+    /**
+     * @brief Return the publish timestamp if the object keeps track of it
+     * itself, e.g. if it is shared with other processes.
+     * @return false if DataChannelInternal::lastPublish should be used
+     */
+    virtual bool lastPublished(lms::Time &t) const {
+        (void)t;
+        return false;
+    }
+
+    /**
+     * @brief Like get(), but also return a token that identifies the version
+     * of the value for consistent().
+     */
+    virtual void *getVersioned(std::uint64_t &token) {
+        token = 0;
+        return get();
+    }
+
+    /**
+     * @brief Check if the value returned by getVersioned() with the given
+     * token was not overwritten in the meantime.
+     */
+    virtual bool consistent(std::uint64_t token) const {
+        (void)token;
+        return true;
+    }
+
     /**
      *
      * return returns SUBTYPE if the current object is a subtype of the given
@@ -168,12 +205,153 @@ template <typename T> struct Object : public FakeObject<T> {
     }
 };
 
+/**
+ * @brief Channel object whose value lives in a shared memory segment.
+ *
+ * The writer gets a pointer to a slot that no reader looks at. publish()
+ * makes the slot the new head and copies its value into the next slot, which
+ * becomes the new write slot. Readers get a pointer to the head slot without
+ * copying. A slot is only overwritten again after slots - 1 publishes, and
+ * consistent() tells a reader whether that happened while it held the
+ * pointer (seqlock). Each reader handle keeps the token of its own last
+ * get(), so concurrent readers don't disturb each other.
+ *
+ * Only trivially copyable types can be shared.
+ */
+template <typename T> struct SharedObject : public FakeObject<T> {
+    SharedObject(const std::string &channel, bool writer, std::uint32_t slots)
+        : m_segment(channel, slots, sizeof(T), lms::typeName<T>()),
+          m_writer(writer), m_index(0) {
+        if (m_writer) {
+            SharedChannelHeader *header = m_segment.header();
+            std::uint32_t head = header->head.load(std::memory_order_acquire);
+            m_index = (head + 1) % m_segment.slots();
+            beginWrite(head);
+        }
+    }
+
+    void *get() override {
+        std::uint64_t token;
+        return getVersioned(token);
+    }
+
+    void *getVersioned(std::uint64_t &token) override {
+        if (m_writer) {
+            token = 0;
+            return m_segment.data(m_index);
+        }
+        std::uint32_t index = 0;
+        std::uint32_t seq = 1;
+        // an odd sequence means the writer already reuses the head slot we
+        // loaded, the head has moved on since
+        for (std::uint32_t i = 0; i < m_segment.slots() && seq % 2 == 1; i++) {
+            index = m_segment.header()->head.load(std::memory_order_acquire);
+            seq = m_segment.slot(index)->seq.load(std::memory_order_acquire);
+        }
+        // still odd: consistent() reports the value as torn
+        token = std::uint64_t(index) << 32 | seq;
+        return m_segment.data(index);
+    }
+
+    Inheritance *getInheritance() override { return nullptr; }
+    Serializable *getSerializable() override { return nullptr; }
+    bool isSerializable() const override { return false; }
+    bool supportsInheritance() const override { return false; }
+
+    void published(lms::Time t) override {
+        if (!m_writer) {
+            return;
+        }
+        SharedChannelHeader *header = m_segment.header();
+        // end the write of the current slot and make it visible
+        m_segment.slot(m_index)->seq.fetch_add(1, std::memory_order_release);
+        header->lastPublish.store(t.micros(), std::memory_order_relaxed);
+        header->head.store(m_index, std::memory_order_release);
+
+        std::uint32_t published = m_index;
+        m_index = (m_index + 1) % m_segment.slots();
+        beginWrite(published);
+    }
+
+    bool lastPublished(lms::Time &t) const override {
+        t = lms::Time::fromMicros(m_segment.header()->lastPublish.load(
+            std::memory_order_acquire));
+        return true;
+    }
+
+    bool consistent(std::uint64_t token) const override {
+        if (m_writer) {
+            return true;
+        }
+        const std::uint32_t seq = std::uint32_t(token);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return seq % 2 == 0 &&
+               m_segment.slot(token >> 32)->seq.load(
+                   std::memory_order_relaxed) == seq;
+    }
+
+private:
+    /**
+     * @brief Mark the current write slot as owned by the writer and start
+     * with the value of the given slot.
+     */
+    void beginWrite(std::uint32_t from) {
+        SharedChannelSlot *slot = m_segment.slot(m_index);
+        if (slot->seq.load(std::memory_order_relaxed) % 2 == 0) {
+            slot->seq.fetch_add(1, std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+        if (from != m_index) {
+            std::memcpy(m_segment.data(m_index), m_segment.data(from),
+                        sizeof(T));
+        }
+    }
+
+    SharedMemorySegment m_segment;
+    bool m_writer;
+    // writer: index of the write slot
+    std::uint32_t m_index;
+};
+
+template <typename T, bool shareable> struct SharedObjectFactory;
+
+template <typename T> struct SharedObjectFactory<T, false> {
+    static ObjectBase *create(const std::string &channel, bool writer,
+                              std::uint32_t slots) {
+        (void)writer;
+        (void)slots;
+        LMS_EXCEPTION("Channel " + channel + " (" + lms::typeName<T>() +
+                      ") can't be shared, type is not trivially copyable");
+    }
+};
+
+template <typename T> struct SharedObjectFactory<T, true> {
+    static ObjectBase *create(const std::string &channel, bool writer,
+                              std::uint32_t slots) {
+        return new SharedObject<T>(channel, writer, slots);
+    }
+};
+
+/**
+ * @brief Gets notified about every get() of a data channel, see
+ * DataManager::observeAccesses(). Used for race detection.
+ *
+ * access() is called from the thread that accesses the channel.
+ */
+class AccessObserver {
+public:
+    virtual ~AccessObserver() {}
+    virtual void access(const std::string &channel, bool write) = 0;
+};
+
 class DataChannelInternal {
 public:
     std::unique_ptr<ObjectBase> main;
     std::mutex lastPublishMutex;
     lms::Time lastPublish;
+    std::atomic<AccessObserver *> observer;
 
+    DataChannelInternal() : observer(nullptr) {}
     virtual ~DataChannelInternal() {}
 
     std::string typeName() const {
@@ -193,10 +371,12 @@ template <typename T> class DataChannel {
 
 public:
     DataChannel(std::shared_ptr<DataChannelInternal> internal)
-        : m_internal(internal), m_lastRead() {}
+        : m_internal(internal), m_lastRead(), m_readToken(0) {}
 protected:
     std::shared_ptr<DataChannelInternal> m_internal;
     lms::Time m_lastRead;
+    // version of the value returned by the last get(), see consistent()
+    std::uint64_t m_readToken;
 
 public:
     std::string name() const { return m_internal->name; }
@@ -250,6 +430,7 @@ public:
     void publish(lms::Time t = lms::Time::now()) {
         std::lock_guard<std::mutex> lock(m_internal->lastPublishMutex);
         m_internal->lastPublish = t;
+        m_internal->main->published(t);
     }
 
     /**
@@ -263,12 +444,34 @@ public:
      */
     bool hasNewData() {
         std::lock_guard<std::mutex> lock(m_internal->lastPublishMutex);
-        const bool hasNew = m_internal->lastPublish > m_lastRead;
-        m_lastRead = m_internal->lastPublish;
+        lms::Time lastPublish = m_internal->lastPublish;
+        m_internal->main->lastPublished(lastPublish);
+        const bool hasNew = lastPublish > m_lastRead;
+        m_lastRead = lastPublish;
         return hasNew;
     }
 
+    /**
+     * @brief Check if the data returned by the last get() is still intact.
+     *
+     * Always true for local channels. For channels that are shared with
+     * another runtime (see DataManager::shareChannel()) this returns false if
+     * the writer overwrote the data while it was read. Copy the data first
+     * and check afterwards if a consistent snapshot is needed.
+     */
+    bool consistent() const {
+        return m_internal->main->consistent(m_readToken);
+    }
+
 protected:
+    void observe(bool write) const {
+        AccessObserver *observer =
+            m_internal->observer.load(std::memory_order_relaxed);
+        if (observer != nullptr) {
+            observer->access(m_internal->name, write);
+        }
+    }
+
     // Util-method
     template <typename A, bool suppInher> struct InheritanceCallerGet;
 
@@ -278,15 +481,16 @@ protected:
                 return dynamic_cast<A *>(
                     obj->m_internal->main->getInheritance()); // avoid casting to void*
             } else {
-                return static_cast<A *>(obj->m_internal->main->get()); //casting it to void*!
+                return static_cast<A *>(obj->m_internal->main->getVersioned(
+                    obj->m_readToken)); //casting it to void*!
             }
         }
     };
 
     template <typename A> struct InheritanceCallerGet<A, false> {
         static A *call(DataChannel<T> *obj) {
-            return static_cast<A *>(
-                obj->m_internal->main->get()); //casting it to void*!
+            return static_cast<A *>(obj->m_internal->main->getVersioned(
+                obj->m_readToken)); //casting it to void*!
         }
     };
 
@@ -348,9 +552,13 @@ public:
         }
     }
     */
-    const T *get() { return this->get_(); }
+    const T *get() {
+        this->observe(false);
+        return this->get_();
+    }
 
     template <typename A> const A *getWithType() {
+        this->observe(false);
         return DataChannel<T>::template getWithType_<A>();
     }
 
@@ -366,9 +574,13 @@ public:
 
     WriteDataChannel() : DataChannel<T>(nullptr) {}
 
-    T *get() { return this->get_(); }
+    T *get() {
+        this->observe(true);
+        return this->get_();
+    }
 
     template <typename A> A *getWithType() {
+        this->observe(true);
         return DataChannel<T>::template getWithType_<A>();
     }
 
@@ -407,8 +619,34 @@ public:
                                std::shared_ptr<DataChannelInternal>> ChannelMap;
 
 private:
+    struct SharedChannelInfo {
+        bool writer;
+        std::uint32_t slots;
+    };
+
     logging::Logger logger;
     ChannelMap channels;
+    AccessObserver *m_observer;
+    std::unordered_map<std::string, SharedChannelInfo> sharedChannels;
+
+    /**
+     * @brief Create the object for a channel, in shared memory if the channel
+     * was shared.
+     */
+    template <typename T> ObjectBase *newObject(const std::string &name) {
+        if (std::is_abstract<T>::value) {
+            return new FakeObject<T>();
+        }
+        auto it = sharedChannels.find(name);
+        if (it != sharedChannels.end() && !std::is_same<T, Any>::value) {
+            return SharedObjectFactory<
+                T, std::is_trivially_copyable<T>::value &&
+                       !std::is_abstract<T>::value>::create(name,
+                                                            it->second.writer,
+                                                            it->second.slots);
+        }
+        return new Object<T>();
+    }
 
 public:
     DataManager();
@@ -437,13 +675,10 @@ public:
             // logger.debug("accessChannel")<<"creating new
             // dataChannel"<<name<<" to "<< typeid(T).name();
             channel = std::make_shared<DataChannelInternal>();
-
-            // check if T is abstract
-            if (std::is_abstract<T>::value) {
-                channel->main.reset(new FakeObject<T>());
-            } else {
-                channel->main.reset(new Object<T>());
-            }
+            channel->main.reset(newObject<T>(name));
+            // never changes, so observers may read it from any thread
+            channel->name = name;
+            channel->observer.store(m_observer);
         } else {
             if (!channel->main) {
                 channel->main.reset(new Object<T>());
@@ -459,13 +694,11 @@ public:
                     // we can "upgrade" the current channel
                     // delete old object
                     // create new one
-                    channel->main.reset(new Object<T>());
+                    channel->main.reset(newObject<T>(name));
                 }
             }
         }
 
-        // TODO lazy
-        channel->name = name;
         return channel;
     }
 
@@ -496,7 +729,33 @@ public:
     }
 
     /**
-     * @brief Delete all data channels
+     * @brief Place the given data channel in shared memory so that it can
+     * be accessed by other runtimes without serialization.
+     *
+     * Must be called before the channel is accessed for the first time. The
+     * value type must be trivially copyable and the same in all runtimes.
+     * Exactly one runtime should share the channel as writer.
+     *
+     * @param name data channel name
+     * @param writer true if this runtime writes into the channel
+     * @param slots number of values kept in the shared ring, a reader's
+     * pointer stays valid for slots - 1 publishes
+     */
+    void shareChannel(const std::string &name, bool writer,
+                      std::uint32_t slots = 4);
+
+    /**
+     * @brief Notify an observer about every get() of all current and future
+     * data channels.
+     *
+     * Must not be called while modules access channels.
+     *
+     * @param observer nullptr to stop observing
+     */
+    void observeAccesses(AccessObserver *observer);
+
+    /**
+     * @brief Delete all data channels and forget which ones are shared
      */
     void reset();
 
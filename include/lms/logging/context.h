@@ -101,6 +101,11 @@ public:
      */
     void processMessage(const Event &message);
 
+    /**
+     * @brief Flush all installed sinks, e.g. before the process exits.
+     */
+    void flush();
+
     /**
      * @brief Reset profiling. Set internal state back to zero.
      */
@@ -28,6 +28,12 @@ public:
      * @param message a log message to write
      */
     virtual void sink(const Event &message) = 0;
+
+    /**
+     * @brief Write out messages that the sink buffered. The default
+     * implementation does nothing.
+     */
+    virtual void flush() {}
 };
 
 } // namespace logging
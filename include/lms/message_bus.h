@@ -0,0 +1,314 @@
+#ifndef LMS_MESSAGE_BUS_H
+#define LMS_MESSAGE_BUS_H
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "exception.h"
+#include "type.h"
+#include "logger.h"
+
+namespace lms {
+
+/**
+ * @brief Untyped part of a message bus topic.
+ *
+ * Only used by MessageBus, modules use Publisher and Subscription.
+ */
+class TopicBase {
+public:
+    /** topics that are not swapped by any cycle yet */
+    static constexpr int UNASSIGNED = -1;
+
+    TopicBase(const std::string &name, const std::string &type, size_t capacity)
+        : name(name), type(type), domain(UNASSIGNED), capacity(capacity),
+          requestedCapacity(capacity), written(0), readable(0) {}
+    virtual ~TopicBase() {}
+
+    /**
+     * @brief Make the messages of the current cycle receivable and
+     * start a new cycle.
+     * @return number of messages that were dropped because the topic was full
+     */
+    virtual size_t swap() = 0;
+
+    const std::string name;
+    const std::string type;
+
+    /** modules that resolved a handle of this topic */
+    std::set<const void *> users;
+
+    /** cycle that swaps the topic, 0 is the main cycle */
+    int domain;
+
+    /** number of preallocated messages per cycle */
+    size_t capacity;
+
+    /** largest capacity of all publishers, applied by the next swap() */
+    size_t requestedCapacity;
+
+protected:
+    /** messages claimed in the current cycle, may exceed capacity */
+    std::atomic<size_t> written;
+
+    /** messages of the previous cycle */
+    size_t readable;
+};
+
+/**
+ * @brief Two preallocated ring slots per topic: publishers fill the back
+ * buffer while subscribers read the front buffer of the previous cycle.
+ *
+ * Claiming a message is a single atomic increment. Messages are assigned
+ * into slots that were used two cycles before, so types like std::vector
+ * keep their capacity and no memory is allocated after the first cycles.
+ */
+template <typename T> class Topic : public TopicBase {
+public:
+    Topic(const std::string &name, size_t capacity)
+        : TopicBase(name, lms::typeName<T>(), capacity), m_front(0) {
+        m_buffers[0].resize(capacity);
+        m_buffers[1].resize(capacity);
+    }
+
+    T *claim() {
+        size_t index = written.fetch_add(1, std::memory_order_relaxed);
+        if (index >= capacity) {
+            return nullptr;
+        }
+        return &m_buffers[1 - m_front][index];
+    }
+
+    size_t swap() override {
+        size_t count = written.exchange(0, std::memory_order_relaxed);
+        size_t dropped = count > capacity ? count - capacity : 0;
+        readable = std::min(count, capacity);
+        m_front = 1 - m_front;
+
+        if (requestedCapacity > capacity) {
+            capacity = requestedCapacity;
+            m_buffers[0].resize(capacity);
+            m_buffers[1].resize(capacity);
+        }
+        return dropped;
+    }
+
+    size_t size() const { return readable; }
+
+    const T *begin() const { return m_buffers[m_front].data(); }
+
+    const T *end() const { return begin() + readable; }
+
+private:
+    std::vector<T> m_buffers[2];
+    // buffer that subscribers read from
+    int m_front;
+};
+
+/**
+ * @brief Handle to send typed messages on a topic of a MessageBus.
+ *
+ * Copyable and cheap, resolve it once in initialize().
+ */
+template <typename T> class Publisher {
+public:
+    Publisher() : m_topic(nullptr) {}
+    explicit Publisher(Topic<T> *topic) : m_topic(topic) {}
+
+    /**
+     * @brief Reserve the next message of this cycle to fill it in place.
+     *
+     * The slot contains a message of an older cycle, overwrite all of it.
+     *
+     * @return nullptr if the topic is full in this cycle
+     */
+    T *claim() { return m_topic->claim(); }
+
+    /**
+     * @brief Send a message, it can be received in the next cycle.
+     * @return false if the topic is full in this cycle
+     */
+    bool publish(const T &message) {
+        T *slot = claim();
+        if (slot == nullptr) {
+            return false;
+        }
+        *slot = message;
+        return true;
+    }
+
+    bool publish(T &&message) {
+        T *slot = claim();
+        if (slot == nullptr) {
+            return false;
+        }
+        *slot = std::move(message);
+        return true;
+    }
+
+    /**
+     * @brief Return true if the handle was resolved by a message bus.
+     */
+    bool valid() const { return m_topic != nullptr; }
+
+private:
+    Topic<T> *m_topic;
+};
+
+/**
+ * @brief Handle to receive the typed messages of a topic that were sent
+ * in the previous cycle.
+ *
+ * Receiving does not remove messages, every subscription sees all of them.
+ */
+template <typename T> class Subscription {
+public:
+    typedef const T *const_iterator;
+
+    Subscription() : m_topic(nullptr) {}
+    explicit Subscription(const Topic<T> *topic) : m_topic(topic) {}
+
+    size_t size() const { return m_topic->size(); }
+
+    bool empty() const { return size() == 0; }
+
+    const T &operator[](size_t index) const { return begin()[index]; }
+
+    const_iterator begin() const { return m_topic->begin(); }
+
+    const_iterator end() const { return m_topic->end(); }
+
+    /**
+     * @brief Return true if the handle was resolved by a message bus.
+     */
+    bool valid() const { return m_topic != nullptr; }
+
+private:
+    const Topic<T> *m_topic;
+};
+
+/**
+ * @brief Typed message bus between modules.
+ *
+ * Unlike Messaging, messages are not converted to strings and sending does
+ * not lock or allocate. Each topic has a fixed number of preallocated
+ * messages per cycle, further messages are dropped and reported.
+ *
+ * Messages are queued for one cycle and can be received in the next cycle.
+ *
+ * **Example code**
+ *
+ * ~~~~~{.cpp}
+ * // in initialize()
+ * m_obstacles = publisher<Obstacle>("OBSTACLES", 32);
+ * m_commands = subscribe<Command>("COMMANDS");
+ *
+ * // in cycle()
+ * m_obstacles.publish(obstacle);
+ * for (const Command &cmd : m_commands) { ... }
+ * ~~~~~
+ *
+ * Handles may be resolved and used concurrently. Modules of detached
+ * partitions must resolve their handles in initialize(). Do not call swap()
+ * or assignDomains() outside of ExecutionManager.
+ */
+class MessageBus {
+public:
+    /** capacity of topics if not given */
+    static constexpr size_t DEFAULT_CAPACITY = 16;
+
+    MessageBus();
+
+    MessageBus(const MessageBus &) = delete;
+    MessageBus &operator=(const MessageBus &) = delete;
+
+    /**
+     * @brief Resolve a handle to send messages on the given topic.
+     *
+     * A topic must be used with the same message type everywhere. If
+     * publishers need different capacities the largest one is used from the
+     * next cycle on.
+     *
+     * @param topic topic name
+     * @param user module that uses the handle
+     * @param capacity maximum number of messages per cycle
+     */
+    template <typename T>
+    Publisher<T> publisher(const std::string &topic, const void *user = nullptr,
+                           size_t capacity = DEFAULT_CAPACITY) {
+        return Publisher<T>(resolve<T>(topic, user, capacity));
+    }
+
+    /**
+     * @brief Resolve a handle to receive messages of the given topic.
+     * @param topic topic name
+     * @param user module that uses the handle
+     */
+    template <typename T>
+    Subscription<T> subscribe(const std::string &topic,
+                              const void *user = nullptr) {
+        return Subscription<T>(resolve<T>(topic, user, DEFAULT_CAPACITY));
+    }
+
+    /**
+     * @brief Start a new cycle for all topics of the given domain.
+     *
+     * Should be called before each cycle of the domain.
+     */
+    void swap(int domain = 0);
+
+    /**
+     * @brief Return the users of each topic.
+     */
+    std::map<std::string, std::set<const void *>> users() const;
+
+    /**
+     * @brief Set the cycle that swaps each topic. Must not be called while
+     * topics are swapped.
+     * @param domainOf returns the domain of a topic with the given users
+     */
+    void assignDomains(
+        const std::function<int(const std::set<const void *> &)> &domainOf);
+
+    /**
+     * @brief Return true if a topic or a user was added since the last
+     * assignDomains(). New topics are not swapped until then.
+     */
+    bool usersChanged() const;
+
+private:
+    template <typename T>
+    Topic<T> *resolve(const std::string &name, const void *user,
+                      size_t capacity) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::unique_ptr<TopicBase> &topic = m_topics[name];
+        if (!topic) {
+            topic.reset(new Topic<T>(name, capacity));
+            m_usersChanged = true;
+        } else if (topic->type != lms::typeName<T>()) {
+            LMS_EXCEPTION("Tried to access topic " + name + " (" +
+                          topic->type + ") with type " + lms::typeName<T>());
+        }
+        if (user != nullptr && topic->users.insert(user).second) {
+            m_usersChanged = true;
+        }
+        topic->requestedCapacity = std::max(topic->requestedCapacity, capacity);
+        return static_cast<Topic<T> *>(topic.get());
+    }
+
+    logging::Logger logger;
+    mutable std::mutex m_mutex;
+    std::map<std::string, std::unique_ptr<TopicBase>> m_topics;
+    std::atomic<bool> m_usersChanged;
+};
+
+}  // namespace lms
+
+#endif  // LMS_MESSAGE_BUS_H
@@ -3,8 +3,11 @@
 
 #include <map>
 #include <list>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace lms {
 
@@ -18,6 +21,10 @@ namespace lms {
  * The class is thread-safe if used correctly: Do not call
  * resetQueue() outside of ExecutionManager. The send/receive
  * methods can be called in the cycle methods of modules.
+ *
+ * Each sending thread appends to its own buffer, so modules on different
+ * threads don't contend on send(). Messages of one thread are received in
+ * the order they were sent.
  */
 class Messaging {
 public:
@@ -26,6 +33,9 @@ public:
      */
     Messaging();
 
+    Messaging(const Messaging &) = delete;
+    Messaging &operator=(const Messaging &) = delete;
+
     /**
      * @brief Send a message with the specified command and content.
      *
@@ -59,15 +69,25 @@ public:
 private:
     typedef std::map<std::string, std::list<std::string>> MessageQueue;
 
+    /* messages of one thread in the current cycle, only written by it */
+    typedef std::vector<std::pair<std::string, std::string>> SendBuffer;
+
+    /* send buffer of the calling thread, registered on first use */
+    SendBuffer &threadBuffer();
+
+    /* distinguishes instances in the thread local buffer cache */
+    const unsigned long id;
+
     /* messages that were sent in the previous cycle that can now be received */
     MessageQueue receiveQueue;
 
-    /* messages that were sent in the current cycle */
-    MessageQueue sendQueue;
+    /* buffers of all threads that sent messages, shared with the
+     * thread local cache so buffers of finished threads can be dropped */
+    std::vector<std::shared_ptr<SendBuffer>> sendBuffers;
 
     const std::list<std::string> emptyStringList;
 
-    /* mutex for sendQueue */
+    /* mutex for sendBuffers */
     std::mutex mtx;
 };
 
@@ -5,15 +5,18 @@
 #include <vector>
 #include <memory>
 #include <map>
+#include <mutex>
 
 #include "service.h"
 #include "datamanager.h"
 #include "config.h"
+#include "config_binding.h"
 #include "deprecated.h"
 #include "lms/definitions.h"
 #include "service_handle.h"
 #include "interface.h"
 #include "life_cycle.h"
+#include "message_bus.h"
 
 namespace lms {
 
@@ -76,6 +79,12 @@ public:
      * This method will be called only once and before
      * every other lifecycle method.
      *
+     * If the runtime sets initThreads in its <execution> tag, modules that
+     * don't depend on each other are initialized in parallel. init() must
+     * then be thread-safe: don't touch global or static state without
+     * synchronization. Channels, configs and services may be requested.
+     * destroy() is always called sequentially in reverse init order.
+     *
      * Must be overridden by modules.
      *
      * Returning false will prohibit the module from being
@@ -121,6 +130,9 @@ public:
      * guaranteed to be called after initialize() returned
      * true. This method will be never called before initialize().
      *
+     * Modules are destroyed one after another in the reverse order in which
+     * their init() finished, so destroy() never runs in parallel.
+     *
      * Must be overridden by a module.
      */
     virtual void destroy() override;
@@ -177,6 +189,49 @@ protected:
         }
     }
 
+    /**
+     * @brief Returns a handle to a service that allows only const access.
+     * The service is locked shared: several modules may read it at the same
+     * time, getService() waits until all shared handles are destroyed.
+     *
+     * Usage:
+     * ~~~~~{.cpp}
+     * {
+     *   SharedServiceHandle<MapService> maps = getSharedService<MapService>("maps");
+     *   maps->lookup(position);
+     * }
+     * ~~~~~
+     */
+    template <class T>
+    SharedServiceHandle<T> getSharedService(std::string const &name) {
+        auto service = _getService(name);
+        if (service) {
+            return SharedServiceHandle<T>(service);
+        } else {
+            return SharedServiceHandle<T>();
+        }
+    }
+
+    /**
+     * @brief Returns a handle to a service that does not lock it, for
+     * calling the service's asynchronous operations.
+     *
+     * Usage:
+     * ~~~~~{.cpp}
+     * // in initialize()
+     * m_maps = getAsyncService<MapService>("maps");
+     *
+     * // in cycle()
+     * std::future<Path> path = m_maps->findPath(from, to);
+     * ...
+     * use(path.get());
+     * ~~~~~
+     */
+    template <class T>
+    AsyncServiceHandle<T> getAsyncService(std::string const &name) {
+        return AsyncServiceHandle<T>(_getService(name));
+    }
+
     /**
      * @brief Returns the service instance of the given name if available.
      * This does not lock the service and is therefore not thread-safe.
@@ -200,6 +255,34 @@ protected:
      */
     Messaging *messaging() const;
 
+    /**
+     * @brief Returns the typed message bus.
+     */
+    MessageBus *messageBus() const;
+
+    /**
+     * @brief Resolve a handle to send typed messages on a topic.
+     * Should be called in initialize(), see MessageBus.
+     * @param topic topic name
+     * @param capacity maximum number of messages per cycle
+     * @return publisher handle
+     */
+    template <typename T>
+    Publisher<T> publisher(const std::string &topic,
+                           size_t capacity = MessageBus::DEFAULT_CAPACITY) {
+        return messageBus()->publisher<T>(topic, this, capacity);
+    }
+
+    /**
+     * @brief Resolve a handle to receive typed messages of a topic.
+     * Should be called in initialize(), see MessageBus.
+     * @param topic topic name
+     * @return subscription handle
+     */
+    template <typename T> Subscription<T> subscribe(const std::string &topic) {
+        return messageBus()->subscribe<T>(topic, this);
+    }
+
     /**
      * @brief Check if --enable-save was given on the command line.
      * @return true if set, false otherwise
@@ -275,6 +358,17 @@ protected:
      */
     const Config &config(const std::string &name = "default");
 
+    /**
+     * @brief Return typed values of the given config that are parsed only
+     * once. Use this instead of config() for values that are read in cycle().
+     *
+     * The bound values are updated before configsChanged() is called.
+     *
+     * @param name config's name
+     * @return binding to the module config
+     */
+    ConfigBinding &configBinding(const std::string &name = "default");
+
     /**
      * @brief Check if a config of the given name was loaded.
      * @param name config's name
@@ -291,8 +385,7 @@ protected:
      */
     template <typename T>
     ReadDataChannel<T> readChannel(const std::string &name) {
-        gainReadAccess(name);
-        return datamanager().readChannel<T>(mapChannel(name));
+        return requestChannel<T>(name, false);
     }
 
     /**
@@ -304,8 +397,7 @@ protected:
      */
     template <typename T>
     WriteDataChannel<T> writeChannel(const std::string &name) {
-        gainWriteAccess(name);
-        return datamanager().writeChannel<T>(mapChannel(name));
+        return requestChannel<T>(name, true);
     }
 
     /**
@@ -353,7 +445,52 @@ private:
     void gainReadAccess(const std::string &channelName);
     void gainWriteAccess(const std::string &channelName);
 
+    /**
+     * @brief Return the channel if the module requested it before, nullptr
+     * otherwise.
+     *
+     * Not synchronized, a module must not request channels from several
+     * threads at the same time.
+     */
+    std::shared_ptr<DataChannelInternal>
+    requestedChannel(const std::string &channelName) const;
+    void rememberChannel(const std::string &channelName,
+                         const std::shared_ptr<DataChannelInternal> &channel);
+
+    /**
+     * @brief Return the channel for a handle of type T.
+     *
+     * The module graph and the DataManager's channel map are not
+     * thread-safe, so the first request of a channel holds channelMutex().
+     * Later requests of the same or a base type change neither and return
+     * the remembered channel without locking.
+     */
+    template <typename T>
+    std::shared_ptr<DataChannelInternal> requestChannel(const std::string &name,
+                                                        bool write) {
+        std::shared_ptr<DataChannelInternal> channel = requestedChannel(name);
+        if (channel && channel->main) {
+            const TypeResult type = channel->main->checkType<T>();
+            if (type == TypeResult::SAME || type == TypeResult::SUBTYPE) {
+                return channel;
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(channelMutex());
+        if (write) {
+            gainWriteAccess(name);
+        } else {
+            gainReadAccess(name);
+        }
+        channel = datamanager().accessChannel<T>(mapChannel(name));
+        rememberChannel(name, channel);
+        return channel;
+    }
+
     DataManager &datamanager();
+
+    // modules may be initialized in parallel, see Framework::updateSystem
+    std::mutex &channelMutex();
 };
 
 } // namespace lms
@@ -1,24 +1,147 @@
 #pragma once
 
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+#include <sys/uio.h>
+
 #include <google/protobuf/message.h>
 
 namespace lms {
 
+/**
+ * @brief Length-prefixed protobuf messages over a stream socket.
+ *
+ * Every message is sent as a 4 byte little endian length followed by the
+ * serialized message.
+ *
+ * The socket keeps an input and an output buffer that are reused for all
+ * messages, so reading and writing does not allocate in steady state.
+ *
+ * readMessage() and writeMessage() block until a message is complete.
+ * For non-blocking sockets use the buffered interface instead:
+ * - enqueue() serializes a message into the output buffer, flush() writes as
+ *   much of the buffer as the socket accepts with a single writev() call
+ * - receive() reads what is available, nextMessage() parses complete messages
+ *   from the input buffer
+ *
+ * A frame that goes to many sockets can be built once with makeFrame() and
+ * enqueued on every socket, the sockets only keep a reference to it.
+ */
 class ProtobufSocket {
 public:
     enum Error {
         OK, CLOSED, ERROR
     };
 
+    /**
+     * @brief Complete frame including the length prefix, shared between the
+     * output buffers of several sockets.
+     */
+    typedef std::shared_ptr<const std::string> SharedFrame;
+
     ProtobufSocket(int fd);
     ~ProtobufSocket();
 
+    /**
+     * @brief Send a message and all previously enqueued ones. Blocks until
+     * everything is written, even on non-blocking sockets.
+     */
     Error writeMessage(const google::protobuf::Message &message);
+
+    /**
+     * @brief Wait until a complete message was received and parse it.
+     */
     Error readMessage(google::protobuf::Message &message);
+
+    /**
+     * @brief Serialize a message into the output buffer without sending it.
+     */
+    void enqueue(const google::protobuf::Message &message);
+
+    /**
+     * @brief Append an already serialized message to the output buffer.
+     * @param data serialized message without length prefix
+     * @param size number of bytes in data
+     */
+    void enqueue(const char *data, size_t size);
+
+    /**
+     * @brief Append a shared frame to the output buffer without copying it.
+     */
+    void enqueue(const SharedFrame &frame);
+
+    /**
+     * @brief Build a frame that can be enqueued on several sockets.
+     * @param data serialized message without length prefix
+     * @param size number of bytes in data
+     */
+    static SharedFrame makeFrame(const char *data, size_t size);
+
+    /**
+     * @brief Write as much of the output buffer as possible without
+     * blocking on non-blocking sockets.
+     * @return OK if the socket accepted everything or would block, check
+     * pending() for remaining bytes
+     */
+    Error flush();
+
+    /**
+     * @brief Number of bytes in the output buffer that were not yet sent.
+     */
+    size_t pending() const;
+
+    /**
+     * @brief Read data into the input buffer.
+     *
+     * Blocks on blocking sockets until at least some data is available.
+     * Returns OK without data if a non-blocking socket has nothing to read.
+     * @param maxBytes upper bound of bytes to read in a single call
+     */
+    Error receive(size_t maxBytes = 64 * 1024);
+
+    /**
+     * @brief Parse the next complete message from the input buffer.
+     * @param error set to ERROR if a message could not be parsed, the
+     * connection should be closed then like after a failed receive().
+     * Not changed otherwise.
+     * @return false if no complete message was received yet or parsing failed
+     */
+    bool nextMessage(google::protobuf::Message &message, Error &error);
+
     int getFD() const;
     void close();
 private:
     int fd;
+
+    std::string m_in;
+    // bytes before this offset were already parsed
+    size_t m_inOffset;
+
+    struct Chunk {
+        // owned bytes, empty if the chunk references a shared frame
+        std::string data;
+        SharedFrame shared;
+
+        const std::string &bytes() const { return shared ? *shared : data; }
+    };
+
+    // output is collected in chunks, messages are appended to the last one
+    // unless it is a shared frame
+    std::deque<Chunk> m_out;
+    // bytes of m_out.front() that were already sent
+    size_t m_outOffset;
+    size_t m_pending;
+    // cleared chunks that keep their capacity
+    std::vector<std::string> m_spare;
+    std::vector<iovec> m_iov;
+
+    Error writePending();
+    Error waitWritable();
+    std::uint8_t *reserve(size_t frameSize);
+    // next complete frame without length prefix, valid until receive()
+    bool nextFrame(const char *&data, size_t &size);
 };
 
 }  // namespace lms
@@ -1,9 +1,15 @@
 #ifndef LMS_SERVICE_H
 #define LMS_SERVICE_H
 
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <type_traits>
 
 #include "config.h"
+#include "shared_mutex.h"
 #include "logger.h"
 #include "lms/definitions.h"
 #include "interface.h"
@@ -18,6 +24,20 @@ class ServiceInfo;
 /**
  * @brief Abstract super class for an LMS service. Services are loaded and
  * will be initialized and destroyed by the framework.
+ *
+ * Operations that may take long should be declared with serialized() or
+ * threadSafe(). They run on the service's worker threads and return a
+ * future, modules call them through an AsyncServiceHandle without locking
+ * the service.
+ *
+ * **Example code**
+ *
+ * ~~~~~{.cpp}
+ * std::future<Path> MapService::findPath(Point from, Point to) {
+ *     // the map is only read, several lookups may run in parallel
+ *     return threadSafe([this, from, to]() { return m_map.find(from, to); });
+ * }
+ * ~~~~~
  */
 class Service : public LifeCycle {
 public:
@@ -54,8 +74,44 @@ public:
      */
     std::string getName() const;
 
-    std::mutex& getMutex();
+    /**
+     * @brief Lock of the service, held exclusively by ServiceHandle and
+     * shared by SharedServiceHandle.
+     */
+    SharedMutex& getMutex();
+
+    /**
+     * @brief Run all queued operations and stop the worker threads.
+     * Called by the framework before destroy().
+     */
+    void stopWorkers();
 protected:
+    /**
+     * @brief Run an operation on a worker thread while the service is locked.
+     *
+     * The operation is serialized with other serialized operations and
+     * with ServiceHandles and SharedServiceHandles. Don't wait for the future while holding a
+     * ServiceHandle of the same service.
+     *
+     * @return future of the operation's result
+     */
+    template <typename F>
+    std::future<typename std::result_of<F()>::type> serialized(F operation) {
+        return post(std::move(operation), true);
+    }
+
+    /**
+     * @brief Run an operation on a worker thread without locking the
+     * service. The operation must be safe to run concurrently with all
+     * other operations and ServiceHandles.
+     *
+     * @return future of the operation's result
+     */
+    template <typename F>
+    std::future<typename std::result_of<F()>::type> threadSafe(F operation) {
+        return post(std::move(operation), false);
+    }
+
     /**
      * @brief Return a read-only config of the given name.
      * @param name config's name
@@ -65,6 +121,23 @@ protected:
     logging::Logger logger;
 
 private:
+    template <typename F>
+    std::future<typename std::result_of<F()>::type> post(F operation,
+                                                         bool serialized) {
+        typedef typename std::result_of<F()>::type Result;
+        auto task = std::make_shared<std::packaged_task<Result()>>(
+            std::move(operation));
+        std::future<Result> result = task->get_future();
+        enqueue([task]() { (*task)(); }, serialized);
+        return result;
+    }
+
+    /**
+     * @brief Queue a task for the worker threads, runs it on the calling
+     * thread if the service has no workers or they were stopped.
+     */
+    void enqueue(std::function<void()> task, bool serialized);
+
     struct Private;
     Private *dptr;
     inline Private *dfunc() { return dptr; }
@@ -23,10 +23,83 @@ public:
 
 private:
     std::shared_ptr<Service> m_service;
-    std::unique_lock<std::mutex> m_lock;
+    std::unique_lock<SharedMutex> m_lock;
     bool m_valid;
 };
 
+/**
+ * @brief Handle to a service that holds its lock shared.
+ *
+ * Any number of SharedServiceHandles of a service may exist at the same time,
+ * a ServiceHandle waits until all of them are destroyed. Only const methods
+ * of the service can be called.
+ */
+template <class T> class SharedServiceHandle {
+public:
+    SharedServiceHandle(std::shared_ptr<Service> service) : m_service(service) {
+        m_service->getMutex().lock_shared();
+    }
+
+    SharedServiceHandle() {}
+
+    SharedServiceHandle(SharedServiceHandle &&other)
+        : m_service(std::move(other.m_service)) {
+        other.m_service.reset();
+    }
+
+    SharedServiceHandle &operator=(SharedServiceHandle &&other) {
+        if (this != &other) {
+            release();
+            m_service = std::move(other.m_service);
+            other.m_service.reset();
+        }
+        return *this;
+    }
+
+    SharedServiceHandle(const SharedServiceHandle &) = delete;
+    SharedServiceHandle &operator=(const SharedServiceHandle &) = delete;
+
+    ~SharedServiceHandle() { release(); }
+
+    const T *operator->() const { return static_cast<const T *>(m_service.get()); }
+
+    operator bool() const { return isValid(); }
+
+    bool isValid() const { return m_service != nullptr; }
+
+private:
+    void release() {
+        if (m_service) {
+            m_service->getMutex().unlock_shared();
+            m_service.reset();
+        }
+    }
+
+    std::shared_ptr<Service> m_service;
+};
+
+/**
+ * @brief Handle to a service that does not lock it.
+ *
+ * Only call operations the service declares as serialized() or
+ * threadSafe(), they return futures and run on the service's workers.
+ */
+template <class T> class AsyncServiceHandle {
+public:
+    AsyncServiceHandle(std::shared_ptr<Service> service) : m_service(service) {}
+
+    AsyncServiceHandle() {}
+
+    T *operator->() const { return static_cast<T *>(m_service.get()); }
+
+    operator bool() const { return isValid(); }
+
+    bool isValid() const { return m_service != nullptr; }
+
+private:
+    std::shared_ptr<Service> m_service;
+};
+
 } // namespace lms
 
 #endif // LMS_SERVICE_HANDLE_H
@@ -0,0 +1,83 @@
+#ifndef LMS_SHARED_MEMORY_H
+#define LMS_SHARED_MEMORY_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace lms {
+
+/**
+ * @brief Header at the beginning of every shared memory channel segment.
+ *
+ * The segment is zero-initialized by ftruncate, which is a valid empty state
+ * for all fields.
+ */
+struct SharedChannelHeader {
+    //! hash of the channel's type name, 0 if not yet claimed
+    std::atomic<std::uint64_t> typeHash;
+    //! index of the slot that was published last
+    std::atomic<std::uint32_t> head;
+    //! timestamp of the last publish in microseconds
+    std::atomic<std::int64_t> lastPublish;
+};
+
+/**
+ * @brief Every slot starts with a sequence counter. The counter is odd while
+ * the writer owns the slot and even after the slot was published.
+ */
+struct SharedChannelSlot {
+    std::atomic<std::uint32_t> seq;
+};
+
+/**
+ * @brief POSIX shared memory segment that holds a ring of slots for a single
+ * data channel.
+ *
+ * The segment is named after the channel ("/lms.<channel>") and is created by
+ * whichever runtime opens it first. The segment itself never unlinks the
+ * name. The runtime that shares the channel as writer unlinks it on a clean
+ * shutdown and when the channel is removed from its config, readers that are
+ * still attached keep the old segment until they restart. A writer that
+ * crashed leaves the segment behind and reconnects to the readers when it is
+ * restarted. Use unlink() or remove /dev/shm/lms.* to get rid of stale
+ * segments.
+ */
+class SharedMemorySegment {
+public:
+    /**
+     * @brief Open or create the segment for the given channel.
+     * @param channel data channel name, must not contain a slash
+     * @param slots number of slots in the ring
+     * @param size size of a value in a slot
+     * @param typeName type name of the channel, must be the same in all
+     * runtimes
+     */
+    SharedMemorySegment(const std::string &channel, std::uint32_t slots,
+                        size_t size, const std::string &typeName);
+    ~SharedMemorySegment();
+
+    SharedMemorySegment(const SharedMemorySegment &) = delete;
+    SharedMemorySegment &operator=(const SharedMemorySegment &) = delete;
+
+    SharedChannelHeader *header() const { return m_header; }
+    SharedChannelSlot *slot(std::uint32_t index) const;
+    void *data(std::uint32_t index) const;
+    std::uint32_t slots() const { return m_slots; }
+
+    /**
+     * @brief Remove the segment of the given channel from the system.
+     */
+    static void unlink(const std::string &channel);
+
+private:
+    std::uint32_t m_slots;
+    size_t m_slotSize;
+    size_t m_mappedSize;
+    SharedChannelHeader *m_header;
+    char *m_base;
+};
+
+} // namespace lms
+
+#endif /* LMS_SHARED_MEMORY_H */
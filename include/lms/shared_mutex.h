@@ -0,0 +1,39 @@
+#ifndef LMS_SHARED_MUTEX_H
+#define LMS_SHARED_MUTEX_H
+
+#include <pthread.h>
+
+namespace lms {
+
+/**
+ * @brief Reader/writer lock with the interface of C++17's std::shared_mutex.
+ *
+ * Any number of threads may hold the lock shared, exclusive owners wait for
+ * them and block new shared owners. Works with std::unique_lock and
+ * std::lock_guard for exclusive ownership.
+ *
+ * Errors of the underlying pthread_rwlock throw std::system_error.
+ */
+class SharedMutex {
+public:
+    SharedMutex();
+    ~SharedMutex();
+
+    SharedMutex(const SharedMutex &) = delete;
+    SharedMutex &operator=(const SharedMutex &) = delete;
+
+    void lock();
+    bool try_lock();
+    void unlock();
+
+    void lock_shared();
+    bool try_lock_shared();
+    void unlock_shared();
+
+private:
+    pthread_rwlock_t m_lock;
+};
+
+}  // namespace lms
+
+#endif  // LMS_SHARED_MUTEX_H
@@ -75,6 +75,8 @@ struct Request_RuntimeOneofInstance {
   const ::lms::Request_Runtime_Profiling* profiling_;
   const ::lms::Request_Runtime_StartRecording* start_recording_;
   const ::lms::Request_Runtime_StopRecording* stop_recording_;
+  const ::lms::Request_Runtime_DumpFlightRecorder* dump_flight_recorder_;
+  const ::lms::Request_Runtime_ChannelSubscribe* channel_subscribe_;
 }* Request_Runtime_default_oneof_instance_ = NULL;
 const ::google::protobuf::Descriptor* Request_Runtime_LogFilter_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
@@ -88,6 +90,12 @@ const ::google::protobuf::internal::GeneratedMessageReflection*
 const ::google::protobuf::Descriptor* Request_Runtime_StopRecording_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   Request_Runtime_StopRecording_reflection_ = NULL;
+const ::google::protobuf::Descriptor* Request_Runtime_DumpFlightRecorder_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  Request_Runtime_DumpFlightRecorder_reflection_ = NULL;
+const ::google::protobuf::Descriptor* Request_Runtime_ChannelSubscribe_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  Request_Runtime_ChannelSubscribe_reflection_ = NULL;
 const ::google::protobuf::Descriptor* Request_Stdin_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   Request_Stdin_reflection_ = NULL;
@@ -101,6 +109,8 @@ struct ResponseOneofInstance {
   const ::lms::Response_ModuleListResponse* module_list_;
   const ::lms::Response_LogEvent* log_event_;
   const ::lms::Response_ProfilingSummary* profiling_summary_;
+  const ::lms::Response_LogEventBatch* log_event_batch_;
+  const ::lms::Response_ChannelSnapshot* channel_snapshot_;
 }* Response_default_oneof_instance_ = NULL;
 const ::google::protobuf::Descriptor* Response_Info_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
@@ -131,12 +141,21 @@ const ::google::protobuf::Descriptor* Response_LogEvent_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   Response_LogEvent_reflection_ = NULL;
 const ::google::protobuf::EnumDescriptor* Response_LogEvent_Level_descriptor_ = NULL;
+const ::google::protobuf::Descriptor* Response_LogEventBatch_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  Response_LogEventBatch_reflection_ = NULL;
 const ::google::protobuf::Descriptor* Response_ProfilingSummary_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   Response_ProfilingSummary_reflection_ = NULL;
 const ::google::protobuf::Descriptor* Response_ProfilingSummary_Trace_descriptor_ = NULL;
 const ::google::protobuf::internal::GeneratedMessageReflection*
   Response_ProfilingSummary_Trace_reflection_ = NULL;
+const ::google::protobuf::Descriptor* Response_ChannelSnapshot_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  Response_ChannelSnapshot_reflection_ = NULL;
+const ::google::protobuf::Descriptor* Response_ChannelSnapshot_Channel_descriptor_ = NULL;
+const ::google::protobuf::internal::GeneratedMessageReflection*
+  Response_ChannelSnapshot_Channel_reflection_ = NULL;
 
 }  // namespace
 
@@ -335,12 +354,14 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(Request_Detach));
   Request_Runtime_descriptor_ = Request_descriptor_->nested_type(10);
-  static const int Request_Runtime_offsets_[6] = {
+  static const int Request_Runtime_offsets_[8] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request_Runtime, name_),
     PROTO2_GENERATED_DEFAULT_ONEOF_FIELD_OFFSET(Request_Runtime_default_oneof_instance_, filter_),
     PROTO2_GENERATED_DEFAULT_ONEOF_FIELD_OFFSET(Request_Runtime_default_oneof_instance_, profiling_),
     PROTO2_GENERATED_DEFAULT_ONEOF_FIELD_OFFSET(Request_Runtime_default_oneof_instance_, start_recording_),
     PROTO2_GENERATED_DEFAULT_ONEOF_FIELD_OFFSET(Request_Runtime_default_oneof_instance_, stop_recording_),
+    PROTO2_GENERATED_DEFAULT_ONEOF_FIELD_OFFSET(Request_Runtime_default_oneof_instance_, dump_flight_recorder_),
+    PROTO2_GENERATED_DEFAULT_ONEOF_FIELD_OFFSET(Request_Runtime_default_oneof_instance_, channel_subscribe_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request_Runtime, content_),
   };
   Request_Runtime_reflection_ =
@@ -416,6 +437,37 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(Request_Runtime_StopRecording));
+  Request_Runtime_DumpFlightRecorder_descriptor_ = Request_Runtime_descriptor_->nested_type(4);
+  static const int Request_Runtime_DumpFlightRecorder_offsets_[1] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request_Runtime_DumpFlightRecorder, tag_),
+  };
+  Request_Runtime_DumpFlightRecorder_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      Request_Runtime_DumpFlightRecorder_descriptor_,
+      Request_Runtime_DumpFlightRecorder::default_instance_,
+      Request_Runtime_DumpFlightRecorder_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request_Runtime_DumpFlightRecorder, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request_Runtime_DumpFlightRecorder, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(Request_Runtime_DumpFlightRecorder));
+  Request_Runtime_ChannelSubscribe_descriptor_ = Request_Runtime_descriptor_->nested_type(5);
+  static const int Request_Runtime_ChannelSubscribe_offsets_[2] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request_Runtime_ChannelSubscribe, channels_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request_Runtime_ChannelSubscribe, sample_rate_),
+  };
+  Request_Runtime_ChannelSubscribe_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      Request_Runtime_ChannelSubscribe_descriptor_,
+      Request_Runtime_ChannelSubscribe::default_instance_,
+      Request_Runtime_ChannelSubscribe_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request_Runtime_ChannelSubscribe, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request_Runtime_ChannelSubscribe, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(Request_Runtime_ChannelSubscribe));
   Request_Stdin_descriptor_ = Request_descriptor_->nested_type(11);
   static const int Request_Stdin_offsets_[1] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request_Stdin, buffer_),
@@ -432,13 +484,15 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(Request_Stdin));
   Response_descriptor_ = file->message_type(1);
-  static const int Response_offsets_[7] = {
+  static const int Response_offsets_[9] = {
     PROTO2_GENERATED_DEFAULT_ONEOF_FIELD_OFFSET(Response_default_oneof_instance_, info_),
     PROTO2_GENERATED_DEFAULT_ONEOF_FIELD_OFFSET(Response_default_oneof_instance_, client_list_),
     PROTO2_GENERATED_DEFAULT_ONEOF_FIELD_OFFSET(Response_default_oneof_instance_, process_list_),
     PROTO2_GENERATED_DEFAULT_ONEOF_FIELD_OFFSET(Response_default_oneof_instance_, module_list_),
     PROTO2_GENERATED_DEFAULT_ONEOF_FIELD_OFFSET(Response_default_oneof_instance_, log_event_),
     PROTO2_GENERATED_DEFAULT_ONEOF_FIELD_OFFSET(Response_default_oneof_instance_, profiling_summary_),
+    PROTO2_GENERATED_DEFAULT_ONEOF_FIELD_OFFSET(Response_default_oneof_instance_, log_event_batch_),
+    PROTO2_GENERATED_DEFAULT_ONEOF_FIELD_OFFSET(Response_default_oneof_instance_, channel_snapshot_),
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response, content_),
   };
   Response_reflection_ =
@@ -602,7 +656,24 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(Response_LogEvent));
   Response_LogEvent_Level_descriptor_ = Response_LogEvent_descriptor_->enum_type(0);
-  Response_ProfilingSummary_descriptor_ = Response_descriptor_->nested_type(5);
+  Response_LogEventBatch_descriptor_ = Response_descriptor_->nested_type(5);
+  static const int Response_LogEventBatch_offsets_[3] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response_LogEventBatch, events_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response_LogEventBatch, min_level_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response_LogEventBatch, max_level_),
+  };
+  Response_LogEventBatch_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      Response_LogEventBatch_descriptor_,
+      Response_LogEventBatch::default_instance_,
+      Response_LogEventBatch_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response_LogEventBatch, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response_LogEventBatch, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(Response_LogEventBatch));
+  Response_ProfilingSummary_descriptor_ = Response_descriptor_->nested_type(6);
   static const int Response_ProfilingSummary_offsets_[1] = {
     GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response_ProfilingSummary, traces_),
   };
@@ -638,6 +709,40 @@ void protobuf_AssignDesc_messages_2eproto() {
       ::google::protobuf::DescriptorPool::generated_pool(),
       ::google::protobuf::MessageFactory::generated_factory(),
       sizeof(Response_ProfilingSummary_Trace));
+  Response_ChannelSnapshot_descriptor_ = Response_descriptor_->nested_type(7);
+  static const int Response_ChannelSnapshot_offsets_[3] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response_ChannelSnapshot, cycle_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response_ChannelSnapshot, timestamp_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response_ChannelSnapshot, channels_),
+  };
+  Response_ChannelSnapshot_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      Response_ChannelSnapshot_descriptor_,
+      Response_ChannelSnapshot::default_instance_,
+      Response_ChannelSnapshot_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response_ChannelSnapshot, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response_ChannelSnapshot, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(Response_ChannelSnapshot));
+  Response_ChannelSnapshot_Channel_descriptor_ = Response_ChannelSnapshot_descriptor_->nested_type(0);
+  static const int Response_ChannelSnapshot_Channel_offsets_[3] = {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response_ChannelSnapshot_Channel, name_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response_ChannelSnapshot_Channel, type_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response_ChannelSnapshot_Channel, data_),
+  };
+  Response_ChannelSnapshot_Channel_reflection_ =
+    new ::google::protobuf::internal::GeneratedMessageReflection(
+      Response_ChannelSnapshot_Channel_descriptor_,
+      Response_ChannelSnapshot_Channel::default_instance_,
+      Response_ChannelSnapshot_Channel_offsets_,
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response_ChannelSnapshot_Channel, _has_bits_[0]),
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response_ChannelSnapshot_Channel, _unknown_fields_),
+      -1,
+      ::google::protobuf::DescriptorPool::generated_pool(),
+      ::google::protobuf::MessageFactory::generated_factory(),
+      sizeof(Response_ChannelSnapshot_Channel));
 }
 
 namespace {
@@ -682,6 +787,10 @@ void protobuf_RegisterTypes(const ::std::string&) {
     Request_Runtime_StartRecording_descriptor_, &Request_Runtime_StartRecording::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     Request_Runtime_StopRecording_descriptor_, &Request_Runtime_StopRecording::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    Request_Runtime_DumpFlightRecorder_descriptor_, &Request_Runtime_DumpFlightRecorder::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    Request_Runtime_ChannelSubscribe_descriptor_, &Request_Runtime_ChannelSubscribe::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     Request_Stdin_descriptor_, &Request_Stdin::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
@@ -704,10 +813,16 @@ void protobuf_RegisterTypes(const ::std::string&) {
     Response_ModuleListResponse_Channel_descriptor_, &Response_ModuleListResponse_Channel::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     Response_LogEvent_descriptor_, &Response_LogEvent::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    Response_LogEventBatch_descriptor_, &Response_LogEventBatch::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     Response_ProfilingSummary_descriptor_, &Response_ProfilingSummary::default_instance());
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
     Response_ProfilingSummary_Trace_descriptor_, &Response_ProfilingSummary_Trace::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    Response_ChannelSnapshot_descriptor_, &Response_ChannelSnapshot::default_instance());
+  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
+    Response_ChannelSnapshot_Channel_descriptor_, &Response_ChannelSnapshot_Channel::default_instance());
 }
 
 }  // namespace
@@ -747,6 +862,10 @@ void protobuf_ShutdownFile_messages_2eproto() {
   delete Request_Runtime_StartRecording_reflection_;
   delete Request_Runtime_StopRecording::default_instance_;
   delete Request_Runtime_StopRecording_reflection_;
+  delete Request_Runtime_DumpFlightRecorder::default_instance_;
+  delete Request_Runtime_DumpFlightRecorder_reflection_;
+  delete Request_Runtime_ChannelSubscribe::default_instance_;
+  delete Request_Runtime_ChannelSubscribe_reflection_;
   delete Request_Stdin::default_instance_;
   delete Request_Stdin_reflection_;
   delete Response::default_instance_;
@@ -770,10 +889,16 @@ void protobuf_ShutdownFile_messages_2eproto() {
   delete Response_ModuleListResponse_Channel_reflection_;
   delete Response_LogEvent::default_instance_;
   delete Response_LogEvent_reflection_;
+  delete Response_LogEventBatch::default_instance_;
+  delete Response_LogEventBatch_reflection_;
   delete Response_ProfilingSummary::default_instance_;
   delete Response_ProfilingSummary_reflection_;
   delete Response_ProfilingSummary_Trace::default_instance_;
   delete Response_ProfilingSummary_Trace_reflection_;
+  delete Response_ChannelSnapshot::default_instance_;
+  delete Response_ChannelSnapshot_reflection_;
+  delete Response_ChannelSnapshot_Channel::default_instance_;
+  delete Response_ChannelSnapshot_Channel_reflection_;
 }
 
 void protobuf_AddDesc_messages_2eproto() {
@@ -783,7 +908,7 @@ void protobuf_AddDesc_messages_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
   ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\016messages.proto\022\003lms\"\224\014\n\007Request\022!\n\004inf"
+    "\n\016messages.proto\022\003lms\"\203\016\n\007Request\022!\n\004inf"
     "o\030\001 \001(\0132\021.lms.Request.InfoH\000\022)\n\010shutdown"
     "\030\002 \001(\0132\025.lms.Request.ShutdownH\000\0220\n\014list_"
     "clients\030\003 \001(\0132\030.lms.Request.ListClientsH"
@@ -810,52 +935,68 @@ void protobuf_AddDesc_messages_2eproto() {
     "og_level\030\002 \001(\0162\034.lms.Response.LogEvent.L"
     "evel:\003ALL\032\"\n\004Stop\022\014\n\004name\030\001 \001(\t\022\014\n\004kill\030"
     "\002 \001(\010\032\014\n\nModuleList\032\'\n\025ListenBroadcastEv"
-    "ents\022\016\n\006enable\030\001 \001(\010\032\010\n\006Detach\032\257\003\n\007Runti"
+    "ents\022\016\n\006enable\030\001 \001(\010\032\010\n\006Detach\032\236\005\n\007Runti"
     "me\022\014\n\004name\030\001 \001(\t\0220\n\006filter\030\002 \001(\0132\036.lms.R"
     "equest.Runtime.LogFilterH\000\0223\n\tprofiling\030"
     "\003 \001(\0132\036.lms.Request.Runtime.ProfilingH\000\022"
     ">\n\017start_recording\030\004 \001(\0132#.lms.Request.R"
     "untime.StartRecordingH\000\022<\n\016stop_recordin"
     "g\030\005 \001(\0132\".lms.Request.Runtime.StopRecord"
-    "ingH\000\032A\n\tLogFilter\0224\n\tlog_level\030\001 \001(\0162\034."
-    "lms.Response.LogEvent.Level:\003ALL\032!\n\tProf"
-    "iling\022\024\n\005reset\030\001 \001(\010:\005false\032\"\n\016StartReco"
-    "rding\022\020\n\010channels\030\001 \003(\t\032\034\n\rStopRecording"
-    "\022\013\n\003tag\030\001 \001(\tB\t\n\007content\032\027\n\005Stdin\022\016\n\006buf"
-    "fer\030\001 \001(\014B\t\n\007content\"\227\n\n\010Response\022\"\n\004inf"
-    "o\030\001 \001(\0132\022.lms.Response.InfoH\000\022/\n\013client_"
-    "list\030\002 \001(\0132\030.lms.Response.ClientListH\000\0221"
-    "\n\014process_list\030\003 \001(\0132\031.lms.Response.Proc"
-    "essListH\000\0227\n\013module_list\030\004 \001(\0132 .lms.Res"
-    "ponse.ModuleListResponseH\000\022+\n\tlog_event\030"
-    "\005 \001(\0132\026.lms.Response.LogEventH\000\022;\n\021profi"
-    "ling_summary\030\006 \001(\0132\036.lms.Response.Profil"
-    "ingSummaryH\000\032$\n\004Info\022\017\n\007version\030\001 \001(\005\022\013\n"
-    "\003pid\030\002 \001(\005\032b\n\nClientList\0220\n\007clients\030\001 \003("
-    "\0132\037.lms.Response.ClientList.Client\032\"\n\006Cl"
-    "ient\022\n\n\002fd\030\001 \001(\005\022\014\n\004peer\030\002 \001(\t\032~\n\013Proces"
-    "sList\0224\n\tprocesses\030\001 \003(\0132!.lms.Response."
-    "ProcessList.Process\0329\n\007Process\022\013\n\003pid\030\001 "
-    "\001(\005\022\023\n\013config_file\030\002 \001(\t\022\014\n\004name\030\003 \001(\t\032\267"
-    "\002\n\022ModuleListResponse\022:\n\010channels\030\001 \003(\0132"
-    "(.lms.Response.ModuleListResponse.Channe"
-    "l\032k\n\006Access\022\016\n\006module\030\001 \001(\t\022\?\n\npermissio"
-    "n\030\002 \001(\0162+.lms.Response.ModuleListRespons"
-    "e.Permission\022\020\n\010priority\030\003 \001(\005\032U\n\007Channe"
-    "l\022\014\n\004name\030\001 \001(\t\022<\n\013access_list\030\002 \003(\0132\'.l"
-    "ms.Response.ModuleListResponse.Access\"!\n"
-    "\nPermission\022\010\n\004READ\020\001\022\t\n\005WRITE\020\002\032\324\001\n\010Log"
-    "Event\022+\n\005level\030\001 \001(\0162\034.lms.Response.LogE"
-    "vent.Level\022\013\n\003tag\030\002 \001(\t\022\014\n\004text\030\003 \001(\t\022\032\n"
-    "\013close_after\030\004 \001(\010:\005false\022\021\n\ttimestamp\030\005"
-    " \001(\003\"Q\n\005Level\022\007\n\003ALL\020\000\022\013\n\007PROFILE\020\n\022\t\n\005D"
-    "EBUG\020\024\022\010\n\004INFO\020\036\022\010\n\004WARN\020(\022\t\n\005ERROR\0202\022\010\n"
-    "\003OFF\020\377\001\032\271\001\n\020ProfilingSummary\0224\n\006traces\030\001"
-    " \003(\0132$.lms.Response.ProfilingSummary.Tra"
-    "ce\032o\n\005Trace\022\014\n\004name\030\001 \001(\t\022\013\n\003avg\030\002 \001(\005\022\013"
-    "\n\003std\030\003 \001(\005\022\013\n\003max\030\004 \001(\005\022\r\n\005count\030\005 \001(\005\022"
-    "\013\n\003min\030\006 \001(\005\022\025\n\rrunning_since\030\007 \001(\005B\t\n\007c"
-    "ontent", 2886);
+    "ingH\000\022G\n\024dump_flight_recorder\030\006 \001(\0132\'.lm"
+    "s.Request.Runtime.DumpFlightRecorderH\000\022B"
+    "\n\021channel_subscribe\030\007 \001(\0132%.lms.Request."
+    "Runtime.ChannelSubscribeH\000\032A\n\tLogFilter\022"
+    "4\n\tlog_level\030\001 \001(\0162\034.lms.Response.LogEve"
+    "nt.Level:\003ALL\032!\n\tProfiling\022\024\n\005reset\030\001 \001("
+    "\010:\005false\032\"\n\016StartRecording\022\020\n\010channels\030\001"
+    " \003(\t\032\034\n\rStopRecording\022\013\n\003tag\030\001 \001(\t\032!\n\022Du"
+    "mpFlightRecorder\022\013\n\003tag\030\001 \001(\t\032=\n\020Channel"
+    "Subscribe\022\020\n\010channels\030\001 \003(\t\022\027\n\013sample_ra"
+    "te\030\002 \001(\002:\00210B\t\n\007content\032\027\n\005Stdin\022\016\n\006buff"
+    "er\030\001 \001(\014B\t\n\007content\"\312\r\n\010Response\022\"\n\004info"
+    "\030\001 \001(\0132\022.lms.Response.InfoH\000\022/\n\013client_l"
+    "ist\030\002 \001(\0132\030.lms.Response.ClientListH\000\0221\n"
+    "\014process_list\030\003 \001(\0132\031.lms.Response.Proce"
+    "ssListH\000\0227\n\013module_list\030\004 \001(\0132 .lms.Resp"
+    "onse.ModuleListResponseH\000\022+\n\tlog_event\030\005"
+    " \001(\0132\026.lms.Response.LogEventH\000\022;\n\021profil"
+    "ing_summary\030\006 \001(\0132\036.lms.Response.Profili"
+    "ngSummaryH\000\0226\n\017log_event_batch\030\007 \001(\0132\033.l"
+    "ms.Response.LogEventBatchH\000\0229\n\020channel_s"
+    "napshot\030\010 \001(\0132\035.lms.Response.ChannelSnap"
+    "shotH\000\032$\n\004Info\022\017\n\007version\030\001 \001(\005\022\013\n\003pid\030\002"
+    " \001(\005\032b\n\nClientList\0220\n\007clients\030\001 \003(\0132\037.lm"
+    "s.Response.ClientList.Client\032\"\n\006Client\022\n"
+    "\n\002fd\030\001 \001(\005\022\014\n\004peer\030\002 \001(\t\032~\n\013ProcessList\022"
+    "4\n\tprocesses\030\001 \003(\0132!.lms.Response.Proces"
+    "sList.Process\0329\n\007Process\022\013\n\003pid\030\001 \001(\005\022\023\n"
+    "\013config_file\030\002 \001(\t\022\014\n\004name\030\003 \001(\t\032\267\002\n\022Mod"
+    "uleListResponse\022:\n\010channels\030\001 \003(\0132(.lms."
+    "Response.ModuleListResponse.Channel\032k\n\006A"
+    "ccess\022\016\n\006module\030\001 \001(\t\022\?\n\npermission\030\002 \001("
+    "\0162+.lms.Response.ModuleListResponse.Perm"
+    "ission\022\020\n\010priority\030\003 \001(\005\032U\n\007Channel\022\014\n\004n"
+    "ame\030\001 \001(\t\022<\n\013access_list\030\002 \003(\0132\'.lms.Res"
+    "ponse.ModuleListResponse.Access\"!\n\nPermi"
+    "ssion\022\010\n\004READ\020\001\022\t\n\005WRITE\020\002\032\324\001\n\010LogEvent\022"
+    "+\n\005level\030\001 \001(\0162\034.lms.Response.LogEvent.L"
+    "evel\022\013\n\003tag\030\002 \001(\t\022\014\n\004text\030\003 \001(\t\022\032\n\013close"
+    "_after\030\004 \001(\010:\005false\022\021\n\ttimestamp\030\005 \001(\003\"Q"
+    "\n\005Level\022\007\n\003ALL\020\000\022\013\n\007PROFILE\020\n\022\t\n\005DEBUG\020\024"
+    "\022\010\n\004INFO\020\036\022\010\n\004WARN\020(\022\t\n\005ERROR\0202\022\010\n\003OFF\020\377"
+    "\001\032\231\001\n\rLogEventBatch\022&\n\006events\030\001 \003(\0132\026.lm"
+    "s.Response.LogEvent\022/\n\tmin_level\030\002 \001(\0162\034"
+    ".lms.Response.LogEvent.Level\022/\n\tmax_leve"
+    "l\030\003 \001(\0162\034.lms.Response.LogEvent.Level\032\271\001"
+    "\n\020ProfilingSummary\0224\n\006traces\030\001 \003(\0132$.lms"
+    ".Response.ProfilingSummary.Trace\032o\n\005Trac"
+    "e\022\014\n\004name\030\001 \001(\t\022\013\n\003avg\030\002 \001(\005\022\013\n\003std\030\003 \001("
+    "\005\022\013\n\003max\030\004 \001(\005\022\r\n\005count\030\005 \001(\005\022\013\n\003min\030\006 \001"
+    "(\005\022\025\n\rrunning_since\030\007 \001(\005\032\241\001\n\017ChannelSna"
+    "pshot\022\r\n\005cycle\030\001 \001(\005\022\021\n\ttimestamp\030\002 \001(\003\022"
+    "7\n\010channels\030\003 \003(\0132%.lms.Response.Channel"
+    "Snapshot.Channel\0323\n\007Channel\022\014\n\004name\030\001 \001("
+    "\t\022\014\n\004type\030\002 \001(\t\022\014\n\004data\030\003 \001(\014B\t\n\007content", 3560);
   ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
     "messages.proto", &protobuf_RegisterTypes);
   Request::default_instance_ = new Request();
@@ -876,6 +1017,8 @@ void protobuf_AddDesc_messages_2eproto() {
   Request_Runtime_Profiling::default_instance_ = new Request_Runtime_Profiling();
   Request_Runtime_StartRecording::default_instance_ = new Request_Runtime_StartRecording();
   Request_Runtime_StopRecording::default_instance_ = new Request_Runtime_StopRecording();
+  Request_Runtime_DumpFlightRecorder::default_instance_ = new Request_Runtime_DumpFlightRecorder();
+  Request_Runtime_ChannelSubscribe::default_instance_ = new Request_Runtime_ChannelSubscribe();
   Request_Stdin::default_instance_ = new Request_Stdin();
   Response::default_instance_ = new Response();
   Response_default_oneof_instance_ = new ResponseOneofInstance;
@@ -888,8 +1031,11 @@ void protobuf_AddDesc_messages_2eproto() {
   Response_ModuleListResponse_Access::default_instance_ = new Response_ModuleListResponse_Access();
   Response_ModuleListResponse_Channel::default_instance_ = new Response_ModuleListResponse_Channel();
   Response_LogEvent::default_instance_ = new Response_LogEvent();
+  Response_LogEventBatch::default_instance_ = new Response_LogEventBatch();
   Response_ProfilingSummary::default_instance_ = new Response_ProfilingSummary();
   Response_ProfilingSummary_Trace::default_instance_ = new Response_ProfilingSummary_Trace();
+  Response_ChannelSnapshot::default_instance_ = new Response_ChannelSnapshot();
+  Response_ChannelSnapshot_Channel::default_instance_ = new Response_ChannelSnapshot_Channel();
   Request::default_instance_->InitAsDefaultInstance();
   Request_Info::default_instance_->InitAsDefaultInstance();
   Request_Shutdown::default_instance_->InitAsDefaultInstance();
@@ -906,6 +1052,8 @@ void protobuf_AddDesc_messages_2eproto() {
   Request_Runtime_Profiling::default_instance_->InitAsDefaultInstance();
   Request_Runtime_StartRecording::default_instance_->InitAsDefaultInstance();
   Request_Runtime_StopRecording::default_instance_->InitAsDefaultInstance();
+  Request_Runtime_DumpFlightRecorder::default_instance_->InitAsDefaultInstance();
+  Request_Runtime_ChannelSubscribe::default_instance_->InitAsDefaultInstance();
   Request_Stdin::default_instance_->InitAsDefaultInstance();
   Response::default_instance_->InitAsDefaultInstance();
   Response_Info::default_instance_->InitAsDefaultInstance();
@@ -917,8 +1065,11 @@ void protobuf_AddDesc_messages_2eproto() {
   Response_ModuleListResponse_Access::default_instance_->InitAsDefaultInstance();
   Response_ModuleListResponse_Channel::default_instance_->InitAsDefaultInstance();
   Response_LogEvent::default_instance_->InitAsDefaultInstance();
+  Response_LogEventBatch::default_instance_->InitAsDefaultInstance();
   Response_ProfilingSummary::default_instance_->InitAsDefaultInstance();
   Response_ProfilingSummary_Trace::default_instance_->InitAsDefaultInstance();
+  Response_ChannelSnapshot::default_instance_->InitAsDefaultInstance();
+  Response_ChannelSnapshot_Channel::default_instance_->InitAsDefaultInstance();
   ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_messages_2eproto);
 }
 
@@ -4510,186 +4661,95 @@ void Request_Runtime_StopRecording::Swap(Request_Runtime_StopRecording* other) {
 // -------------------------------------------------------------------
 
 #ifndef _MSC_VER
-const int Request_Runtime::kNameFieldNumber;
-const int Request_Runtime::kFilterFieldNumber;
-const int Request_Runtime::kProfilingFieldNumber;
-const int Request_Runtime::kStartRecordingFieldNumber;
-const int Request_Runtime::kStopRecordingFieldNumber;
+const int Request_Runtime_DumpFlightRecorder::kTagFieldNumber;
 #endif  // !_MSC_VER
 
-Request_Runtime::Request_Runtime()
+Request_Runtime_DumpFlightRecorder::Request_Runtime_DumpFlightRecorder()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:lms.Request.Runtime)
+  // @@protoc_insertion_point(constructor:lms.Request.Runtime.DumpFlightRecorder)
 }
 
-void Request_Runtime::InitAsDefaultInstance() {
-  Request_Runtime_default_oneof_instance_->filter_ = const_cast< ::lms::Request_Runtime_LogFilter*>(&::lms::Request_Runtime_LogFilter::default_instance());
-  Request_Runtime_default_oneof_instance_->profiling_ = const_cast< ::lms::Request_Runtime_Profiling*>(&::lms::Request_Runtime_Profiling::default_instance());
-  Request_Runtime_default_oneof_instance_->start_recording_ = const_cast< ::lms::Request_Runtime_StartRecording*>(&::lms::Request_Runtime_StartRecording::default_instance());
-  Request_Runtime_default_oneof_instance_->stop_recording_ = const_cast< ::lms::Request_Runtime_StopRecording*>(&::lms::Request_Runtime_StopRecording::default_instance());
+void Request_Runtime_DumpFlightRecorder::InitAsDefaultInstance() {
 }
 
-Request_Runtime::Request_Runtime(const Request_Runtime& from)
+Request_Runtime_DumpFlightRecorder::Request_Runtime_DumpFlightRecorder(const Request_Runtime_DumpFlightRecorder& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:lms.Request.Runtime)
+  // @@protoc_insertion_point(copy_constructor:lms.Request.Runtime.DumpFlightRecorder)
 }
 
-void Request_Runtime::SharedCtor() {
+void Request_Runtime_DumpFlightRecorder::SharedCtor() {
   ::google::protobuf::internal::GetEmptyString();
   _cached_size_ = 0;
-  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  tag_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  clear_has_content();
 }
 
-Request_Runtime::~Request_Runtime() {
-  // @@protoc_insertion_point(destructor:lms.Request.Runtime)
+Request_Runtime_DumpFlightRecorder::~Request_Runtime_DumpFlightRecorder() {
+  // @@protoc_insertion_point(destructor:lms.Request.Runtime.DumpFlightRecorder)
   SharedDtor();
 }
 
-void Request_Runtime::SharedDtor() {
-  if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete name_;
-  }
-  if (has_content()) {
-    clear_content();
+void Request_Runtime_DumpFlightRecorder::SharedDtor() {
+  if (tag_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete tag_;
   }
   if (this != default_instance_) {
   }
 }
 
-void Request_Runtime::SetCachedSize(int size) const {
+void Request_Runtime_DumpFlightRecorder::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* Request_Runtime::descriptor() {
+const ::google::protobuf::Descriptor* Request_Runtime_DumpFlightRecorder::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return Request_Runtime_descriptor_;
+  return Request_Runtime_DumpFlightRecorder_descriptor_;
 }
 
-const Request_Runtime& Request_Runtime::default_instance() {
+const Request_Runtime_DumpFlightRecorder& Request_Runtime_DumpFlightRecorder::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_messages_2eproto();
   return *default_instance_;
 }
 
-Request_Runtime* Request_Runtime::default_instance_ = NULL;
-
-Request_Runtime* Request_Runtime::New() const {
-  return new Request_Runtime;
-}
+Request_Runtime_DumpFlightRecorder* Request_Runtime_DumpFlightRecorder::default_instance_ = NULL;
 
-void Request_Runtime::clear_content() {
-  switch(content_case()) {
-    case kFilter: {
-      delete content_.filter_;
-      break;
-    }
-    case kProfiling: {
-      delete content_.profiling_;
-      break;
-    }
-    case kStartRecording: {
-      delete content_.start_recording_;
-      break;
-    }
-    case kStopRecording: {
-      delete content_.stop_recording_;
-      break;
-    }
-    case CONTENT_NOT_SET: {
-      break;
-    }
-  }
-  _oneof_case_[0] = CONTENT_NOT_SET;
+Request_Runtime_DumpFlightRecorder* Request_Runtime_DumpFlightRecorder::New() const {
+  return new Request_Runtime_DumpFlightRecorder;
 }
 
-
-void Request_Runtime::Clear() {
-  if (has_name()) {
-    if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-      name_->clear();
+void Request_Runtime_DumpFlightRecorder::Clear() {
+  if (has_tag()) {
+    if (tag_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+      tag_->clear();
     }
   }
-  clear_content();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool Request_Runtime::MergePartialFromCodedStream(
+bool Request_Runtime_DumpFlightRecorder::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:lms.Request.Runtime)
+  // @@protoc_insertion_point(parse_start:lms.Request.Runtime.DumpFlightRecorder)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional string name = 1;
+      // optional string tag = 1;
       case 1: {
         if (tag == 10) {
           DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
+                input, this->mutable_tag()));
           ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->name().data(), this->name().length(),
+            this->tag().data(), this->tag().length(),
             ::google::protobuf::internal::WireFormat::PARSE,
-            "name");
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(18)) goto parse_filter;
-        break;
-      }
-
-      // optional .lms.Request.Runtime.LogFilter filter = 2;
-      case 2: {
-        if (tag == 18) {
-         parse_filter:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_filter()));
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(26)) goto parse_profiling;
-        break;
-      }
-
-      // optional .lms.Request.Runtime.Profiling profiling = 3;
-      case 3: {
-        if (tag == 26) {
-         parse_profiling:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_profiling()));
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(34)) goto parse_start_recording;
-        break;
-      }
-
-      // optional .lms.Request.Runtime.StartRecording start_recording = 4;
-      case 4: {
-        if (tag == 34) {
-         parse_start_recording:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_start_recording()));
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(42)) goto parse_stop_recording;
-        break;
-      }
-
-      // optional .lms.Request.Runtime.StopRecording stop_recording = 5;
-      case 5: {
-        if (tag == 42) {
-         parse_stop_recording:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_stop_recording()));
+            "tag");
         } else {
           goto handle_unusual;
         }
@@ -4711,153 +4771,68 @@ bool Request_Runtime::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:lms.Request.Runtime)
+  // @@protoc_insertion_point(parse_success:lms.Request.Runtime.DumpFlightRecorder)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:lms.Request.Runtime)
+  // @@protoc_insertion_point(parse_failure:lms.Request.Runtime.DumpFlightRecorder)
   return false;
 #undef DO_
 }
 
-void Request_Runtime::SerializeWithCachedSizes(
+void Request_Runtime_DumpFlightRecorder::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:lms.Request.Runtime)
-  // optional string name = 1;
-  if (has_name()) {
+  // @@protoc_insertion_point(serialize_start:lms.Request.Runtime.DumpFlightRecorder)
+  // optional string tag = 1;
+  if (has_tag()) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->name().data(), this->name().length(),
+      this->tag().data(), this->tag().length(),
       ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "name");
+      "tag");
     ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->name(), output);
-  }
-
-  // optional .lms.Request.Runtime.LogFilter filter = 2;
-  if (has_filter()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->filter(), output);
-  }
-
-  // optional .lms.Request.Runtime.Profiling profiling = 3;
-  if (has_profiling()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->profiling(), output);
-  }
-
-  // optional .lms.Request.Runtime.StartRecording start_recording = 4;
-  if (has_start_recording()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->start_recording(), output);
-  }
-
-  // optional .lms.Request.Runtime.StopRecording stop_recording = 5;
-  if (has_stop_recording()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->stop_recording(), output);
+      1, this->tag(), output);
   }
 
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:lms.Request.Runtime)
+  // @@protoc_insertion_point(serialize_end:lms.Request.Runtime.DumpFlightRecorder)
 }
 
-::google::protobuf::uint8* Request_Runtime::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* Request_Runtime_DumpFlightRecorder::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:lms.Request.Runtime)
-  // optional string name = 1;
-  if (has_name()) {
+  // @@protoc_insertion_point(serialize_to_array_start:lms.Request.Runtime.DumpFlightRecorder)
+  // optional string tag = 1;
+  if (has_tag()) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->name().data(), this->name().length(),
+      this->tag().data(), this->tag().length(),
       ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "name");
+      "tag");
     target =
       ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
-  }
-
-  // optional .lms.Request.Runtime.LogFilter filter = 2;
-  if (has_filter()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->filter(), target);
-  }
-
-  // optional .lms.Request.Runtime.Profiling profiling = 3;
-  if (has_profiling()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->profiling(), target);
-  }
-
-  // optional .lms.Request.Runtime.StartRecording start_recording = 4;
-  if (has_start_recording()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        4, this->start_recording(), target);
-  }
-
-  // optional .lms.Request.Runtime.StopRecording stop_recording = 5;
-  if (has_stop_recording()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        5, this->stop_recording(), target);
+        1, this->tag(), target);
   }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:lms.Request.Runtime)
+  // @@protoc_insertion_point(serialize_to_array_end:lms.Request.Runtime.DumpFlightRecorder)
   return target;
 }
 
-int Request_Runtime::ByteSize() const {
+int Request_Runtime_DumpFlightRecorder::ByteSize() const {
   int total_size = 0;
 
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional string name = 1;
-    if (has_name()) {
+    // optional string tag = 1;
+    if (has_tag()) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->name());
+          this->tag());
     }
 
   }
-  switch (content_case()) {
-    // optional .lms.Request.Runtime.LogFilter filter = 2;
-    case kFilter: {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->filter());
-      break;
-    }
-    // optional .lms.Request.Runtime.Profiling profiling = 3;
-    case kProfiling: {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->profiling());
-      break;
-    }
-    // optional .lms.Request.Runtime.StartRecording start_recording = 4;
-    case kStartRecording: {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->start_recording());
-      break;
-    }
-    // optional .lms.Request.Runtime.StopRecording stop_recording = 5;
-    case kStopRecording: {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->stop_recording());
-      break;
-    }
-    case CONTENT_NOT_SET: {
-      break;
-    }
-  }
   if (!unknown_fields().empty()) {
     total_size +=
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
@@ -4869,10 +4844,10 @@ int Request_Runtime::ByteSize() const {
   return total_size;
 }
 
-void Request_Runtime::MergeFrom(const ::google::protobuf::Message& from) {
+void Request_Runtime_DumpFlightRecorder::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const Request_Runtime* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Request_Runtime*>(
+  const Request_Runtime_DumpFlightRecorder* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Request_Runtime_DumpFlightRecorder*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -4881,70 +4856,47 @@ void Request_Runtime::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void Request_Runtime::MergeFrom(const Request_Runtime& from) {
+void Request_Runtime_DumpFlightRecorder::MergeFrom(const Request_Runtime_DumpFlightRecorder& from) {
   GOOGLE_CHECK_NE(&from, this);
-  switch (from.content_case()) {
-    case kFilter: {
-      mutable_filter()->::lms::Request_Runtime_LogFilter::MergeFrom(from.filter());
-      break;
-    }
-    case kProfiling: {
-      mutable_profiling()->::lms::Request_Runtime_Profiling::MergeFrom(from.profiling());
-      break;
-    }
-    case kStartRecording: {
-      mutable_start_recording()->::lms::Request_Runtime_StartRecording::MergeFrom(from.start_recording());
-      break;
-    }
-    case kStopRecording: {
-      mutable_stop_recording()->::lms::Request_Runtime_StopRecording::MergeFrom(from.stop_recording());
-      break;
-    }
-    case CONTENT_NOT_SET: {
-      break;
-    }
-  }
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_name()) {
-      set_name(from.name());
+    if (from.has_tag()) {
+      set_tag(from.tag());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void Request_Runtime::CopyFrom(const ::google::protobuf::Message& from) {
+void Request_Runtime_DumpFlightRecorder::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Request_Runtime::CopyFrom(const Request_Runtime& from) {
+void Request_Runtime_DumpFlightRecorder::CopyFrom(const Request_Runtime_DumpFlightRecorder& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Request_Runtime::IsInitialized() const {
+bool Request_Runtime_DumpFlightRecorder::IsInitialized() const {
 
   return true;
 }
 
-void Request_Runtime::Swap(Request_Runtime* other) {
+void Request_Runtime_DumpFlightRecorder::Swap(Request_Runtime_DumpFlightRecorder* other) {
   if (other != this) {
-    std::swap(name_, other->name_);
-    std::swap(content_, other->content_);
-    std::swap(_oneof_case_[0], other->_oneof_case_[0]);
+    std::swap(tag_, other->tag_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata Request_Runtime::GetMetadata() const {
+::google::protobuf::Metadata Request_Runtime_DumpFlightRecorder::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Request_Runtime_descriptor_;
-  metadata.reflection = Request_Runtime_reflection_;
+  metadata.descriptor = Request_Runtime_DumpFlightRecorder_descriptor_;
+  metadata.reflection = Request_Runtime_DumpFlightRecorder_reflection_;
   return metadata;
 }
 
@@ -4952,91 +4904,108 @@ void Request_Runtime::Swap(Request_Runtime* other) {
 // -------------------------------------------------------------------
 
 #ifndef _MSC_VER
-const int Request_Stdin::kBufferFieldNumber;
+const int Request_Runtime_ChannelSubscribe::kChannelsFieldNumber;
+const int Request_Runtime_ChannelSubscribe::kSampleRateFieldNumber;
 #endif  // !_MSC_VER
 
-Request_Stdin::Request_Stdin()
+Request_Runtime_ChannelSubscribe::Request_Runtime_ChannelSubscribe()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:lms.Request.Stdin)
+  // @@protoc_insertion_point(constructor:lms.Request.Runtime.ChannelSubscribe)
 }
 
-void Request_Stdin::InitAsDefaultInstance() {
+void Request_Runtime_ChannelSubscribe::InitAsDefaultInstance() {
 }
 
-Request_Stdin::Request_Stdin(const Request_Stdin& from)
+Request_Runtime_ChannelSubscribe::Request_Runtime_ChannelSubscribe(const Request_Runtime_ChannelSubscribe& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:lms.Request.Stdin)
+  // @@protoc_insertion_point(copy_constructor:lms.Request.Runtime.ChannelSubscribe)
 }
 
-void Request_Stdin::SharedCtor() {
+void Request_Runtime_ChannelSubscribe::SharedCtor() {
   ::google::protobuf::internal::GetEmptyString();
   _cached_size_ = 0;
-  buffer_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  sample_rate_ = 10;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-Request_Stdin::~Request_Stdin() {
-  // @@protoc_insertion_point(destructor:lms.Request.Stdin)
+Request_Runtime_ChannelSubscribe::~Request_Runtime_ChannelSubscribe() {
+  // @@protoc_insertion_point(destructor:lms.Request.Runtime.ChannelSubscribe)
   SharedDtor();
 }
 
-void Request_Stdin::SharedDtor() {
-  if (buffer_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete buffer_;
-  }
+void Request_Runtime_ChannelSubscribe::SharedDtor() {
   if (this != default_instance_) {
   }
 }
 
-void Request_Stdin::SetCachedSize(int size) const {
+void Request_Runtime_ChannelSubscribe::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* Request_Stdin::descriptor() {
+const ::google::protobuf::Descriptor* Request_Runtime_ChannelSubscribe::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return Request_Stdin_descriptor_;
+  return Request_Runtime_ChannelSubscribe_descriptor_;
 }
 
-const Request_Stdin& Request_Stdin::default_instance() {
+const Request_Runtime_ChannelSubscribe& Request_Runtime_ChannelSubscribe::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_messages_2eproto();
   return *default_instance_;
 }
 
-Request_Stdin* Request_Stdin::default_instance_ = NULL;
+Request_Runtime_ChannelSubscribe* Request_Runtime_ChannelSubscribe::default_instance_ = NULL;
 
-Request_Stdin* Request_Stdin::New() const {
-  return new Request_Stdin;
+Request_Runtime_ChannelSubscribe* Request_Runtime_ChannelSubscribe::New() const {
+  return new Request_Runtime_ChannelSubscribe;
 }
 
-void Request_Stdin::Clear() {
-  if (has_buffer()) {
-    if (buffer_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-      buffer_->clear();
-    }
-  }
+void Request_Runtime_ChannelSubscribe::Clear() {
+  sample_rate_ = 10;
+  channels_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool Request_Stdin::MergePartialFromCodedStream(
+bool Request_Runtime_ChannelSubscribe::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:lms.Request.Stdin)
+  // @@protoc_insertion_point(parse_start:lms.Request.Runtime.ChannelSubscribe)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional bytes buffer = 1;
+      // repeated string channels = 1;
       case 1: {
         if (tag == 10) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_buffer()));
+         parse_channels:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->add_channels()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->channels(this->channels_size() - 1).data(),
+            this->channels(this->channels_size() - 1).length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "channels");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(10)) goto parse_channels;
+        if (input->ExpectTag(21)) goto parse_sample_rate;
+        break;
+      }
+
+      // optional float sample_rate = 2 [default = 10];
+      case 2: {
+        if (tag == 21) {
+         parse_sample_rate:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &sample_rate_)));
+          set_has_sample_rate();
         } else {
           goto handle_unusual;
         }
@@ -5058,60 +5027,82 @@ bool Request_Stdin::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:lms.Request.Stdin)
+  // @@protoc_insertion_point(parse_success:lms.Request.Runtime.ChannelSubscribe)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:lms.Request.Stdin)
+  // @@protoc_insertion_point(parse_failure:lms.Request.Runtime.ChannelSubscribe)
   return false;
 #undef DO_
 }
 
-void Request_Stdin::SerializeWithCachedSizes(
+void Request_Runtime_ChannelSubscribe::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:lms.Request.Stdin)
-  // optional bytes buffer = 1;
-  if (has_buffer()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
-      1, this->buffer(), output);
+  // @@protoc_insertion_point(serialize_start:lms.Request.Runtime.ChannelSubscribe)
+  // repeated string channels = 1;
+  for (int i = 0; i < this->channels_size(); i++) {
+  ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+    this->channels(i).data(), this->channels(i).length(),
+    ::google::protobuf::internal::WireFormat::SERIALIZE,
+    "channels");
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      1, this->channels(i), output);
+  }
+
+  // optional float sample_rate = 2 [default = 10];
+  if (has_sample_rate()) {
+    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->sample_rate(), output);
   }
 
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:lms.Request.Stdin)
+  // @@protoc_insertion_point(serialize_end:lms.Request.Runtime.ChannelSubscribe)
 }
 
-::google::protobuf::uint8* Request_Stdin::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* Request_Runtime_ChannelSubscribe::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:lms.Request.Stdin)
-  // optional bytes buffer = 1;
-  if (has_buffer()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        1, this->buffer(), target);
+  // @@protoc_insertion_point(serialize_to_array_start:lms.Request.Runtime.ChannelSubscribe)
+  // repeated string channels = 1;
+  for (int i = 0; i < this->channels_size(); i++) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->channels(i).data(), this->channels(i).length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "channels");
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteStringToArray(1, this->channels(i), target);
+  }
+
+  // optional float sample_rate = 2 [default = 10];
+  if (has_sample_rate()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->sample_rate(), target);
   }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:lms.Request.Stdin)
+  // @@protoc_insertion_point(serialize_to_array_end:lms.Request.Runtime.ChannelSubscribe)
   return target;
 }
 
-int Request_Stdin::ByteSize() const {
+int Request_Runtime_ChannelSubscribe::ByteSize() const {
   int total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional bytes buffer = 1;
-    if (has_buffer()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->buffer());
+  if (_has_bits_[1 / 32] & (0xffu << (1 % 32))) {
+    // optional float sample_rate = 2 [default = 10];
+    if (has_sample_rate()) {
+      total_size += 1 + 4;
     }
 
   }
+  // repeated string channels = 1;
+  total_size += 1 * this->channels_size();
+  for (int i = 0; i < this->channels_size(); i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+      this->channels(i));
+  }
+
   if (!unknown_fields().empty()) {
     total_size +=
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
@@ -5123,10 +5114,10 @@ int Request_Stdin::ByteSize() const {
   return total_size;
 }
 
-void Request_Stdin::MergeFrom(const ::google::protobuf::Message& from) {
+void Request_Runtime_ChannelSubscribe::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const Request_Stdin* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Request_Stdin*>(
+  const Request_Runtime_ChannelSubscribe* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Request_Runtime_ChannelSubscribe*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -5135,47 +5126,49 @@ void Request_Stdin::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void Request_Stdin::MergeFrom(const Request_Stdin& from) {
+void Request_Runtime_ChannelSubscribe::MergeFrom(const Request_Runtime_ChannelSubscribe& from) {
   GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_buffer()) {
-      set_buffer(from.buffer());
+  channels_.MergeFrom(from.channels_);
+  if (from._has_bits_[1 / 32] & (0xffu << (1 % 32))) {
+    if (from.has_sample_rate()) {
+      set_sample_rate(from.sample_rate());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void Request_Stdin::CopyFrom(const ::google::protobuf::Message& from) {
+void Request_Runtime_ChannelSubscribe::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Request_Stdin::CopyFrom(const Request_Stdin& from) {
+void Request_Runtime_ChannelSubscribe::CopyFrom(const Request_Runtime_ChannelSubscribe& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Request_Stdin::IsInitialized() const {
+bool Request_Runtime_ChannelSubscribe::IsInitialized() const {
 
   return true;
 }
 
-void Request_Stdin::Swap(Request_Stdin* other) {
+void Request_Runtime_ChannelSubscribe::Swap(Request_Runtime_ChannelSubscribe* other) {
   if (other != this) {
-    std::swap(buffer_, other->buffer_);
+    channels_.Swap(&other->channels_);
+    std::swap(sample_rate_, other->sample_rate_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata Request_Stdin::GetMetadata() const {
+::google::protobuf::Metadata Request_Runtime_ChannelSubscribe::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Request_Stdin_descriptor_;
-  metadata.reflection = Request_Stdin_reflection_;
+  metadata.descriptor = Request_Runtime_ChannelSubscribe_descriptor_;
+  metadata.reflection = Request_Runtime_ChannelSubscribe_reflection_;
   return metadata;
 }
 
@@ -5183,60 +5176,54 @@ void Request_Stdin::Swap(Request_Stdin* other) {
 // -------------------------------------------------------------------
 
 #ifndef _MSC_VER
-const int Request::kInfoFieldNumber;
-const int Request::kShutdownFieldNumber;
-const int Request::kListClientsFieldNumber;
-const int Request::kRunFieldNumber;
-const int Request::kListProcessesFieldNumber;
-const int Request::kAttachFieldNumber;
-const int Request::kStopFieldNumber;
-const int Request::kModuleListFieldNumber;
-const int Request::kListenBroadcastsFieldNumber;
-const int Request::kDetachFieldNumber;
-const int Request::kRuntimeFieldNumber;
-const int Request::kStdinFieldNumber;
+const int Request_Runtime::kNameFieldNumber;
+const int Request_Runtime::kFilterFieldNumber;
+const int Request_Runtime::kProfilingFieldNumber;
+const int Request_Runtime::kStartRecordingFieldNumber;
+const int Request_Runtime::kStopRecordingFieldNumber;
+const int Request_Runtime::kDumpFlightRecorderFieldNumber;
+const int Request_Runtime::kChannelSubscribeFieldNumber;
 #endif  // !_MSC_VER
 
-Request::Request()
+Request_Runtime::Request_Runtime()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:lms.Request)
+  // @@protoc_insertion_point(constructor:lms.Request.Runtime)
 }
 
-void Request::InitAsDefaultInstance() {
-  Request_default_oneof_instance_->info_ = const_cast< ::lms::Request_Info*>(&::lms::Request_Info::default_instance());
-  Request_default_oneof_instance_->shutdown_ = const_cast< ::lms::Request_Shutdown*>(&::lms::Request_Shutdown::default_instance());
-  Request_default_oneof_instance_->list_clients_ = const_cast< ::lms::Request_ListClients*>(&::lms::Request_ListClients::default_instance());
-  Request_default_oneof_instance_->run_ = const_cast< ::lms::Request_Run*>(&::lms::Request_Run::default_instance());
-  Request_default_oneof_instance_->list_processes_ = const_cast< ::lms::Request_ListProcesses*>(&::lms::Request_ListProcesses::default_instance());
-  Request_default_oneof_instance_->attach_ = const_cast< ::lms::Request_Attach*>(&::lms::Request_Attach::default_instance());
-  Request_default_oneof_instance_->stop_ = const_cast< ::lms::Request_Stop*>(&::lms::Request_Stop::default_instance());
-  Request_default_oneof_instance_->module_list_ = const_cast< ::lms::Request_ModuleList*>(&::lms::Request_ModuleList::default_instance());
-  Request_default_oneof_instance_->listen_broadcasts_ = const_cast< ::lms::Request_ListenBroadcastEvents*>(&::lms::Request_ListenBroadcastEvents::default_instance());
-  Request_default_oneof_instance_->detach_ = const_cast< ::lms::Request_Detach*>(&::lms::Request_Detach::default_instance());
-  Request_default_oneof_instance_->runtime_ = const_cast< ::lms::Request_Runtime*>(&::lms::Request_Runtime::default_instance());
-  Request_default_oneof_instance_->stdin_ = const_cast< ::lms::Request_Stdin*>(&::lms::Request_Stdin::default_instance());
+void Request_Runtime::InitAsDefaultInstance() {
+  Request_Runtime_default_oneof_instance_->filter_ = const_cast< ::lms::Request_Runtime_LogFilter*>(&::lms::Request_Runtime_LogFilter::default_instance());
+  Request_Runtime_default_oneof_instance_->profiling_ = const_cast< ::lms::Request_Runtime_Profiling*>(&::lms::Request_Runtime_Profiling::default_instance());
+  Request_Runtime_default_oneof_instance_->start_recording_ = const_cast< ::lms::Request_Runtime_StartRecording*>(&::lms::Request_Runtime_StartRecording::default_instance());
+  Request_Runtime_default_oneof_instance_->stop_recording_ = const_cast< ::lms::Request_Runtime_StopRecording*>(&::lms::Request_Runtime_StopRecording::default_instance());
+  Request_Runtime_default_oneof_instance_->dump_flight_recorder_ = const_cast< ::lms::Request_Runtime_DumpFlightRecorder*>(&::lms::Request_Runtime_DumpFlightRecorder::default_instance());
+  Request_Runtime_default_oneof_instance_->channel_subscribe_ = const_cast< ::lms::Request_Runtime_ChannelSubscribe*>(&::lms::Request_Runtime_ChannelSubscribe::default_instance());
 }
 
-Request::Request(const Request& from)
+Request_Runtime::Request_Runtime(const Request_Runtime& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:lms.Request)
+  // @@protoc_insertion_point(copy_constructor:lms.Request.Runtime)
 }
 
-void Request::SharedCtor() {
+void Request_Runtime::SharedCtor() {
+  ::google::protobuf::internal::GetEmptyString();
   _cached_size_ = 0;
+  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   clear_has_content();
 }
 
-Request::~Request() {
-  // @@protoc_insertion_point(destructor:lms.Request)
+Request_Runtime::~Request_Runtime() {
+  // @@protoc_insertion_point(destructor:lms.Request.Runtime)
   SharedDtor();
 }
 
-void Request::SharedDtor() {
+void Request_Runtime::SharedDtor() {
+  if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete name_;
+  }
   if (has_content()) {
     clear_content();
   }
@@ -5244,75 +5231,51 @@ void Request::SharedDtor() {
   }
 }
 
-void Request::SetCachedSize(int size) const {
+void Request_Runtime::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* Request::descriptor() {
+const ::google::protobuf::Descriptor* Request_Runtime::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return Request_descriptor_;
+  return Request_Runtime_descriptor_;
 }
 
-const Request& Request::default_instance() {
+const Request_Runtime& Request_Runtime::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_messages_2eproto();
   return *default_instance_;
 }
 
-Request* Request::default_instance_ = NULL;
+Request_Runtime* Request_Runtime::default_instance_ = NULL;
 
-Request* Request::New() const {
-  return new Request;
+Request_Runtime* Request_Runtime::New() const {
+  return new Request_Runtime;
 }
 
-void Request::clear_content() {
+void Request_Runtime::clear_content() {
   switch(content_case()) {
-    case kInfo: {
-      delete content_.info_;
-      break;
-    }
-    case kShutdown: {
-      delete content_.shutdown_;
-      break;
-    }
-    case kListClients: {
-      delete content_.list_clients_;
-      break;
-    }
-    case kRun: {
-      delete content_.run_;
-      break;
-    }
-    case kListProcesses: {
-      delete content_.list_processes_;
-      break;
-    }
-    case kAttach: {
-      delete content_.attach_;
-      break;
-    }
-    case kStop: {
-      delete content_.stop_;
+    case kFilter: {
+      delete content_.filter_;
       break;
     }
-    case kModuleList: {
-      delete content_.module_list_;
+    case kProfiling: {
+      delete content_.profiling_;
       break;
     }
-    case kListenBroadcasts: {
-      delete content_.listen_broadcasts_;
+    case kStartRecording: {
+      delete content_.start_recording_;
       break;
     }
-    case kDetach: {
-      delete content_.detach_;
+    case kStopRecording: {
+      delete content_.stop_recording_;
       break;
     }
-    case kRuntime: {
-      delete content_.runtime_;
+    case kDumpFlightRecorder: {
+      delete content_.dump_flight_recorder_;
       break;
     }
-    case kStdin: {
-      delete content_.stdin_;
+    case kChannelSubscribe: {
+      delete content_.channel_subscribe_;
       break;
     }
     case CONTENT_NOT_SET: {
@@ -5323,170 +5286,114 @@ void Request::clear_content() {
 }
 
 
-void Request::Clear() {
+void Request_Runtime::Clear() {
+  if (has_name()) {
+    if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+      name_->clear();
+    }
+  }
   clear_content();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool Request::MergePartialFromCodedStream(
+bool Request_Runtime::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:lms.Request)
+  // @@protoc_insertion_point(parse_start:lms.Request.Runtime)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional .lms.Request.Info info = 1;
+      // optional string name = 1;
       case 1: {
         if (tag == 10) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_info()));
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_name()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->name().data(), this->name().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "name");
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(18)) goto parse_shutdown;
+        if (input->ExpectTag(18)) goto parse_filter;
         break;
       }
 
-      // optional .lms.Request.Shutdown shutdown = 2;
+      // optional .lms.Request.Runtime.LogFilter filter = 2;
       case 2: {
         if (tag == 18) {
-         parse_shutdown:
+         parse_filter:
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_shutdown()));
+               input, mutable_filter()));
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(26)) goto parse_list_clients;
+        if (input->ExpectTag(26)) goto parse_profiling;
         break;
       }
 
-      // optional .lms.Request.ListClients list_clients = 3;
+      // optional .lms.Request.Runtime.Profiling profiling = 3;
       case 3: {
         if (tag == 26) {
-         parse_list_clients:
+         parse_profiling:
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_list_clients()));
+               input, mutable_profiling()));
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(34)) goto parse_run;
+        if (input->ExpectTag(34)) goto parse_start_recording;
         break;
       }
 
-      // optional .lms.Request.Run run = 4;
+      // optional .lms.Request.Runtime.StartRecording start_recording = 4;
       case 4: {
         if (tag == 34) {
-         parse_run:
+         parse_start_recording:
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_run()));
+               input, mutable_start_recording()));
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(42)) goto parse_list_processes;
+        if (input->ExpectTag(42)) goto parse_stop_recording;
         break;
       }
 
-      // optional .lms.Request.ListProcesses list_processes = 5;
+      // optional .lms.Request.Runtime.StopRecording stop_recording = 5;
       case 5: {
         if (tag == 42) {
-         parse_list_processes:
+         parse_stop_recording:
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_list_processes()));
+               input, mutable_stop_recording()));
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(50)) goto parse_attach;
+        if (input->ExpectTag(50)) goto parse_dump_flight_recorder;
         break;
       }
 
-      // optional .lms.Request.Attach attach = 6;
+      // optional .lms.Request.Runtime.DumpFlightRecorder dump_flight_recorder = 6;
       case 6: {
         if (tag == 50) {
-         parse_attach:
+         parse_dump_flight_recorder:
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_attach()));
+               input, mutable_dump_flight_recorder()));
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(58)) goto parse_stop;
+        if (input->ExpectTag(58)) goto parse_channel_subscribe;
         break;
       }
 
-      // optional .lms.Request.Stop stop = 7;
+      // optional .lms.Request.Runtime.ChannelSubscribe channel_subscribe = 7;
       case 7: {
         if (tag == 58) {
-         parse_stop:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_stop()));
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(66)) goto parse_module_list;
-        break;
-      }
-
-      // optional .lms.Request.ModuleList module_list = 8;
-      case 8: {
-        if (tag == 66) {
-         parse_module_list:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_module_list()));
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(82)) goto parse_listen_broadcasts;
-        break;
-      }
-
-      // optional .lms.Request.ListenBroadcastEvents listen_broadcasts = 10;
-      case 10: {
-        if (tag == 82) {
-         parse_listen_broadcasts:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_listen_broadcasts()));
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(90)) goto parse_detach;
-        break;
-      }
-
-      // optional .lms.Request.Detach detach = 11;
-      case 11: {
-        if (tag == 90) {
-         parse_detach:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_detach()));
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(98)) goto parse_runtime;
-        break;
-      }
-
-      // optional .lms.Request.Runtime runtime = 12;
-      case 12: {
-        if (tag == 98) {
-         parse_runtime:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_runtime()));
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(106)) goto parse_stdin;
-        break;
-      }
-
-      // optional .lms.Request.Stdin stdin = 13;
-      case 13: {
-        if (tag == 106) {
-         parse_stdin:
+         parse_channel_subscribe:
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_stdin()));
+               input, mutable_channel_subscribe()));
         } else {
           goto handle_unusual;
         }
@@ -5508,277 +5415,187 @@ bool Request::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:lms.Request)
+  // @@protoc_insertion_point(parse_success:lms.Request.Runtime)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:lms.Request)
+  // @@protoc_insertion_point(parse_failure:lms.Request.Runtime)
   return false;
 #undef DO_
 }
 
-void Request::SerializeWithCachedSizes(
+void Request_Runtime::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:lms.Request)
-  // optional .lms.Request.Info info = 1;
-  if (has_info()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->info(), output);
-  }
-
-  // optional .lms.Request.Shutdown shutdown = 2;
-  if (has_shutdown()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->shutdown(), output);
-  }
-
-  // optional .lms.Request.ListClients list_clients = 3;
-  if (has_list_clients()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->list_clients(), output);
-  }
-
-  // optional .lms.Request.Run run = 4;
-  if (has_run()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->run(), output);
-  }
-
-  // optional .lms.Request.ListProcesses list_processes = 5;
-  if (has_list_processes()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->list_processes(), output);
-  }
-
-  // optional .lms.Request.Attach attach = 6;
-  if (has_attach()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      6, this->attach(), output);
+  // @@protoc_insertion_point(serialize_start:lms.Request.Runtime)
+  // optional string name = 1;
+  if (has_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->name().data(), this->name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "name");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->name(), output);
   }
 
-  // optional .lms.Request.Stop stop = 7;
-  if (has_stop()) {
+  // optional .lms.Request.Runtime.LogFilter filter = 2;
+  if (has_filter()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      7, this->stop(), output);
+      2, this->filter(), output);
   }
 
-  // optional .lms.Request.ModuleList module_list = 8;
-  if (has_module_list()) {
+  // optional .lms.Request.Runtime.Profiling profiling = 3;
+  if (has_profiling()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      8, this->module_list(), output);
+      3, this->profiling(), output);
   }
 
-  // optional .lms.Request.ListenBroadcastEvents listen_broadcasts = 10;
-  if (has_listen_broadcasts()) {
+  // optional .lms.Request.Runtime.StartRecording start_recording = 4;
+  if (has_start_recording()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      10, this->listen_broadcasts(), output);
+      4, this->start_recording(), output);
   }
 
-  // optional .lms.Request.Detach detach = 11;
-  if (has_detach()) {
+  // optional .lms.Request.Runtime.StopRecording stop_recording = 5;
+  if (has_stop_recording()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      11, this->detach(), output);
+      5, this->stop_recording(), output);
   }
 
-  // optional .lms.Request.Runtime runtime = 12;
-  if (has_runtime()) {
+  // optional .lms.Request.Runtime.DumpFlightRecorder dump_flight_recorder = 6;
+  if (has_dump_flight_recorder()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      12, this->runtime(), output);
+      6, this->dump_flight_recorder(), output);
   }
 
-  // optional .lms.Request.Stdin stdin = 13;
-  if (has_stdin()) {
+  // optional .lms.Request.Runtime.ChannelSubscribe channel_subscribe = 7;
+  if (has_channel_subscribe()) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      13, this->stdin(), output);
+      7, this->channel_subscribe(), output);
   }
 
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:lms.Request)
+  // @@protoc_insertion_point(serialize_end:lms.Request.Runtime)
 }
 
-::google::protobuf::uint8* Request::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* Request_Runtime::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:lms.Request)
-  // optional .lms.Request.Info info = 1;
-  if (has_info()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->info(), target);
-  }
-
-  // optional .lms.Request.Shutdown shutdown = 2;
-  if (has_shutdown()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->shutdown(), target);
-  }
-
-  // optional .lms.Request.ListClients list_clients = 3;
-  if (has_list_clients()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->list_clients(), target);
-  }
-
-  // optional .lms.Request.Run run = 4;
-  if (has_run()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        4, this->run(), target);
-  }
-
-  // optional .lms.Request.ListProcesses list_processes = 5;
-  if (has_list_processes()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        5, this->list_processes(), target);
-  }
-
-  // optional .lms.Request.Attach attach = 6;
-  if (has_attach()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        6, this->attach(), target);
+  // @@protoc_insertion_point(serialize_to_array_start:lms.Request.Runtime)
+  // optional string name = 1;
+  if (has_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->name().data(), this->name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "name");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->name(), target);
   }
 
-  // optional .lms.Request.Stop stop = 7;
-  if (has_stop()) {
+  // optional .lms.Request.Runtime.LogFilter filter = 2;
+  if (has_filter()) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        7, this->stop(), target);
+        2, this->filter(), target);
   }
 
-  // optional .lms.Request.ModuleList module_list = 8;
-  if (has_module_list()) {
+  // optional .lms.Request.Runtime.Profiling profiling = 3;
+  if (has_profiling()) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        8, this->module_list(), target);
+        3, this->profiling(), target);
   }
 
-  // optional .lms.Request.ListenBroadcastEvents listen_broadcasts = 10;
-  if (has_listen_broadcasts()) {
+  // optional .lms.Request.Runtime.StartRecording start_recording = 4;
+  if (has_start_recording()) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        10, this->listen_broadcasts(), target);
+        4, this->start_recording(), target);
   }
 
-  // optional .lms.Request.Detach detach = 11;
-  if (has_detach()) {
+  // optional .lms.Request.Runtime.StopRecording stop_recording = 5;
+  if (has_stop_recording()) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        11, this->detach(), target);
+        5, this->stop_recording(), target);
   }
 
-  // optional .lms.Request.Runtime runtime = 12;
-  if (has_runtime()) {
+  // optional .lms.Request.Runtime.DumpFlightRecorder dump_flight_recorder = 6;
+  if (has_dump_flight_recorder()) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        12, this->runtime(), target);
+        6, this->dump_flight_recorder(), target);
   }
 
-  // optional .lms.Request.Stdin stdin = 13;
-  if (has_stdin()) {
+  // optional .lms.Request.Runtime.ChannelSubscribe channel_subscribe = 7;
+  if (has_channel_subscribe()) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        13, this->stdin(), target);
+        7, this->channel_subscribe(), target);
   }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:lms.Request)
+  // @@protoc_insertion_point(serialize_to_array_end:lms.Request.Runtime)
   return target;
 }
 
-int Request::ByteSize() const {
+int Request_Runtime::ByteSize() const {
   int total_size = 0;
 
-  switch (content_case()) {
-    // optional .lms.Request.Info info = 1;
-    case kInfo: {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->info());
-      break;
-    }
-    // optional .lms.Request.Shutdown shutdown = 2;
-    case kShutdown: {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->shutdown());
-      break;
-    }
-    // optional .lms.Request.ListClients list_clients = 3;
-    case kListClients: {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->list_clients());
-      break;
-    }
-    // optional .lms.Request.Run run = 4;
-    case kRun: {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->run());
-      break;
-    }
-    // optional .lms.Request.ListProcesses list_processes = 5;
-    case kListProcesses: {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->list_processes());
-      break;
-    }
-    // optional .lms.Request.Attach attach = 6;
-    case kAttach: {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional string name = 1;
+    if (has_name()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->attach());
-      break;
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->name());
     }
-    // optional .lms.Request.Stop stop = 7;
-    case kStop: {
+
+  }
+  switch (content_case()) {
+    // optional .lms.Request.Runtime.LogFilter filter = 2;
+    case kFilter: {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->stop());
+          this->filter());
       break;
     }
-    // optional .lms.Request.ModuleList module_list = 8;
-    case kModuleList: {
+    // optional .lms.Request.Runtime.Profiling profiling = 3;
+    case kProfiling: {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->module_list());
+          this->profiling());
       break;
     }
-    // optional .lms.Request.ListenBroadcastEvents listen_broadcasts = 10;
-    case kListenBroadcasts: {
+    // optional .lms.Request.Runtime.StartRecording start_recording = 4;
+    case kStartRecording: {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->listen_broadcasts());
+          this->start_recording());
       break;
     }
-    // optional .lms.Request.Detach detach = 11;
-    case kDetach: {
+    // optional .lms.Request.Runtime.StopRecording stop_recording = 5;
+    case kStopRecording: {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->detach());
+          this->stop_recording());
       break;
     }
-    // optional .lms.Request.Runtime runtime = 12;
-    case kRuntime: {
+    // optional .lms.Request.Runtime.DumpFlightRecorder dump_flight_recorder = 6;
+    case kDumpFlightRecorder: {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->runtime());
+          this->dump_flight_recorder());
       break;
     }
-    // optional .lms.Request.Stdin stdin = 13;
-    case kStdin: {
+    // optional .lms.Request.Runtime.ChannelSubscribe channel_subscribe = 7;
+    case kChannelSubscribe: {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->stdin());
+          this->channel_subscribe());
       break;
     }
     case CONTENT_NOT_SET: {
@@ -5796,10 +5613,10 @@ int Request::ByteSize() const {
   return total_size;
 }
 
-void Request::MergeFrom(const ::google::protobuf::Message& from) {
+void Request_Runtime::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const Request* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Request*>(
+  const Request_Runtime* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Request_Runtime*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -5808,83 +5625,65 @@ void Request::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void Request::MergeFrom(const Request& from) {
+void Request_Runtime::MergeFrom(const Request_Runtime& from) {
   GOOGLE_CHECK_NE(&from, this);
   switch (from.content_case()) {
-    case kInfo: {
-      mutable_info()->::lms::Request_Info::MergeFrom(from.info());
-      break;
-    }
-    case kShutdown: {
-      mutable_shutdown()->::lms::Request_Shutdown::MergeFrom(from.shutdown());
-      break;
-    }
-    case kListClients: {
-      mutable_list_clients()->::lms::Request_ListClients::MergeFrom(from.list_clients());
-      break;
-    }
-    case kRun: {
-      mutable_run()->::lms::Request_Run::MergeFrom(from.run());
-      break;
-    }
-    case kListProcesses: {
-      mutable_list_processes()->::lms::Request_ListProcesses::MergeFrom(from.list_processes());
-      break;
-    }
-    case kAttach: {
-      mutable_attach()->::lms::Request_Attach::MergeFrom(from.attach());
-      break;
-    }
-    case kStop: {
-      mutable_stop()->::lms::Request_Stop::MergeFrom(from.stop());
+    case kFilter: {
+      mutable_filter()->::lms::Request_Runtime_LogFilter::MergeFrom(from.filter());
       break;
     }
-    case kModuleList: {
-      mutable_module_list()->::lms::Request_ModuleList::MergeFrom(from.module_list());
+    case kProfiling: {
+      mutable_profiling()->::lms::Request_Runtime_Profiling::MergeFrom(from.profiling());
       break;
     }
-    case kListenBroadcasts: {
-      mutable_listen_broadcasts()->::lms::Request_ListenBroadcastEvents::MergeFrom(from.listen_broadcasts());
+    case kStartRecording: {
+      mutable_start_recording()->::lms::Request_Runtime_StartRecording::MergeFrom(from.start_recording());
       break;
     }
-    case kDetach: {
-      mutable_detach()->::lms::Request_Detach::MergeFrom(from.detach());
+    case kStopRecording: {
+      mutable_stop_recording()->::lms::Request_Runtime_StopRecording::MergeFrom(from.stop_recording());
       break;
     }
-    case kRuntime: {
-      mutable_runtime()->::lms::Request_Runtime::MergeFrom(from.runtime());
+    case kDumpFlightRecorder: {
+      mutable_dump_flight_recorder()->::lms::Request_Runtime_DumpFlightRecorder::MergeFrom(from.dump_flight_recorder());
       break;
     }
-    case kStdin: {
-      mutable_stdin()->::lms::Request_Stdin::MergeFrom(from.stdin());
+    case kChannelSubscribe: {
+      mutable_channel_subscribe()->::lms::Request_Runtime_ChannelSubscribe::MergeFrom(from.channel_subscribe());
       break;
     }
     case CONTENT_NOT_SET: {
       break;
     }
   }
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_name()) {
+      set_name(from.name());
+    }
+  }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void Request::CopyFrom(const ::google::protobuf::Message& from) {
+void Request_Runtime::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Request::CopyFrom(const Request& from) {
+void Request_Runtime::CopyFrom(const Request_Runtime& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Request::IsInitialized() const {
+bool Request_Runtime::IsInitialized() const {
 
   return true;
 }
 
-void Request::Swap(Request* other) {
+void Request_Runtime::Swap(Request_Runtime* other) {
   if (other != this) {
+    std::swap(name_, other->name_);
     std::swap(content_, other->content_);
     std::swap(_oneof_case_[0], other->_oneof_case_[0]);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
@@ -5893,128 +5692,103 @@ void Request::Swap(Request* other) {
   }
 }
 
-::google::protobuf::Metadata Request::GetMetadata() const {
+::google::protobuf::Metadata Request_Runtime::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Request_descriptor_;
-  metadata.reflection = Request_reflection_;
+  metadata.descriptor = Request_Runtime_descriptor_;
+  metadata.reflection = Request_Runtime_reflection_;
   return metadata;
 }
 
 
-// ===================================================================
+// -------------------------------------------------------------------
 
 #ifndef _MSC_VER
-const int Response_Info::kVersionFieldNumber;
-const int Response_Info::kPidFieldNumber;
+const int Request_Stdin::kBufferFieldNumber;
 #endif  // !_MSC_VER
 
-Response_Info::Response_Info()
+Request_Stdin::Request_Stdin()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:lms.Response.Info)
+  // @@protoc_insertion_point(constructor:lms.Request.Stdin)
 }
 
-void Response_Info::InitAsDefaultInstance() {
+void Request_Stdin::InitAsDefaultInstance() {
 }
 
-Response_Info::Response_Info(const Response_Info& from)
+Request_Stdin::Request_Stdin(const Request_Stdin& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:lms.Response.Info)
+  // @@protoc_insertion_point(copy_constructor:lms.Request.Stdin)
 }
 
-void Response_Info::SharedCtor() {
-  _cached_size_ = 0;
-  version_ = 0;
-  pid_ = 0;
+void Request_Stdin::SharedCtor() {
+  ::google::protobuf::internal::GetEmptyString();
+  _cached_size_ = 0;
+  buffer_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-Response_Info::~Response_Info() {
-  // @@protoc_insertion_point(destructor:lms.Response.Info)
+Request_Stdin::~Request_Stdin() {
+  // @@protoc_insertion_point(destructor:lms.Request.Stdin)
   SharedDtor();
 }
 
-void Response_Info::SharedDtor() {
+void Request_Stdin::SharedDtor() {
+  if (buffer_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete buffer_;
+  }
   if (this != default_instance_) {
   }
 }
 
-void Response_Info::SetCachedSize(int size) const {
+void Request_Stdin::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* Response_Info::descriptor() {
+const ::google::protobuf::Descriptor* Request_Stdin::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return Response_Info_descriptor_;
+  return Request_Stdin_descriptor_;
 }
 
-const Response_Info& Response_Info::default_instance() {
+const Request_Stdin& Request_Stdin::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_messages_2eproto();
   return *default_instance_;
 }
 
-Response_Info* Response_Info::default_instance_ = NULL;
+Request_Stdin* Request_Stdin::default_instance_ = NULL;
 
-Response_Info* Response_Info::New() const {
-  return new Response_Info;
+Request_Stdin* Request_Stdin::New() const {
+  return new Request_Stdin;
 }
 
-void Response_Info::Clear() {
-#define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
-  &reinterpret_cast<Response_Info*>(16)->f) - \
-   reinterpret_cast<char*>(16))
-
-#define ZR_(first, last) do {                              \
-    size_t f = OFFSET_OF_FIELD_(first);                    \
-    size_t n = OFFSET_OF_FIELD_(last) - f + sizeof(last);  \
-    ::memset(&first, 0, n);                                \
-  } while (0)
-
-  ZR_(version_, pid_);
-
-#undef OFFSET_OF_FIELD_
-#undef ZR_
-
+void Request_Stdin::Clear() {
+  if (has_buffer()) {
+    if (buffer_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+      buffer_->clear();
+    }
+  }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool Response_Info::MergePartialFromCodedStream(
+bool Request_Stdin::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:lms.Response.Info)
+  // @@protoc_insertion_point(parse_start:lms.Request.Stdin)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional int32 version = 1;
+      // optional bytes buffer = 1;
       case 1: {
-        if (tag == 8) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &version_)));
-          set_has_version();
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(16)) goto parse_pid;
-        break;
-      }
-
-      // optional int32 pid = 2;
-      case 2: {
-        if (tag == 16) {
-         parse_pid:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &pid_)));
-          set_has_pid();
+        if (tag == 10) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_buffer()));
         } else {
           goto handle_unusual;
         }
@@ -6036,71 +5810,57 @@ bool Response_Info::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:lms.Response.Info)
+  // @@protoc_insertion_point(parse_success:lms.Request.Stdin)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:lms.Response.Info)
+  // @@protoc_insertion_point(parse_failure:lms.Request.Stdin)
   return false;
 #undef DO_
 }
 
-void Response_Info::SerializeWithCachedSizes(
+void Request_Stdin::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:lms.Response.Info)
-  // optional int32 version = 1;
-  if (has_version()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->version(), output);
-  }
-
-  // optional int32 pid = 2;
-  if (has_pid()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->pid(), output);
+  // @@protoc_insertion_point(serialize_start:lms.Request.Stdin)
+  // optional bytes buffer = 1;
+  if (has_buffer()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      1, this->buffer(), output);
   }
 
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:lms.Response.Info)
+  // @@protoc_insertion_point(serialize_end:lms.Request.Stdin)
 }
 
-::google::protobuf::uint8* Response_Info::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* Request_Stdin::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:lms.Response.Info)
-  // optional int32 version = 1;
-  if (has_version()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->version(), target);
-  }
-
-  // optional int32 pid = 2;
-  if (has_pid()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->pid(), target);
+  // @@protoc_insertion_point(serialize_to_array_start:lms.Request.Stdin)
+  // optional bytes buffer = 1;
+  if (has_buffer()) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        1, this->buffer(), target);
   }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:lms.Response.Info)
+  // @@protoc_insertion_point(serialize_to_array_end:lms.Request.Stdin)
   return target;
 }
 
-int Response_Info::ByteSize() const {
+int Request_Stdin::ByteSize() const {
   int total_size = 0;
 
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional int32 version = 1;
-    if (has_version()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->version());
-    }
-
-    // optional int32 pid = 2;
-    if (has_pid()) {
+    // optional bytes buffer = 1;
+    if (has_buffer()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->pid());
+        ::google::protobuf::internal::WireFormatLite::BytesSize(
+          this->buffer());
     }
 
   }
@@ -6115,10 +5875,10 @@ int Response_Info::ByteSize() const {
   return total_size;
 }
 
-void Response_Info::MergeFrom(const ::google::protobuf::Message& from) {
+void Request_Stdin::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const Response_Info* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Response_Info*>(
+  const Request_Stdin* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Request_Stdin*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -6127,51 +5887,47 @@ void Response_Info::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void Response_Info::MergeFrom(const Response_Info& from) {
+void Request_Stdin::MergeFrom(const Request_Stdin& from) {
   GOOGLE_CHECK_NE(&from, this);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_version()) {
-      set_version(from.version());
-    }
-    if (from.has_pid()) {
-      set_pid(from.pid());
+    if (from.has_buffer()) {
+      set_buffer(from.buffer());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void Response_Info::CopyFrom(const ::google::protobuf::Message& from) {
+void Request_Stdin::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Response_Info::CopyFrom(const Response_Info& from) {
+void Request_Stdin::CopyFrom(const Request_Stdin& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Response_Info::IsInitialized() const {
+bool Request_Stdin::IsInitialized() const {
 
   return true;
 }
 
-void Response_Info::Swap(Response_Info* other) {
+void Request_Stdin::Swap(Request_Stdin* other) {
   if (other != this) {
-    std::swap(version_, other->version_);
-    std::swap(pid_, other->pid_);
+    std::swap(buffer_, other->buffer_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata Response_Info::GetMetadata() const {
+::google::protobuf::Metadata Request_Stdin::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Response_Info_descriptor_;
-  metadata.reflection = Response_Info_reflection_;
+  metadata.descriptor = Request_Stdin_descriptor_;
+  metadata.reflection = Request_Stdin_reflection_;
   return metadata;
 }
 
@@ -6179,118 +5935,1929 @@ void Response_Info::Swap(Response_Info* other) {
 // -------------------------------------------------------------------
 
 #ifndef _MSC_VER
-const int Response_ClientList_Client::kFdFieldNumber;
-const int Response_ClientList_Client::kPeerFieldNumber;
+const int Request::kInfoFieldNumber;
+const int Request::kShutdownFieldNumber;
+const int Request::kListClientsFieldNumber;
+const int Request::kRunFieldNumber;
+const int Request::kListProcessesFieldNumber;
+const int Request::kAttachFieldNumber;
+const int Request::kStopFieldNumber;
+const int Request::kModuleListFieldNumber;
+const int Request::kListenBroadcastsFieldNumber;
+const int Request::kDetachFieldNumber;
+const int Request::kRuntimeFieldNumber;
+const int Request::kStdinFieldNumber;
 #endif  // !_MSC_VER
 
-Response_ClientList_Client::Response_ClientList_Client()
+Request::Request()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:lms.Response.ClientList.Client)
+  // @@protoc_insertion_point(constructor:lms.Request)
 }
 
-void Response_ClientList_Client::InitAsDefaultInstance() {
+void Request::InitAsDefaultInstance() {
+  Request_default_oneof_instance_->info_ = const_cast< ::lms::Request_Info*>(&::lms::Request_Info::default_instance());
+  Request_default_oneof_instance_->shutdown_ = const_cast< ::lms::Request_Shutdown*>(&::lms::Request_Shutdown::default_instance());
+  Request_default_oneof_instance_->list_clients_ = const_cast< ::lms::Request_ListClients*>(&::lms::Request_ListClients::default_instance());
+  Request_default_oneof_instance_->run_ = const_cast< ::lms::Request_Run*>(&::lms::Request_Run::default_instance());
+  Request_default_oneof_instance_->list_processes_ = const_cast< ::lms::Request_ListProcesses*>(&::lms::Request_ListProcesses::default_instance());
+  Request_default_oneof_instance_->attach_ = const_cast< ::lms::Request_Attach*>(&::lms::Request_Attach::default_instance());
+  Request_default_oneof_instance_->stop_ = const_cast< ::lms::Request_Stop*>(&::lms::Request_Stop::default_instance());
+  Request_default_oneof_instance_->module_list_ = const_cast< ::lms::Request_ModuleList*>(&::lms::Request_ModuleList::default_instance());
+  Request_default_oneof_instance_->listen_broadcasts_ = const_cast< ::lms::Request_ListenBroadcastEvents*>(&::lms::Request_ListenBroadcastEvents::default_instance());
+  Request_default_oneof_instance_->detach_ = const_cast< ::lms::Request_Detach*>(&::lms::Request_Detach::default_instance());
+  Request_default_oneof_instance_->runtime_ = const_cast< ::lms::Request_Runtime*>(&::lms::Request_Runtime::default_instance());
+  Request_default_oneof_instance_->stdin_ = const_cast< ::lms::Request_Stdin*>(&::lms::Request_Stdin::default_instance());
 }
 
-Response_ClientList_Client::Response_ClientList_Client(const Response_ClientList_Client& from)
+Request::Request(const Request& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:lms.Response.ClientList.Client)
+  // @@protoc_insertion_point(copy_constructor:lms.Request)
 }
 
-void Response_ClientList_Client::SharedCtor() {
-  ::google::protobuf::internal::GetEmptyString();
+void Request::SharedCtor() {
   _cached_size_ = 0;
-  fd_ = 0;
-  peer_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  clear_has_content();
 }
 
-Response_ClientList_Client::~Response_ClientList_Client() {
-  // @@protoc_insertion_point(destructor:lms.Response.ClientList.Client)
+Request::~Request() {
+  // @@protoc_insertion_point(destructor:lms.Request)
   SharedDtor();
 }
 
-void Response_ClientList_Client::SharedDtor() {
-  if (peer_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete peer_;
+void Request::SharedDtor() {
+  if (has_content()) {
+    clear_content();
   }
   if (this != default_instance_) {
   }
 }
 
-void Response_ClientList_Client::SetCachedSize(int size) const {
+void Request::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* Response_ClientList_Client::descriptor() {
+const ::google::protobuf::Descriptor* Request::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return Response_ClientList_Client_descriptor_;
+  return Request_descriptor_;
 }
 
-const Response_ClientList_Client& Response_ClientList_Client::default_instance() {
+const Request& Request::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_messages_2eproto();
   return *default_instance_;
 }
 
-Response_ClientList_Client* Response_ClientList_Client::default_instance_ = NULL;
+Request* Request::default_instance_ = NULL;
 
-Response_ClientList_Client* Response_ClientList_Client::New() const {
-  return new Response_ClientList_Client;
+Request* Request::New() const {
+  return new Request;
 }
 
-void Response_ClientList_Client::Clear() {
-  if (_has_bits_[0 / 32] & 3) {
-    fd_ = 0;
-    if (has_peer()) {
-      if (peer_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-        peer_->clear();
-      }
+void Request::clear_content() {
+  switch(content_case()) {
+    case kInfo: {
+      delete content_.info_;
+      break;
     }
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool Response_ClientList_Client::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
+    case kShutdown: {
+      delete content_.shutdown_;
+      break;
+    }
+    case kListClients: {
+      delete content_.list_clients_;
+      break;
+    }
+    case kRun: {
+      delete content_.run_;
+      break;
+    }
+    case kListProcesses: {
+      delete content_.list_processes_;
+      break;
+    }
+    case kAttach: {
+      delete content_.attach_;
+      break;
+    }
+    case kStop: {
+      delete content_.stop_;
+      break;
+    }
+    case kModuleList: {
+      delete content_.module_list_;
+      break;
+    }
+    case kListenBroadcasts: {
+      delete content_.listen_broadcasts_;
+      break;
+    }
+    case kDetach: {
+      delete content_.detach_;
+      break;
+    }
+    case kRuntime: {
+      delete content_.runtime_;
+      break;
+    }
+    case kStdin: {
+      delete content_.stdin_;
+      break;
+    }
+    case CONTENT_NOT_SET: {
+      break;
+    }
+  }
+  _oneof_case_[0] = CONTENT_NOT_SET;
+}
+
+
+void Request::Clear() {
+  clear_content();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool Request::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:lms.Request)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional .lms.Request.Info info = 1;
+      case 1: {
+        if (tag == 10) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_info()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(18)) goto parse_shutdown;
+        break;
+      }
+
+      // optional .lms.Request.Shutdown shutdown = 2;
+      case 2: {
+        if (tag == 18) {
+         parse_shutdown:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_shutdown()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(26)) goto parse_list_clients;
+        break;
+      }
+
+      // optional .lms.Request.ListClients list_clients = 3;
+      case 3: {
+        if (tag == 26) {
+         parse_list_clients:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_list_clients()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(34)) goto parse_run;
+        break;
+      }
+
+      // optional .lms.Request.Run run = 4;
+      case 4: {
+        if (tag == 34) {
+         parse_run:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_run()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(42)) goto parse_list_processes;
+        break;
+      }
+
+      // optional .lms.Request.ListProcesses list_processes = 5;
+      case 5: {
+        if (tag == 42) {
+         parse_list_processes:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_list_processes()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(50)) goto parse_attach;
+        break;
+      }
+
+      // optional .lms.Request.Attach attach = 6;
+      case 6: {
+        if (tag == 50) {
+         parse_attach:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_attach()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(58)) goto parse_stop;
+        break;
+      }
+
+      // optional .lms.Request.Stop stop = 7;
+      case 7: {
+        if (tag == 58) {
+         parse_stop:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_stop()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(66)) goto parse_module_list;
+        break;
+      }
+
+      // optional .lms.Request.ModuleList module_list = 8;
+      case 8: {
+        if (tag == 66) {
+         parse_module_list:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_module_list()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(82)) goto parse_listen_broadcasts;
+        break;
+      }
+
+      // optional .lms.Request.ListenBroadcastEvents listen_broadcasts = 10;
+      case 10: {
+        if (tag == 82) {
+         parse_listen_broadcasts:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_listen_broadcasts()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(90)) goto parse_detach;
+        break;
+      }
+
+      // optional .lms.Request.Detach detach = 11;
+      case 11: {
+        if (tag == 90) {
+         parse_detach:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_detach()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(98)) goto parse_runtime;
+        break;
+      }
+
+      // optional .lms.Request.Runtime runtime = 12;
+      case 12: {
+        if (tag == 98) {
+         parse_runtime:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_runtime()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(106)) goto parse_stdin;
+        break;
+      }
+
+      // optional .lms.Request.Stdin stdin = 13;
+      case 13: {
+        if (tag == 106) {
+         parse_stdin:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_stdin()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:lms.Request)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:lms.Request)
+  return false;
+#undef DO_
+}
+
+void Request::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:lms.Request)
+  // optional .lms.Request.Info info = 1;
+  if (has_info()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, this->info(), output);
+  }
+
+  // optional .lms.Request.Shutdown shutdown = 2;
+  if (has_shutdown()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, this->shutdown(), output);
+  }
+
+  // optional .lms.Request.ListClients list_clients = 3;
+  if (has_list_clients()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      3, this->list_clients(), output);
+  }
+
+  // optional .lms.Request.Run run = 4;
+  if (has_run()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      4, this->run(), output);
+  }
+
+  // optional .lms.Request.ListProcesses list_processes = 5;
+  if (has_list_processes()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      5, this->list_processes(), output);
+  }
+
+  // optional .lms.Request.Attach attach = 6;
+  if (has_attach()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      6, this->attach(), output);
+  }
+
+  // optional .lms.Request.Stop stop = 7;
+  if (has_stop()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      7, this->stop(), output);
+  }
+
+  // optional .lms.Request.ModuleList module_list = 8;
+  if (has_module_list()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      8, this->module_list(), output);
+  }
+
+  // optional .lms.Request.ListenBroadcastEvents listen_broadcasts = 10;
+  if (has_listen_broadcasts()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      10, this->listen_broadcasts(), output);
+  }
+
+  // optional .lms.Request.Detach detach = 11;
+  if (has_detach()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      11, this->detach(), output);
+  }
+
+  // optional .lms.Request.Runtime runtime = 12;
+  if (has_runtime()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      12, this->runtime(), output);
+  }
+
+  // optional .lms.Request.Stdin stdin = 13;
+  if (has_stdin()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      13, this->stdin(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:lms.Request)
+}
+
+::google::protobuf::uint8* Request::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:lms.Request)
+  // optional .lms.Request.Info info = 1;
+  if (has_info()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        1, this->info(), target);
+  }
+
+  // optional .lms.Request.Shutdown shutdown = 2;
+  if (has_shutdown()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        2, this->shutdown(), target);
+  }
+
+  // optional .lms.Request.ListClients list_clients = 3;
+  if (has_list_clients()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        3, this->list_clients(), target);
+  }
+
+  // optional .lms.Request.Run run = 4;
+  if (has_run()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        4, this->run(), target);
+  }
+
+  // optional .lms.Request.ListProcesses list_processes = 5;
+  if (has_list_processes()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        5, this->list_processes(), target);
+  }
+
+  // optional .lms.Request.Attach attach = 6;
+  if (has_attach()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        6, this->attach(), target);
+  }
+
+  // optional .lms.Request.Stop stop = 7;
+  if (has_stop()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        7, this->stop(), target);
+  }
+
+  // optional .lms.Request.ModuleList module_list = 8;
+  if (has_module_list()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        8, this->module_list(), target);
+  }
+
+  // optional .lms.Request.ListenBroadcastEvents listen_broadcasts = 10;
+  if (has_listen_broadcasts()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        10, this->listen_broadcasts(), target);
+  }
+
+  // optional .lms.Request.Detach detach = 11;
+  if (has_detach()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        11, this->detach(), target);
+  }
+
+  // optional .lms.Request.Runtime runtime = 12;
+  if (has_runtime()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        12, this->runtime(), target);
+  }
+
+  // optional .lms.Request.Stdin stdin = 13;
+  if (has_stdin()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        13, this->stdin(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:lms.Request)
+  return target;
+}
+
+int Request::ByteSize() const {
+  int total_size = 0;
+
+  switch (content_case()) {
+    // optional .lms.Request.Info info = 1;
+    case kInfo: {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->info());
+      break;
+    }
+    // optional .lms.Request.Shutdown shutdown = 2;
+    case kShutdown: {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->shutdown());
+      break;
+    }
+    // optional .lms.Request.ListClients list_clients = 3;
+    case kListClients: {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->list_clients());
+      break;
+    }
+    // optional .lms.Request.Run run = 4;
+    case kRun: {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->run());
+      break;
+    }
+    // optional .lms.Request.ListProcesses list_processes = 5;
+    case kListProcesses: {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->list_processes());
+      break;
+    }
+    // optional .lms.Request.Attach attach = 6;
+    case kAttach: {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->attach());
+      break;
+    }
+    // optional .lms.Request.Stop stop = 7;
+    case kStop: {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->stop());
+      break;
+    }
+    // optional .lms.Request.ModuleList module_list = 8;
+    case kModuleList: {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->module_list());
+      break;
+    }
+    // optional .lms.Request.ListenBroadcastEvents listen_broadcasts = 10;
+    case kListenBroadcasts: {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->listen_broadcasts());
+      break;
+    }
+    // optional .lms.Request.Detach detach = 11;
+    case kDetach: {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->detach());
+      break;
+    }
+    // optional .lms.Request.Runtime runtime = 12;
+    case kRuntime: {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->runtime());
+      break;
+    }
+    // optional .lms.Request.Stdin stdin = 13;
+    case kStdin: {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->stdin());
+      break;
+    }
+    case CONTENT_NOT_SET: {
+      break;
+    }
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void Request::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const Request* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Request*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void Request::MergeFrom(const Request& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  switch (from.content_case()) {
+    case kInfo: {
+      mutable_info()->::lms::Request_Info::MergeFrom(from.info());
+      break;
+    }
+    case kShutdown: {
+      mutable_shutdown()->::lms::Request_Shutdown::MergeFrom(from.shutdown());
+      break;
+    }
+    case kListClients: {
+      mutable_list_clients()->::lms::Request_ListClients::MergeFrom(from.list_clients());
+      break;
+    }
+    case kRun: {
+      mutable_run()->::lms::Request_Run::MergeFrom(from.run());
+      break;
+    }
+    case kListProcesses: {
+      mutable_list_processes()->::lms::Request_ListProcesses::MergeFrom(from.list_processes());
+      break;
+    }
+    case kAttach: {
+      mutable_attach()->::lms::Request_Attach::MergeFrom(from.attach());
+      break;
+    }
+    case kStop: {
+      mutable_stop()->::lms::Request_Stop::MergeFrom(from.stop());
+      break;
+    }
+    case kModuleList: {
+      mutable_module_list()->::lms::Request_ModuleList::MergeFrom(from.module_list());
+      break;
+    }
+    case kListenBroadcasts: {
+      mutable_listen_broadcasts()->::lms::Request_ListenBroadcastEvents::MergeFrom(from.listen_broadcasts());
+      break;
+    }
+    case kDetach: {
+      mutable_detach()->::lms::Request_Detach::MergeFrom(from.detach());
+      break;
+    }
+    case kRuntime: {
+      mutable_runtime()->::lms::Request_Runtime::MergeFrom(from.runtime());
+      break;
+    }
+    case kStdin: {
+      mutable_stdin()->::lms::Request_Stdin::MergeFrom(from.stdin());
+      break;
+    }
+    case CONTENT_NOT_SET: {
+      break;
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void Request::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Request::CopyFrom(const Request& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Request::IsInitialized() const {
+
+  return true;
+}
+
+void Request::Swap(Request* other) {
+  if (other != this) {
+    std::swap(content_, other->content_);
+    std::swap(_oneof_case_[0], other->_oneof_case_[0]);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata Request::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = Request_descriptor_;
+  metadata.reflection = Request_reflection_;
+  return metadata;
+}
+
+
+// ===================================================================
+
+#ifndef _MSC_VER
+const int Response_Info::kVersionFieldNumber;
+const int Response_Info::kPidFieldNumber;
+#endif  // !_MSC_VER
+
+Response_Info::Response_Info()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:lms.Response.Info)
+}
+
+void Response_Info::InitAsDefaultInstance() {
+}
+
+Response_Info::Response_Info(const Response_Info& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:lms.Response.Info)
+}
+
+void Response_Info::SharedCtor() {
+  _cached_size_ = 0;
+  version_ = 0;
+  pid_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+Response_Info::~Response_Info() {
+  // @@protoc_insertion_point(destructor:lms.Response.Info)
+  SharedDtor();
+}
+
+void Response_Info::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void Response_Info::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* Response_Info::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return Response_Info_descriptor_;
+}
+
+const Response_Info& Response_Info::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_messages_2eproto();
+  return *default_instance_;
+}
+
+Response_Info* Response_Info::default_instance_ = NULL;
+
+Response_Info* Response_Info::New() const {
+  return new Response_Info;
+}
+
+void Response_Info::Clear() {
+#define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
+  &reinterpret_cast<Response_Info*>(16)->f) - \
+   reinterpret_cast<char*>(16))
+
+#define ZR_(first, last) do {                              \
+    size_t f = OFFSET_OF_FIELD_(first);                    \
+    size_t n = OFFSET_OF_FIELD_(last) - f + sizeof(last);  \
+    ::memset(&first, 0, n);                                \
+  } while (0)
+
+  ZR_(version_, pid_);
+
+#undef OFFSET_OF_FIELD_
+#undef ZR_
+
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool Response_Info::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:lms.Response.Info)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 version = 1;
+      case 1: {
+        if (tag == 8) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &version_)));
+          set_has_version();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(16)) goto parse_pid;
+        break;
+      }
+
+      // optional int32 pid = 2;
+      case 2: {
+        if (tag == 16) {
+         parse_pid:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &pid_)));
+          set_has_pid();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:lms.Response.Info)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:lms.Response.Info)
+  return false;
+#undef DO_
+}
+
+void Response_Info::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:lms.Response.Info)
+  // optional int32 version = 1;
+  if (has_version()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->version(), output);
+  }
+
+  // optional int32 pid = 2;
+  if (has_pid()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->pid(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:lms.Response.Info)
+}
+
+::google::protobuf::uint8* Response_Info::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:lms.Response.Info)
+  // optional int32 version = 1;
+  if (has_version()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->version(), target);
+  }
+
+  // optional int32 pid = 2;
+  if (has_pid()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->pid(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:lms.Response.Info)
+  return target;
+}
+
+int Response_Info::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional int32 version = 1;
+    if (has_version()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->version());
+    }
+
+    // optional int32 pid = 2;
+    if (has_pid()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->pid());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void Response_Info::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const Response_Info* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Response_Info*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void Response_Info::MergeFrom(const Response_Info& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_version()) {
+      set_version(from.version());
+    }
+    if (from.has_pid()) {
+      set_pid(from.pid());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void Response_Info::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Response_Info::CopyFrom(const Response_Info& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Response_Info::IsInitialized() const {
+
+  return true;
+}
+
+void Response_Info::Swap(Response_Info* other) {
+  if (other != this) {
+    std::swap(version_, other->version_);
+    std::swap(pid_, other->pid_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata Response_Info::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = Response_Info_descriptor_;
+  metadata.reflection = Response_Info_reflection_;
+  return metadata;
+}
+
+
+// -------------------------------------------------------------------
+
+#ifndef _MSC_VER
+const int Response_ClientList_Client::kFdFieldNumber;
+const int Response_ClientList_Client::kPeerFieldNumber;
+#endif  // !_MSC_VER
+
+Response_ClientList_Client::Response_ClientList_Client()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:lms.Response.ClientList.Client)
+}
+
+void Response_ClientList_Client::InitAsDefaultInstance() {
+}
+
+Response_ClientList_Client::Response_ClientList_Client(const Response_ClientList_Client& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:lms.Response.ClientList.Client)
+}
+
+void Response_ClientList_Client::SharedCtor() {
+  ::google::protobuf::internal::GetEmptyString();
+  _cached_size_ = 0;
+  fd_ = 0;
+  peer_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+Response_ClientList_Client::~Response_ClientList_Client() {
+  // @@protoc_insertion_point(destructor:lms.Response.ClientList.Client)
+  SharedDtor();
+}
+
+void Response_ClientList_Client::SharedDtor() {
+  if (peer_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete peer_;
+  }
+  if (this != default_instance_) {
+  }
+}
+
+void Response_ClientList_Client::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* Response_ClientList_Client::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return Response_ClientList_Client_descriptor_;
+}
+
+const Response_ClientList_Client& Response_ClientList_Client::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_messages_2eproto();
+  return *default_instance_;
+}
+
+Response_ClientList_Client* Response_ClientList_Client::default_instance_ = NULL;
+
+Response_ClientList_Client* Response_ClientList_Client::New() const {
+  return new Response_ClientList_Client;
+}
+
+void Response_ClientList_Client::Clear() {
+  if (_has_bits_[0 / 32] & 3) {
+    fd_ = 0;
+    if (has_peer()) {
+      if (peer_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        peer_->clear();
+      }
+    }
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool Response_ClientList_Client::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:lms.Response.ClientList.Client)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 fd = 1;
+      case 1: {
+        if (tag == 8) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &fd_)));
+          set_has_fd();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(18)) goto parse_peer;
+        break;
+      }
+
+      // optional string peer = 2;
+      case 2: {
+        if (tag == 18) {
+         parse_peer:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_peer()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->peer().data(), this->peer().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "peer");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:lms.Response.ClientList.Client)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:lms.Response.ClientList.Client)
+  return false;
+#undef DO_
+}
+
+void Response_ClientList_Client::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:lms.Response.ClientList.Client)
+  // optional int32 fd = 1;
+  if (has_fd()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->fd(), output);
+  }
+
+  // optional string peer = 2;
+  if (has_peer()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->peer().data(), this->peer().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "peer");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->peer(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:lms.Response.ClientList.Client)
+}
+
+::google::protobuf::uint8* Response_ClientList_Client::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:lms.Response.ClientList.Client)
+  // optional int32 fd = 1;
+  if (has_fd()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->fd(), target);
+  }
+
+  // optional string peer = 2;
+  if (has_peer()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->peer().data(), this->peer().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "peer");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->peer(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:lms.Response.ClientList.Client)
+  return target;
+}
+
+int Response_ClientList_Client::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional int32 fd = 1;
+    if (has_fd()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->fd());
+    }
+
+    // optional string peer = 2;
+    if (has_peer()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->peer());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void Response_ClientList_Client::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const Response_ClientList_Client* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Response_ClientList_Client*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void Response_ClientList_Client::MergeFrom(const Response_ClientList_Client& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_fd()) {
+      set_fd(from.fd());
+    }
+    if (from.has_peer()) {
+      set_peer(from.peer());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void Response_ClientList_Client::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Response_ClientList_Client::CopyFrom(const Response_ClientList_Client& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Response_ClientList_Client::IsInitialized() const {
+
+  return true;
+}
+
+void Response_ClientList_Client::Swap(Response_ClientList_Client* other) {
+  if (other != this) {
+    std::swap(fd_, other->fd_);
+    std::swap(peer_, other->peer_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata Response_ClientList_Client::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = Response_ClientList_Client_descriptor_;
+  metadata.reflection = Response_ClientList_Client_reflection_;
+  return metadata;
+}
+
+
+// -------------------------------------------------------------------
+
+#ifndef _MSC_VER
+const int Response_ClientList::kClientsFieldNumber;
+#endif  // !_MSC_VER
+
+Response_ClientList::Response_ClientList()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:lms.Response.ClientList)
+}
+
+void Response_ClientList::InitAsDefaultInstance() {
+}
+
+Response_ClientList::Response_ClientList(const Response_ClientList& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:lms.Response.ClientList)
+}
+
+void Response_ClientList::SharedCtor() {
+  _cached_size_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+Response_ClientList::~Response_ClientList() {
+  // @@protoc_insertion_point(destructor:lms.Response.ClientList)
+  SharedDtor();
+}
+
+void Response_ClientList::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void Response_ClientList::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* Response_ClientList::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return Response_ClientList_descriptor_;
+}
+
+const Response_ClientList& Response_ClientList::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_messages_2eproto();
+  return *default_instance_;
+}
+
+Response_ClientList* Response_ClientList::default_instance_ = NULL;
+
+Response_ClientList* Response_ClientList::New() const {
+  return new Response_ClientList;
+}
+
+void Response_ClientList::Clear() {
+  clients_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool Response_ClientList::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:lms.Response.ClientList)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // repeated .lms.Response.ClientList.Client clients = 1;
+      case 1: {
+        if (tag == 10) {
+         parse_clients:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_clients()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(10)) goto parse_clients;
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:lms.Response.ClientList)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:lms.Response.ClientList)
+  return false;
+#undef DO_
+}
+
+void Response_ClientList::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:lms.Response.ClientList)
+  // repeated .lms.Response.ClientList.Client clients = 1;
+  for (int i = 0; i < this->clients_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, this->clients(i), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:lms.Response.ClientList)
+}
+
+::google::protobuf::uint8* Response_ClientList::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:lms.Response.ClientList)
+  // repeated .lms.Response.ClientList.Client clients = 1;
+  for (int i = 0; i < this->clients_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        1, this->clients(i), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:lms.Response.ClientList)
+  return target;
+}
+
+int Response_ClientList::ByteSize() const {
+  int total_size = 0;
+
+  // repeated .lms.Response.ClientList.Client clients = 1;
+  total_size += 1 * this->clients_size();
+  for (int i = 0; i < this->clients_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->clients(i));
+  }
+
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void Response_ClientList::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const Response_ClientList* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Response_ClientList*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void Response_ClientList::MergeFrom(const Response_ClientList& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  clients_.MergeFrom(from.clients_);
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void Response_ClientList::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Response_ClientList::CopyFrom(const Response_ClientList& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Response_ClientList::IsInitialized() const {
+
+  return true;
+}
+
+void Response_ClientList::Swap(Response_ClientList* other) {
+  if (other != this) {
+    clients_.Swap(&other->clients_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata Response_ClientList::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = Response_ClientList_descriptor_;
+  metadata.reflection = Response_ClientList_reflection_;
+  return metadata;
+}
+
+
+// -------------------------------------------------------------------
+
+#ifndef _MSC_VER
+const int Response_ProcessList_Process::kPidFieldNumber;
+const int Response_ProcessList_Process::kConfigFileFieldNumber;
+const int Response_ProcessList_Process::kNameFieldNumber;
+#endif  // !_MSC_VER
+
+Response_ProcessList_Process::Response_ProcessList_Process()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:lms.Response.ProcessList.Process)
+}
+
+void Response_ProcessList_Process::InitAsDefaultInstance() {
+}
+
+Response_ProcessList_Process::Response_ProcessList_Process(const Response_ProcessList_Process& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:lms.Response.ProcessList.Process)
+}
+
+void Response_ProcessList_Process::SharedCtor() {
+  ::google::protobuf::internal::GetEmptyString();
+  _cached_size_ = 0;
+  pid_ = 0;
+  config_file_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+Response_ProcessList_Process::~Response_ProcessList_Process() {
+  // @@protoc_insertion_point(destructor:lms.Response.ProcessList.Process)
+  SharedDtor();
+}
+
+void Response_ProcessList_Process::SharedDtor() {
+  if (config_file_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete config_file_;
+  }
+  if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete name_;
+  }
+  if (this != default_instance_) {
+  }
+}
+
+void Response_ProcessList_Process::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* Response_ProcessList_Process::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return Response_ProcessList_Process_descriptor_;
+}
+
+const Response_ProcessList_Process& Response_ProcessList_Process::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_messages_2eproto();
+  return *default_instance_;
+}
+
+Response_ProcessList_Process* Response_ProcessList_Process::default_instance_ = NULL;
+
+Response_ProcessList_Process* Response_ProcessList_Process::New() const {
+  return new Response_ProcessList_Process;
+}
+
+void Response_ProcessList_Process::Clear() {
+  if (_has_bits_[0 / 32] & 7) {
+    pid_ = 0;
+    if (has_config_file()) {
+      if (config_file_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        config_file_->clear();
+      }
+    }
+    if (has_name()) {
+      if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        name_->clear();
+      }
+    }
+  }
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool Response_ProcessList_Process::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:lms.Response.ProcessList.Process)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 pid = 1;
+      case 1: {
+        if (tag == 8) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &pid_)));
+          set_has_pid();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(18)) goto parse_config_file;
+        break;
+      }
+
+      // optional string config_file = 2;
+      case 2: {
+        if (tag == 18) {
+         parse_config_file:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_config_file()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->config_file().data(), this->config_file().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "config_file");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(26)) goto parse_name;
+        break;
+      }
+
+      // optional string name = 3;
+      case 3: {
+        if (tag == 26) {
+         parse_name:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_name()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->name().data(), this->name().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "name");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectAtEnd()) goto success;
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormat::SkipField(
+              input, tag, mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:lms.Response.ProcessList.Process)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:lms.Response.ProcessList.Process)
+  return false;
+#undef DO_
+}
+
+void Response_ProcessList_Process::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:lms.Response.ProcessList.Process)
+  // optional int32 pid = 1;
+  if (has_pid()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->pid(), output);
+  }
+
+  // optional string config_file = 2;
+  if (has_config_file()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->config_file().data(), this->config_file().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "config_file");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->config_file(), output);
+  }
+
+  // optional string name = 3;
+  if (has_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->name().data(), this->name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "name");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      3, this->name(), output);
+  }
+
+  if (!unknown_fields().empty()) {
+    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
+        unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:lms.Response.ProcessList.Process)
+}
+
+::google::protobuf::uint8* Response_ProcessList_Process::SerializeWithCachedSizesToArray(
+    ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:lms.Response.ProcessList.Process)
+  // optional int32 pid = 1;
+  if (has_pid()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->pid(), target);
+  }
+
+  // optional string config_file = 2;
+  if (has_config_file()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->config_file().data(), this->config_file().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "config_file");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->config_file(), target);
+  }
+
+  // optional string name = 3;
+  if (has_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->name().data(), this->name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "name");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        3, this->name(), target);
+  }
+
+  if (!unknown_fields().empty()) {
+    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
+        unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:lms.Response.ProcessList.Process)
+  return target;
+}
+
+int Response_ProcessList_Process::ByteSize() const {
+  int total_size = 0;
+
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional int32 pid = 1;
+    if (has_pid()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->pid());
+    }
+
+    // optional string config_file = 2;
+    if (has_config_file()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->config_file());
+    }
+
+    // optional string name = 3;
+    if (has_name()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->name());
+    }
+
+  }
+  if (!unknown_fields().empty()) {
+    total_size +=
+      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
+        unknown_fields());
+  }
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = total_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void Response_ProcessList_Process::MergeFrom(const ::google::protobuf::Message& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  const Response_ProcessList_Process* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Response_ProcessList_Process*>(
+      &from);
+  if (source == NULL) {
+    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
+  } else {
+    MergeFrom(*source);
+  }
+}
+
+void Response_ProcessList_Process::MergeFrom(const Response_ProcessList_Process& from) {
+  GOOGLE_CHECK_NE(&from, this);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_pid()) {
+      set_pid(from.pid());
+    }
+    if (from.has_config_file()) {
+      set_config_file(from.config_file());
+    }
+    if (from.has_name()) {
+      set_name(from.name());
+    }
+  }
+  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+}
+
+void Response_ProcessList_Process::CopyFrom(const ::google::protobuf::Message& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void Response_ProcessList_Process::CopyFrom(const Response_ProcessList_Process& from) {
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Response_ProcessList_Process::IsInitialized() const {
+
+  return true;
+}
+
+void Response_ProcessList_Process::Swap(Response_ProcessList_Process* other) {
+  if (other != this) {
+    std::swap(pid_, other->pid_);
+    std::swap(config_file_, other->config_file_);
+    std::swap(name_, other->name_);
+    std::swap(_has_bits_[0], other->_has_bits_[0]);
+    _unknown_fields_.Swap(&other->_unknown_fields_);
+    std::swap(_cached_size_, other->_cached_size_);
+  }
+}
+
+::google::protobuf::Metadata Response_ProcessList_Process::GetMetadata() const {
+  protobuf_AssignDescriptorsOnce();
+  ::google::protobuf::Metadata metadata;
+  metadata.descriptor = Response_ProcessList_Process_descriptor_;
+  metadata.reflection = Response_ProcessList_Process_reflection_;
+  return metadata;
+}
+
+
+// -------------------------------------------------------------------
+
+#ifndef _MSC_VER
+const int Response_ProcessList::kProcessesFieldNumber;
+#endif  // !_MSC_VER
+
+Response_ProcessList::Response_ProcessList()
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:lms.Response.ProcessList)
+}
+
+void Response_ProcessList::InitAsDefaultInstance() {
+}
+
+Response_ProcessList::Response_ProcessList(const Response_ProcessList& from)
+  : ::google::protobuf::Message() {
+  SharedCtor();
+  MergeFrom(from);
+  // @@protoc_insertion_point(copy_constructor:lms.Response.ProcessList)
+}
+
+void Response_ProcessList::SharedCtor() {
+  _cached_size_ = 0;
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+}
+
+Response_ProcessList::~Response_ProcessList() {
+  // @@protoc_insertion_point(destructor:lms.Response.ProcessList)
+  SharedDtor();
+}
+
+void Response_ProcessList::SharedDtor() {
+  if (this != default_instance_) {
+  }
+}
+
+void Response_ProcessList::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const ::google::protobuf::Descriptor* Response_ProcessList::descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return Response_ProcessList_descriptor_;
+}
+
+const Response_ProcessList& Response_ProcessList::default_instance() {
+  if (default_instance_ == NULL) protobuf_AddDesc_messages_2eproto();
+  return *default_instance_;
+}
+
+Response_ProcessList* Response_ProcessList::default_instance_ = NULL;
+
+Response_ProcessList* Response_ProcessList::New() const {
+  return new Response_ProcessList;
+}
+
+void Response_ProcessList::Clear() {
+  processes_.Clear();
+  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  mutable_unknown_fields()->Clear();
+}
+
+bool Response_ProcessList::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:lms.Response.ClientList.Client)
+  // @@protoc_insertion_point(parse_start:lms.Response.ProcessList)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional int32 fd = 1;
+      // repeated .lms.Response.ProcessList.Process processes = 1;
       case 1: {
-        if (tag == 8) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &fd_)));
-          set_has_fd();
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(18)) goto parse_peer;
-        break;
-      }
-
-      // optional string peer = 2;
-      case 2: {
-        if (tag == 18) {
-         parse_peer:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_peer()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->peer().data(), this->peer().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "peer");
+        if (tag == 10) {
+         parse_processes:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_processes()));
         } else {
           goto handle_unusual;
         }
+        if (input->ExpectTag(10)) goto parse_processes;
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -6309,85 +7876,59 @@ bool Response_ClientList_Client::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:lms.Response.ClientList.Client)
+  // @@protoc_insertion_point(parse_success:lms.Response.ProcessList)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:lms.Response.ClientList.Client)
+  // @@protoc_insertion_point(parse_failure:lms.Response.ProcessList)
   return false;
 #undef DO_
 }
 
-void Response_ClientList_Client::SerializeWithCachedSizes(
+void Response_ProcessList::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:lms.Response.ClientList.Client)
-  // optional int32 fd = 1;
-  if (has_fd()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->fd(), output);
-  }
-
-  // optional string peer = 2;
-  if (has_peer()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->peer().data(), this->peer().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "peer");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->peer(), output);
+  // @@protoc_insertion_point(serialize_start:lms.Response.ProcessList)
+  // repeated .lms.Response.ProcessList.Process processes = 1;
+  for (int i = 0; i < this->processes_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, this->processes(i), output);
   }
 
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:lms.Response.ClientList.Client)
+  // @@protoc_insertion_point(serialize_end:lms.Response.ProcessList)
 }
 
-::google::protobuf::uint8* Response_ClientList_Client::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* Response_ProcessList::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:lms.Response.ClientList.Client)
-  // optional int32 fd = 1;
-  if (has_fd()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->fd(), target);
-  }
-
-  // optional string peer = 2;
-  if (has_peer()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->peer().data(), this->peer().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "peer");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->peer(), target);
+  // @@protoc_insertion_point(serialize_to_array_start:lms.Response.ProcessList)
+  // repeated .lms.Response.ProcessList.Process processes = 1;
+  for (int i = 0; i < this->processes_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        1, this->processes(i), target);
   }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:lms.Response.ClientList.Client)
+  // @@protoc_insertion_point(serialize_to_array_end:lms.Response.ProcessList)
   return target;
 }
 
-int Response_ClientList_Client::ByteSize() const {
+int Response_ProcessList::ByteSize() const {
   int total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional int32 fd = 1;
-    if (has_fd()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->fd());
-    }
-
-    // optional string peer = 2;
-    if (has_peer()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->peer());
-    }
-
+  // repeated .lms.Response.ProcessList.Process processes = 1;
+  total_size += 1 * this->processes_size();
+  for (int i = 0; i < this->processes_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->processes(i));
   }
+
   if (!unknown_fields().empty()) {
     total_size +=
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
@@ -6399,10 +7940,10 @@ int Response_ClientList_Client::ByteSize() const {
   return total_size;
 }
 
-void Response_ClientList_Client::MergeFrom(const ::google::protobuf::Message& from) {
+void Response_ProcessList::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const Response_ClientList_Client* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Response_ClientList_Client*>(
+  const Response_ProcessList* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Response_ProcessList*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -6411,139 +7952,206 @@ void Response_ClientList_Client::MergeFrom(const ::google::protobuf::Message& fr
   }
 }
 
-void Response_ClientList_Client::MergeFrom(const Response_ClientList_Client& from) {
+void Response_ProcessList::MergeFrom(const Response_ProcessList& from) {
   GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_fd()) {
-      set_fd(from.fd());
-    }
-    if (from.has_peer()) {
-      set_peer(from.peer());
-    }
-  }
+  processes_.MergeFrom(from.processes_);
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void Response_ClientList_Client::CopyFrom(const ::google::protobuf::Message& from) {
+void Response_ProcessList::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Response_ClientList_Client::CopyFrom(const Response_ClientList_Client& from) {
+void Response_ProcessList::CopyFrom(const Response_ProcessList& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Response_ClientList_Client::IsInitialized() const {
+bool Response_ProcessList::IsInitialized() const {
 
   return true;
 }
 
-void Response_ClientList_Client::Swap(Response_ClientList_Client* other) {
+void Response_ProcessList::Swap(Response_ProcessList* other) {
   if (other != this) {
-    std::swap(fd_, other->fd_);
-    std::swap(peer_, other->peer_);
+    processes_.Swap(&other->processes_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata Response_ClientList_Client::GetMetadata() const {
+::google::protobuf::Metadata Response_ProcessList::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Response_ClientList_Client_descriptor_;
-  metadata.reflection = Response_ClientList_Client_reflection_;
+  metadata.descriptor = Response_ProcessList_descriptor_;
+  metadata.reflection = Response_ProcessList_reflection_;
   return metadata;
 }
 
 
 // -------------------------------------------------------------------
 
+const ::google::protobuf::EnumDescriptor* Response_ModuleListResponse_Permission_descriptor() {
+  protobuf_AssignDescriptorsOnce();
+  return Response_ModuleListResponse_Permission_descriptor_;
+}
+bool Response_ModuleListResponse_Permission_IsValid(int value) {
+  switch(value) {
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
 #ifndef _MSC_VER
-const int Response_ClientList::kClientsFieldNumber;
+const Response_ModuleListResponse_Permission Response_ModuleListResponse::READ;
+const Response_ModuleListResponse_Permission Response_ModuleListResponse::WRITE;
+const Response_ModuleListResponse_Permission Response_ModuleListResponse::Permission_MIN;
+const Response_ModuleListResponse_Permission Response_ModuleListResponse::Permission_MAX;
+const int Response_ModuleListResponse::Permission_ARRAYSIZE;
+#endif  // _MSC_VER
+#ifndef _MSC_VER
+const int Response_ModuleListResponse_Access::kModuleFieldNumber;
+const int Response_ModuleListResponse_Access::kPermissionFieldNumber;
+const int Response_ModuleListResponse_Access::kPriorityFieldNumber;
 #endif  // !_MSC_VER
 
-Response_ClientList::Response_ClientList()
+Response_ModuleListResponse_Access::Response_ModuleListResponse_Access()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:lms.Response.ClientList)
+  // @@protoc_insertion_point(constructor:lms.Response.ModuleListResponse.Access)
 }
 
-void Response_ClientList::InitAsDefaultInstance() {
+void Response_ModuleListResponse_Access::InitAsDefaultInstance() {
 }
 
-Response_ClientList::Response_ClientList(const Response_ClientList& from)
+Response_ModuleListResponse_Access::Response_ModuleListResponse_Access(const Response_ModuleListResponse_Access& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:lms.Response.ClientList)
+  // @@protoc_insertion_point(copy_constructor:lms.Response.ModuleListResponse.Access)
 }
 
-void Response_ClientList::SharedCtor() {
+void Response_ModuleListResponse_Access::SharedCtor() {
+  ::google::protobuf::internal::GetEmptyString();
   _cached_size_ = 0;
+  module_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  permission_ = 1;
+  priority_ = 0;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-Response_ClientList::~Response_ClientList() {
-  // @@protoc_insertion_point(destructor:lms.Response.ClientList)
+Response_ModuleListResponse_Access::~Response_ModuleListResponse_Access() {
+  // @@protoc_insertion_point(destructor:lms.Response.ModuleListResponse.Access)
   SharedDtor();
 }
 
-void Response_ClientList::SharedDtor() {
+void Response_ModuleListResponse_Access::SharedDtor() {
+  if (module_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete module_;
+  }
   if (this != default_instance_) {
   }
 }
 
-void Response_ClientList::SetCachedSize(int size) const {
+void Response_ModuleListResponse_Access::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* Response_ClientList::descriptor() {
+const ::google::protobuf::Descriptor* Response_ModuleListResponse_Access::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return Response_ClientList_descriptor_;
+  return Response_ModuleListResponse_Access_descriptor_;
 }
 
-const Response_ClientList& Response_ClientList::default_instance() {
+const Response_ModuleListResponse_Access& Response_ModuleListResponse_Access::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_messages_2eproto();
   return *default_instance_;
 }
 
-Response_ClientList* Response_ClientList::default_instance_ = NULL;
+Response_ModuleListResponse_Access* Response_ModuleListResponse_Access::default_instance_ = NULL;
 
-Response_ClientList* Response_ClientList::New() const {
-  return new Response_ClientList;
+Response_ModuleListResponse_Access* Response_ModuleListResponse_Access::New() const {
+  return new Response_ModuleListResponse_Access;
 }
 
-void Response_ClientList::Clear() {
-  clients_.Clear();
+void Response_ModuleListResponse_Access::Clear() {
+  if (_has_bits_[0 / 32] & 7) {
+    if (has_module()) {
+      if (module_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        module_->clear();
+      }
+    }
+    permission_ = 1;
+    priority_ = 0;
+  }
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool Response_ClientList::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
-  ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:lms.Response.ClientList)
-  for (;;) {
-    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
-    tag = p.first;
-    if (!p.second) goto handle_unusual;
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated .lms.Response.ClientList.Client clients = 1;
-      case 1: {
-        if (tag == 10) {
-         parse_clients:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_clients()));
+bool Response_ModuleListResponse_Access::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  // @@protoc_insertion_point(parse_start:lms.Response.ModuleListResponse.Access)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional string module = 1;
+      case 1: {
+        if (tag == 10) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_module()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->module().data(), this->module().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "module");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(16)) goto parse_permission;
+        break;
+      }
+
+      // optional .lms.Response.ModuleListResponse.Permission permission = 2;
+      case 2: {
+        if (tag == 16) {
+         parse_permission:
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::lms::Response_ModuleListResponse_Permission_IsValid(value)) {
+            set_permission(static_cast< ::lms::Response_ModuleListResponse_Permission >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(2, value);
+          }
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(24)) goto parse_priority;
+        break;
+      }
+
+      // optional int32 priority = 3;
+      case 3: {
+        if (tag == 24) {
+         parse_priority:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &priority_)));
+          set_has_priority();
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(10)) goto parse_clients;
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -6562,59 +8170,103 @@ bool Response_ClientList::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:lms.Response.ClientList)
+  // @@protoc_insertion_point(parse_success:lms.Response.ModuleListResponse.Access)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:lms.Response.ClientList)
+  // @@protoc_insertion_point(parse_failure:lms.Response.ModuleListResponse.Access)
   return false;
 #undef DO_
 }
 
-void Response_ClientList::SerializeWithCachedSizes(
+void Response_ModuleListResponse_Access::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:lms.Response.ClientList)
-  // repeated .lms.Response.ClientList.Client clients = 1;
-  for (int i = 0; i < this->clients_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->clients(i), output);
+  // @@protoc_insertion_point(serialize_start:lms.Response.ModuleListResponse.Access)
+  // optional string module = 1;
+  if (has_module()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->module().data(), this->module().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "module");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->module(), output);
+  }
+
+  // optional .lms.Response.ModuleListResponse.Permission permission = 2;
+  if (has_permission()) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      2, this->permission(), output);
+  }
+
+  // optional int32 priority = 3;
+  if (has_priority()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->priority(), output);
   }
 
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:lms.Response.ClientList)
+  // @@protoc_insertion_point(serialize_end:lms.Response.ModuleListResponse.Access)
 }
 
-::google::protobuf::uint8* Response_ClientList::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* Response_ModuleListResponse_Access::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:lms.Response.ClientList)
-  // repeated .lms.Response.ClientList.Client clients = 1;
-  for (int i = 0; i < this->clients_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->clients(i), target);
+  // @@protoc_insertion_point(serialize_to_array_start:lms.Response.ModuleListResponse.Access)
+  // optional string module = 1;
+  if (has_module()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->module().data(), this->module().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "module");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->module(), target);
+  }
+
+  // optional .lms.Response.ModuleListResponse.Permission permission = 2;
+  if (has_permission()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      2, this->permission(), target);
+  }
+
+  // optional int32 priority = 3;
+  if (has_priority()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->priority(), target);
   }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:lms.Response.ClientList)
+  // @@protoc_insertion_point(serialize_to_array_end:lms.Response.ModuleListResponse.Access)
   return target;
 }
 
-int Response_ClientList::ByteSize() const {
+int Response_ModuleListResponse_Access::ByteSize() const {
   int total_size = 0;
 
-  // repeated .lms.Response.ClientList.Client clients = 1;
-  total_size += 1 * this->clients_size();
-  for (int i = 0; i < this->clients_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->clients(i));
-  }
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional string module = 1;
+    if (has_module()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->module());
+    }
+
+    // optional .lms.Response.ModuleListResponse.Permission permission = 2;
+    if (has_permission()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->permission());
+    }
+
+    // optional int32 priority = 3;
+    if (has_priority()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->priority());
+    }
 
+  }
   if (!unknown_fields().empty()) {
     total_size +=
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
@@ -6626,10 +8278,10 @@ int Response_ClientList::ByteSize() const {
   return total_size;
 }
 
-void Response_ClientList::MergeFrom(const ::google::protobuf::Message& from) {
+void Response_ModuleListResponse_Access::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const Response_ClientList* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Response_ClientList*>(
+  const Response_ModuleListResponse_Access* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Response_ModuleListResponse_Access*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -6638,43 +8290,55 @@ void Response_ClientList::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void Response_ClientList::MergeFrom(const Response_ClientList& from) {
+void Response_ModuleListResponse_Access::MergeFrom(const Response_ModuleListResponse_Access& from) {
   GOOGLE_CHECK_NE(&from, this);
-  clients_.MergeFrom(from.clients_);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_module()) {
+      set_module(from.module());
+    }
+    if (from.has_permission()) {
+      set_permission(from.permission());
+    }
+    if (from.has_priority()) {
+      set_priority(from.priority());
+    }
+  }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void Response_ClientList::CopyFrom(const ::google::protobuf::Message& from) {
+void Response_ModuleListResponse_Access::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Response_ClientList::CopyFrom(const Response_ClientList& from) {
+void Response_ModuleListResponse_Access::CopyFrom(const Response_ModuleListResponse_Access& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Response_ClientList::IsInitialized() const {
+bool Response_ModuleListResponse_Access::IsInitialized() const {
 
   return true;
 }
 
-void Response_ClientList::Swap(Response_ClientList* other) {
+void Response_ModuleListResponse_Access::Swap(Response_ModuleListResponse_Access* other) {
   if (other != this) {
-    clients_.Swap(&other->clients_);
+    std::swap(module_, other->module_);
+    std::swap(permission_, other->permission_);
+    std::swap(priority_, other->priority_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata Response_ClientList::GetMetadata() const {
+::google::protobuf::Metadata Response_ModuleListResponse_Access::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Response_ClientList_descriptor_;
-  metadata.reflection = Response_ClientList_reflection_;
+  metadata.descriptor = Response_ModuleListResponse_Access_descriptor_;
+  metadata.reflection = Response_ModuleListResponse_Access_reflection_;
   return metadata;
 }
 
@@ -6682,45 +8346,39 @@ void Response_ClientList::Swap(Response_ClientList* other) {
 // -------------------------------------------------------------------
 
 #ifndef _MSC_VER
-const int Response_ProcessList_Process::kPidFieldNumber;
-const int Response_ProcessList_Process::kConfigFileFieldNumber;
-const int Response_ProcessList_Process::kNameFieldNumber;
+const int Response_ModuleListResponse_Channel::kNameFieldNumber;
+const int Response_ModuleListResponse_Channel::kAccessListFieldNumber;
 #endif  // !_MSC_VER
 
-Response_ProcessList_Process::Response_ProcessList_Process()
+Response_ModuleListResponse_Channel::Response_ModuleListResponse_Channel()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:lms.Response.ProcessList.Process)
+  // @@protoc_insertion_point(constructor:lms.Response.ModuleListResponse.Channel)
 }
 
-void Response_ProcessList_Process::InitAsDefaultInstance() {
+void Response_ModuleListResponse_Channel::InitAsDefaultInstance() {
 }
 
-Response_ProcessList_Process::Response_ProcessList_Process(const Response_ProcessList_Process& from)
+Response_ModuleListResponse_Channel::Response_ModuleListResponse_Channel(const Response_ModuleListResponse_Channel& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:lms.Response.ProcessList.Process)
+  // @@protoc_insertion_point(copy_constructor:lms.Response.ModuleListResponse.Channel)
 }
 
-void Response_ProcessList_Process::SharedCtor() {
+void Response_ModuleListResponse_Channel::SharedCtor() {
   ::google::protobuf::internal::GetEmptyString();
   _cached_size_ = 0;
-  pid_ = 0;
-  config_file_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-Response_ProcessList_Process::~Response_ProcessList_Process() {
-  // @@protoc_insertion_point(destructor:lms.Response.ProcessList.Process)
+Response_ModuleListResponse_Channel::~Response_ModuleListResponse_Channel() {
+  // @@protoc_insertion_point(destructor:lms.Response.ModuleListResponse.Channel)
   SharedDtor();
 }
 
-void Response_ProcessList_Process::SharedDtor() {
-  if (config_file_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete config_file_;
-  }
+void Response_ModuleListResponse_Channel::SharedDtor() {
   if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
     delete name_;
   }
@@ -6728,99 +8386,74 @@ void Response_ProcessList_Process::SharedDtor() {
   }
 }
 
-void Response_ProcessList_Process::SetCachedSize(int size) const {
+void Response_ModuleListResponse_Channel::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* Response_ProcessList_Process::descriptor() {
+const ::google::protobuf::Descriptor* Response_ModuleListResponse_Channel::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return Response_ProcessList_Process_descriptor_;
+  return Response_ModuleListResponse_Channel_descriptor_;
 }
 
-const Response_ProcessList_Process& Response_ProcessList_Process::default_instance() {
+const Response_ModuleListResponse_Channel& Response_ModuleListResponse_Channel::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_messages_2eproto();
   return *default_instance_;
 }
 
-Response_ProcessList_Process* Response_ProcessList_Process::default_instance_ = NULL;
+Response_ModuleListResponse_Channel* Response_ModuleListResponse_Channel::default_instance_ = NULL;
 
-Response_ProcessList_Process* Response_ProcessList_Process::New() const {
-  return new Response_ProcessList_Process;
+Response_ModuleListResponse_Channel* Response_ModuleListResponse_Channel::New() const {
+  return new Response_ModuleListResponse_Channel;
 }
 
-void Response_ProcessList_Process::Clear() {
-  if (_has_bits_[0 / 32] & 7) {
-    pid_ = 0;
-    if (has_config_file()) {
-      if (config_file_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-        config_file_->clear();
-      }
-    }
-    if (has_name()) {
-      if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-        name_->clear();
-      }
+void Response_ModuleListResponse_Channel::Clear() {
+  if (has_name()) {
+    if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+      name_->clear();
     }
   }
+  access_list_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool Response_ProcessList_Process::MergePartialFromCodedStream(
+bool Response_ModuleListResponse_Channel::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:lms.Response.ProcessList.Process)
+  // @@protoc_insertion_point(parse_start:lms.Response.ModuleListResponse.Channel)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional int32 pid = 1;
+      // optional string name = 1;
       case 1: {
-        if (tag == 8) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &pid_)));
-          set_has_pid();
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(18)) goto parse_config_file;
-        break;
-      }
-
-      // optional string config_file = 2;
-      case 2: {
-        if (tag == 18) {
-         parse_config_file:
+        if (tag == 10) {
           DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_config_file()));
+                input, this->mutable_name()));
           ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->config_file().data(), this->config_file().length(),
+            this->name().data(), this->name().length(),
             ::google::protobuf::internal::WireFormat::PARSE,
-            "config_file");
+            "name");
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(26)) goto parse_name;
+        if (input->ExpectTag(18)) goto parse_access_list;
         break;
       }
 
-      // optional string name = 3;
-      case 3: {
-        if (tag == 26) {
-         parse_name:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "name");
+      // repeated .lms.Response.ModuleListResponse.Access access_list = 2;
+      case 2: {
+        if (tag == 18) {
+         parse_access_list:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_access_list()));
         } else {
           goto handle_unusual;
         }
+        if (input->ExpectTag(18)) goto parse_access_list;
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -6839,69 +8472,44 @@ bool Response_ProcessList_Process::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:lms.Response.ProcessList.Process)
+  // @@protoc_insertion_point(parse_success:lms.Response.ModuleListResponse.Channel)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:lms.Response.ProcessList.Process)
+  // @@protoc_insertion_point(parse_failure:lms.Response.ModuleListResponse.Channel)
   return false;
 #undef DO_
 }
 
-void Response_ProcessList_Process::SerializeWithCachedSizes(
+void Response_ModuleListResponse_Channel::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:lms.Response.ProcessList.Process)
-  // optional int32 pid = 1;
-  if (has_pid()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->pid(), output);
-  }
-
-  // optional string config_file = 2;
-  if (has_config_file()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->config_file().data(), this->config_file().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "config_file");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->config_file(), output);
-  }
-
-  // optional string name = 3;
+  // @@protoc_insertion_point(serialize_start:lms.Response.ModuleListResponse.Channel)
+  // optional string name = 1;
   if (has_name()) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
       this->name().data(), this->name().length(),
       ::google::protobuf::internal::WireFormat::SERIALIZE,
       "name");
     ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      3, this->name(), output);
+      1, this->name(), output);
+  }
+
+  // repeated .lms.Response.ModuleListResponse.Access access_list = 2;
+  for (int i = 0; i < this->access_list_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      2, this->access_list(i), output);
   }
 
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:lms.Response.ProcessList.Process)
+  // @@protoc_insertion_point(serialize_end:lms.Response.ModuleListResponse.Channel)
 }
 
-::google::protobuf::uint8* Response_ProcessList_Process::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* Response_ModuleListResponse_Channel::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:lms.Response.ProcessList.Process)
-  // optional int32 pid = 1;
-  if (has_pid()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->pid(), target);
-  }
-
-  // optional string config_file = 2;
-  if (has_config_file()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->config_file().data(), this->config_file().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "config_file");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->config_file(), target);
-  }
-
-  // optional string name = 3;
+  // @@protoc_insertion_point(serialize_to_array_start:lms.Response.ModuleListResponse.Channel)
+  // optional string name = 1;
   if (has_name()) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
       this->name().data(), this->name().length(),
@@ -6909,36 +8517,29 @@ void Response_ProcessList_Process::SerializeWithCachedSizes(
       "name");
     target =
       ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->name(), target);
+        1, this->name(), target);
+  }
+
+  // repeated .lms.Response.ModuleListResponse.Access access_list = 2;
+  for (int i = 0; i < this->access_list_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        2, this->access_list(i), target);
   }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:lms.Response.ProcessList.Process)
+  // @@protoc_insertion_point(serialize_to_array_end:lms.Response.ModuleListResponse.Channel)
   return target;
 }
 
-int Response_ProcessList_Process::ByteSize() const {
+int Response_ModuleListResponse_Channel::ByteSize() const {
   int total_size = 0;
 
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional int32 pid = 1;
-    if (has_pid()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->pid());
-    }
-
-    // optional string config_file = 2;
-    if (has_config_file()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->config_file());
-    }
-
-    // optional string name = 3;
+    // optional string name = 1;
     if (has_name()) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::StringSize(
@@ -6946,6 +8547,14 @@ int Response_ProcessList_Process::ByteSize() const {
     }
 
   }
+  // repeated .lms.Response.ModuleListResponse.Access access_list = 2;
+  total_size += 1 * this->access_list_size();
+  for (int i = 0; i < this->access_list_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->access_list(i));
+  }
+
   if (!unknown_fields().empty()) {
     total_size +=
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
@@ -6957,10 +8566,10 @@ int Response_ProcessList_Process::ByteSize() const {
   return total_size;
 }
 
-void Response_ProcessList_Process::MergeFrom(const ::google::protobuf::Message& from) {
+void Response_ModuleListResponse_Channel::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const Response_ProcessList_Process* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Response_ProcessList_Process*>(
+  const Response_ModuleListResponse_Channel* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Response_ModuleListResponse_Channel*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -6969,15 +8578,10 @@ void Response_ProcessList_Process::MergeFrom(const ::google::protobuf::Message&
   }
 }
 
-void Response_ProcessList_Process::MergeFrom(const Response_ProcessList_Process& from) {
+void Response_ModuleListResponse_Channel::MergeFrom(const Response_ModuleListResponse_Channel& from) {
   GOOGLE_CHECK_NE(&from, this);
+  access_list_.MergeFrom(from.access_list_);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_pid()) {
-      set_pid(from.pid());
-    }
-    if (from.has_config_file()) {
-      set_config_file(from.config_file());
-    }
     if (from.has_name()) {
       set_name(from.name());
     }
@@ -6985,39 +8589,38 @@ void Response_ProcessList_Process::MergeFrom(const Response_ProcessList_Process&
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void Response_ProcessList_Process::CopyFrom(const ::google::protobuf::Message& from) {
+void Response_ModuleListResponse_Channel::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Response_ProcessList_Process::CopyFrom(const Response_ProcessList_Process& from) {
+void Response_ModuleListResponse_Channel::CopyFrom(const Response_ModuleListResponse_Channel& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Response_ProcessList_Process::IsInitialized() const {
+bool Response_ModuleListResponse_Channel::IsInitialized() const {
 
   return true;
 }
 
-void Response_ProcessList_Process::Swap(Response_ProcessList_Process* other) {
+void Response_ModuleListResponse_Channel::Swap(Response_ModuleListResponse_Channel* other) {
   if (other != this) {
-    std::swap(pid_, other->pid_);
-    std::swap(config_file_, other->config_file_);
     std::swap(name_, other->name_);
+    access_list_.Swap(&other->access_list_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata Response_ProcessList_Process::GetMetadata() const {
+::google::protobuf::Metadata Response_ModuleListResponse_Channel::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Response_ProcessList_Process_descriptor_;
-  metadata.reflection = Response_ProcessList_Process_reflection_;
+  metadata.descriptor = Response_ModuleListResponse_Channel_descriptor_;
+  metadata.reflection = Response_ModuleListResponse_Channel_reflection_;
   return metadata;
 }
 
@@ -7025,87 +8628,87 @@ void Response_ProcessList_Process::Swap(Response_ProcessList_Process* other) {
 // -------------------------------------------------------------------
 
 #ifndef _MSC_VER
-const int Response_ProcessList::kProcessesFieldNumber;
+const int Response_ModuleListResponse::kChannelsFieldNumber;
 #endif  // !_MSC_VER
 
-Response_ProcessList::Response_ProcessList()
+Response_ModuleListResponse::Response_ModuleListResponse()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:lms.Response.ProcessList)
+  // @@protoc_insertion_point(constructor:lms.Response.ModuleListResponse)
 }
 
-void Response_ProcessList::InitAsDefaultInstance() {
+void Response_ModuleListResponse::InitAsDefaultInstance() {
 }
 
-Response_ProcessList::Response_ProcessList(const Response_ProcessList& from)
+Response_ModuleListResponse::Response_ModuleListResponse(const Response_ModuleListResponse& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:lms.Response.ProcessList)
+  // @@protoc_insertion_point(copy_constructor:lms.Response.ModuleListResponse)
 }
 
-void Response_ProcessList::SharedCtor() {
+void Response_ModuleListResponse::SharedCtor() {
   _cached_size_ = 0;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-Response_ProcessList::~Response_ProcessList() {
-  // @@protoc_insertion_point(destructor:lms.Response.ProcessList)
+Response_ModuleListResponse::~Response_ModuleListResponse() {
+  // @@protoc_insertion_point(destructor:lms.Response.ModuleListResponse)
   SharedDtor();
 }
 
-void Response_ProcessList::SharedDtor() {
+void Response_ModuleListResponse::SharedDtor() {
   if (this != default_instance_) {
   }
 }
 
-void Response_ProcessList::SetCachedSize(int size) const {
+void Response_ModuleListResponse::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* Response_ProcessList::descriptor() {
+const ::google::protobuf::Descriptor* Response_ModuleListResponse::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return Response_ProcessList_descriptor_;
+  return Response_ModuleListResponse_descriptor_;
 }
 
-const Response_ProcessList& Response_ProcessList::default_instance() {
+const Response_ModuleListResponse& Response_ModuleListResponse::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_messages_2eproto();
   return *default_instance_;
 }
 
-Response_ProcessList* Response_ProcessList::default_instance_ = NULL;
+Response_ModuleListResponse* Response_ModuleListResponse::default_instance_ = NULL;
 
-Response_ProcessList* Response_ProcessList::New() const {
-  return new Response_ProcessList;
+Response_ModuleListResponse* Response_ModuleListResponse::New() const {
+  return new Response_ModuleListResponse;
 }
 
-void Response_ProcessList::Clear() {
-  processes_.Clear();
+void Response_ModuleListResponse::Clear() {
+  channels_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool Response_ProcessList::MergePartialFromCodedStream(
+bool Response_ModuleListResponse::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:lms.Response.ProcessList)
+  // @@protoc_insertion_point(parse_start:lms.Response.ModuleListResponse)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated .lms.Response.ProcessList.Process processes = 1;
+      // repeated .lms.Response.ModuleListResponse.Channel channels = 1;
       case 1: {
         if (tag == 10) {
-         parse_processes:
+         parse_channels:
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_processes()));
+                input, add_channels()));
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(10)) goto parse_processes;
+        if (input->ExpectTag(10)) goto parse_channels;
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -7124,57 +8727,57 @@ bool Response_ProcessList::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:lms.Response.ProcessList)
+  // @@protoc_insertion_point(parse_success:lms.Response.ModuleListResponse)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:lms.Response.ProcessList)
+  // @@protoc_insertion_point(parse_failure:lms.Response.ModuleListResponse)
   return false;
 #undef DO_
 }
 
-void Response_ProcessList::SerializeWithCachedSizes(
+void Response_ModuleListResponse::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:lms.Response.ProcessList)
-  // repeated .lms.Response.ProcessList.Process processes = 1;
-  for (int i = 0; i < this->processes_size(); i++) {
+  // @@protoc_insertion_point(serialize_start:lms.Response.ModuleListResponse)
+  // repeated .lms.Response.ModuleListResponse.Channel channels = 1;
+  for (int i = 0; i < this->channels_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->processes(i), output);
+      1, this->channels(i), output);
   }
 
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:lms.Response.ProcessList)
+  // @@protoc_insertion_point(serialize_end:lms.Response.ModuleListResponse)
 }
 
-::google::protobuf::uint8* Response_ProcessList::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* Response_ModuleListResponse::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:lms.Response.ProcessList)
-  // repeated .lms.Response.ProcessList.Process processes = 1;
-  for (int i = 0; i < this->processes_size(); i++) {
+  // @@protoc_insertion_point(serialize_to_array_start:lms.Response.ModuleListResponse)
+  // repeated .lms.Response.ModuleListResponse.Channel channels = 1;
+  for (int i = 0; i < this->channels_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        1, this->processes(i), target);
+        1, this->channels(i), target);
   }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:lms.Response.ProcessList)
+  // @@protoc_insertion_point(serialize_to_array_end:lms.Response.ModuleListResponse)
   return target;
 }
 
-int Response_ProcessList::ByteSize() const {
+int Response_ModuleListResponse::ByteSize() const {
   int total_size = 0;
 
-  // repeated .lms.Response.ProcessList.Process processes = 1;
-  total_size += 1 * this->processes_size();
-  for (int i = 0; i < this->processes_size(); i++) {
+  // repeated .lms.Response.ModuleListResponse.Channel channels = 1;
+  total_size += 1 * this->channels_size();
+  for (int i = 0; i < this->channels_size(); i++) {
     total_size +=
       ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->processes(i));
+        this->channels(i));
   }
 
   if (!unknown_fields().empty()) {
@@ -7188,10 +8791,10 @@ int Response_ProcessList::ByteSize() const {
   return total_size;
 }
 
-void Response_ProcessList::MergeFrom(const ::google::protobuf::Message& from) {
+void Response_ModuleListResponse::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const Response_ProcessList* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Response_ProcessList*>(
+  const Response_ModuleListResponse* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Response_ModuleListResponse*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -7200,57 +8803,62 @@ void Response_ProcessList::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void Response_ProcessList::MergeFrom(const Response_ProcessList& from) {
+void Response_ModuleListResponse::MergeFrom(const Response_ModuleListResponse& from) {
   GOOGLE_CHECK_NE(&from, this);
-  processes_.MergeFrom(from.processes_);
+  channels_.MergeFrom(from.channels_);
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void Response_ProcessList::CopyFrom(const ::google::protobuf::Message& from) {
+void Response_ModuleListResponse::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Response_ProcessList::CopyFrom(const Response_ProcessList& from) {
+void Response_ModuleListResponse::CopyFrom(const Response_ModuleListResponse& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Response_ProcessList::IsInitialized() const {
+bool Response_ModuleListResponse::IsInitialized() const {
 
   return true;
 }
 
-void Response_ProcessList::Swap(Response_ProcessList* other) {
+void Response_ModuleListResponse::Swap(Response_ModuleListResponse* other) {
   if (other != this) {
-    processes_.Swap(&other->processes_);
+    channels_.Swap(&other->channels_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata Response_ProcessList::GetMetadata() const {
+::google::protobuf::Metadata Response_ModuleListResponse::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Response_ProcessList_descriptor_;
-  metadata.reflection = Response_ProcessList_reflection_;
+  metadata.descriptor = Response_ModuleListResponse_descriptor_;
+  metadata.reflection = Response_ModuleListResponse_reflection_;
   return metadata;
 }
 
 
 // -------------------------------------------------------------------
 
-const ::google::protobuf::EnumDescriptor* Response_ModuleListResponse_Permission_descriptor() {
+const ::google::protobuf::EnumDescriptor* Response_LogEvent_Level_descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return Response_ModuleListResponse_Permission_descriptor_;
+  return Response_LogEvent_Level_descriptor_;
 }
-bool Response_ModuleListResponse_Permission_IsValid(int value) {
+bool Response_LogEvent_Level_IsValid(int value) {
   switch(value) {
-    case 1:
-    case 2:
+    case 0:
+    case 10:
+    case 20:
+    case 30:
+    case 40:
+    case 50:
+    case 255:
       return true;
     default:
       return false;
@@ -7258,145 +8866,208 @@ bool Response_ModuleListResponse_Permission_IsValid(int value) {
 }
 
 #ifndef _MSC_VER
-const Response_ModuleListResponse_Permission Response_ModuleListResponse::READ;
-const Response_ModuleListResponse_Permission Response_ModuleListResponse::WRITE;
-const Response_ModuleListResponse_Permission Response_ModuleListResponse::Permission_MIN;
-const Response_ModuleListResponse_Permission Response_ModuleListResponse::Permission_MAX;
-const int Response_ModuleListResponse::Permission_ARRAYSIZE;
+const Response_LogEvent_Level Response_LogEvent::ALL;
+const Response_LogEvent_Level Response_LogEvent::PROFILE;
+const Response_LogEvent_Level Response_LogEvent::DEBUG;
+const Response_LogEvent_Level Response_LogEvent::INFO;
+const Response_LogEvent_Level Response_LogEvent::WARN;
+const Response_LogEvent_Level Response_LogEvent::ERROR;
+const Response_LogEvent_Level Response_LogEvent::OFF;
+const Response_LogEvent_Level Response_LogEvent::Level_MIN;
+const Response_LogEvent_Level Response_LogEvent::Level_MAX;
+const int Response_LogEvent::Level_ARRAYSIZE;
 #endif  // _MSC_VER
 #ifndef _MSC_VER
-const int Response_ModuleListResponse_Access::kModuleFieldNumber;
-const int Response_ModuleListResponse_Access::kPermissionFieldNumber;
-const int Response_ModuleListResponse_Access::kPriorityFieldNumber;
+const int Response_LogEvent::kLevelFieldNumber;
+const int Response_LogEvent::kTagFieldNumber;
+const int Response_LogEvent::kTextFieldNumber;
+const int Response_LogEvent::kCloseAfterFieldNumber;
+const int Response_LogEvent::kTimestampFieldNumber;
 #endif  // !_MSC_VER
 
-Response_ModuleListResponse_Access::Response_ModuleListResponse_Access()
+Response_LogEvent::Response_LogEvent()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:lms.Response.ModuleListResponse.Access)
+  // @@protoc_insertion_point(constructor:lms.Response.LogEvent)
 }
 
-void Response_ModuleListResponse_Access::InitAsDefaultInstance() {
+void Response_LogEvent::InitAsDefaultInstance() {
 }
 
-Response_ModuleListResponse_Access::Response_ModuleListResponse_Access(const Response_ModuleListResponse_Access& from)
+Response_LogEvent::Response_LogEvent(const Response_LogEvent& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:lms.Response.ModuleListResponse.Access)
+  // @@protoc_insertion_point(copy_constructor:lms.Response.LogEvent)
 }
 
-void Response_ModuleListResponse_Access::SharedCtor() {
+void Response_LogEvent::SharedCtor() {
   ::google::protobuf::internal::GetEmptyString();
   _cached_size_ = 0;
-  module_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  permission_ = 1;
-  priority_ = 0;
+  level_ = 0;
+  tag_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  text_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  close_after_ = false;
+  timestamp_ = GOOGLE_LONGLONG(0);
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-Response_ModuleListResponse_Access::~Response_ModuleListResponse_Access() {
-  // @@protoc_insertion_point(destructor:lms.Response.ModuleListResponse.Access)
+Response_LogEvent::~Response_LogEvent() {
+  // @@protoc_insertion_point(destructor:lms.Response.LogEvent)
   SharedDtor();
 }
 
-void Response_ModuleListResponse_Access::SharedDtor() {
-  if (module_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete module_;
+void Response_LogEvent::SharedDtor() {
+  if (tag_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete tag_;
+  }
+  if (text_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete text_;
   }
   if (this != default_instance_) {
   }
 }
 
-void Response_ModuleListResponse_Access::SetCachedSize(int size) const {
+void Response_LogEvent::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* Response_ModuleListResponse_Access::descriptor() {
+const ::google::protobuf::Descriptor* Response_LogEvent::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return Response_ModuleListResponse_Access_descriptor_;
+  return Response_LogEvent_descriptor_;
 }
 
-const Response_ModuleListResponse_Access& Response_ModuleListResponse_Access::default_instance() {
+const Response_LogEvent& Response_LogEvent::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_messages_2eproto();
   return *default_instance_;
 }
 
-Response_ModuleListResponse_Access* Response_ModuleListResponse_Access::default_instance_ = NULL;
+Response_LogEvent* Response_LogEvent::default_instance_ = NULL;
 
-Response_ModuleListResponse_Access* Response_ModuleListResponse_Access::New() const {
-  return new Response_ModuleListResponse_Access;
+Response_LogEvent* Response_LogEvent::New() const {
+  return new Response_LogEvent;
 }
 
-void Response_ModuleListResponse_Access::Clear() {
-  if (_has_bits_[0 / 32] & 7) {
-    if (has_module()) {
-      if (module_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-        module_->clear();
+void Response_LogEvent::Clear() {
+#define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
+  &reinterpret_cast<Response_LogEvent*>(16)->f) - \
+   reinterpret_cast<char*>(16))
+
+#define ZR_(first, last) do {                              \
+    size_t f = OFFSET_OF_FIELD_(first);                    \
+    size_t n = OFFSET_OF_FIELD_(last) - f + sizeof(last);  \
+    ::memset(&first, 0, n);                                \
+  } while (0)
+
+  if (_has_bits_[0 / 32] & 31) {
+    ZR_(level_, close_after_);
+    if (has_tag()) {
+      if (tag_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        tag_->clear();
       }
     }
-    permission_ = 1;
-    priority_ = 0;
+    if (has_text()) {
+      if (text_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        text_->clear();
+      }
+    }
+    timestamp_ = GOOGLE_LONGLONG(0);
   }
+
+#undef OFFSET_OF_FIELD_
+#undef ZR_
+
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool Response_ModuleListResponse_Access::MergePartialFromCodedStream(
+bool Response_LogEvent::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:lms.Response.ModuleListResponse.Access)
+  // @@protoc_insertion_point(parse_start:lms.Response.LogEvent)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional string module = 1;
+      // optional .lms.Response.LogEvent.Level level = 1;
       case 1: {
-        if (tag == 10) {
+        if (tag == 8) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::lms::Response_LogEvent_Level_IsValid(value)) {
+            set_level(static_cast< ::lms::Response_LogEvent_Level >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(1, value);
+          }
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(18)) goto parse_tag;
+        break;
+      }
+
+      // optional string tag = 2;
+      case 2: {
+        if (tag == 18) {
+         parse_tag:
           DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_module()));
+                input, this->mutable_tag()));
           ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->module().data(), this->module().length(),
+            this->tag().data(), this->tag().length(),
             ::google::protobuf::internal::WireFormat::PARSE,
-            "module");
+            "tag");
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(16)) goto parse_permission;
+        if (input->ExpectTag(26)) goto parse_text;
         break;
       }
 
-      // optional .lms.Response.ModuleListResponse.Permission permission = 2;
-      case 2: {
-        if (tag == 16) {
-         parse_permission:
-          int value;
+      // optional string text = 3;
+      case 3: {
+        if (tag == 26) {
+         parse_text:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_text()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->text().data(), this->text().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "text");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(32)) goto parse_close_after;
+        break;
+      }
+
+      // optional bool close_after = 4 [default = false];
+      case 4: {
+        if (tag == 32) {
+         parse_close_after:
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::lms::Response_ModuleListResponse_Permission_IsValid(value)) {
-            set_permission(static_cast< ::lms::Response_ModuleListResponse_Permission >(value));
-          } else {
-            mutable_unknown_fields()->AddVarint(2, value);
-          }
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, &close_after_)));
+          set_has_close_after();
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(24)) goto parse_priority;
+        if (input->ExpectTag(40)) goto parse_timestamp;
         break;
       }
 
-      // optional int32 priority = 3;
-      case 3: {
-        if (tag == 24) {
-         parse_priority:
+      // optional int64 timestamp = 5;
+      case 5: {
+        if (tag == 40) {
+         parse_timestamp:
           DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &priority_)));
-          set_has_priority();
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &timestamp_)));
+          set_has_timestamp();
         } else {
           goto handle_unusual;
         }
@@ -7418,100 +9089,143 @@ bool Response_ModuleListResponse_Access::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:lms.Response.ModuleListResponse.Access)
+  // @@protoc_insertion_point(parse_success:lms.Response.LogEvent)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:lms.Response.ModuleListResponse.Access)
+  // @@protoc_insertion_point(parse_failure:lms.Response.LogEvent)
   return false;
 #undef DO_
 }
 
-void Response_ModuleListResponse_Access::SerializeWithCachedSizes(
+void Response_LogEvent::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:lms.Response.ModuleListResponse.Access)
-  // optional string module = 1;
-  if (has_module()) {
+  // @@protoc_insertion_point(serialize_start:lms.Response.LogEvent)
+  // optional .lms.Response.LogEvent.Level level = 1;
+  if (has_level()) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      1, this->level(), output);
+  }
+
+  // optional string tag = 2;
+  if (has_tag()) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->module().data(), this->module().length(),
+      this->tag().data(), this->tag().length(),
       ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "module");
+      "tag");
     ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->module(), output);
+      2, this->tag(), output);
   }
 
-  // optional .lms.Response.ModuleListResponse.Permission permission = 2;
-  if (has_permission()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      2, this->permission(), output);
+  // optional string text = 3;
+  if (has_text()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->text().data(), this->text().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "text");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      3, this->text(), output);
   }
 
-  // optional int32 priority = 3;
-  if (has_priority()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->priority(), output);
+  // optional bool close_after = 4 [default = false];
+  if (has_close_after()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBool(4, this->close_after(), output);
+  }
+
+  // optional int64 timestamp = 5;
+  if (has_timestamp()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(5, this->timestamp(), output);
   }
 
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:lms.Response.ModuleListResponse.Access)
+  // @@protoc_insertion_point(serialize_end:lms.Response.LogEvent)
 }
 
-::google::protobuf::uint8* Response_ModuleListResponse_Access::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* Response_LogEvent::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:lms.Response.ModuleListResponse.Access)
-  // optional string module = 1;
-  if (has_module()) {
+  // @@protoc_insertion_point(serialize_to_array_start:lms.Response.LogEvent)
+  // optional .lms.Response.LogEvent.Level level = 1;
+  if (has_level()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      1, this->level(), target);
+  }
+
+  // optional string tag = 2;
+  if (has_tag()) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->module().data(), this->module().length(),
+      this->tag().data(), this->tag().length(),
       ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "module");
+      "tag");
     target =
       ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->module(), target);
+        2, this->tag(), target);
   }
 
-  // optional .lms.Response.ModuleListResponse.Permission permission = 2;
-  if (has_permission()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      2, this->permission(), target);
+  // optional string text = 3;
+  if (has_text()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->text().data(), this->text().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "text");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        3, this->text(), target);
   }
 
-  // optional int32 priority = 3;
-  if (has_priority()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->priority(), target);
+  // optional bool close_after = 4 [default = false];
+  if (has_close_after()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(4, this->close_after(), target);
+  }
+
+  // optional int64 timestamp = 5;
+  if (has_timestamp()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(5, this->timestamp(), target);
   }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:lms.Response.ModuleListResponse.Access)
+  // @@protoc_insertion_point(serialize_to_array_end:lms.Response.LogEvent)
   return target;
 }
 
-int Response_ModuleListResponse_Access::ByteSize() const {
+int Response_LogEvent::ByteSize() const {
   int total_size = 0;
 
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional string module = 1;
-    if (has_module()) {
+    // optional .lms.Response.LogEvent.Level level = 1;
+    if (has_level()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->level());
+    }
+
+    // optional string tag = 2;
+    if (has_tag()) {
       total_size += 1 +
         ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->module());
+          this->tag());
     }
 
-    // optional .lms.Response.ModuleListResponse.Permission permission = 2;
-    if (has_permission()) {
+    // optional string text = 3;
+    if (has_text()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->permission());
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->text());
     }
 
-    // optional int32 priority = 3;
-    if (has_priority()) {
+    // optional bool close_after = 4 [default = false];
+    if (has_close_after()) {
+      total_size += 1 + 1;
+    }
+
+    // optional int64 timestamp = 5;
+    if (has_timestamp()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->priority());
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->timestamp());
     }
 
   }
@@ -7526,10 +9240,10 @@ int Response_ModuleListResponse_Access::ByteSize() const {
   return total_size;
 }
 
-void Response_ModuleListResponse_Access::MergeFrom(const ::google::protobuf::Message& from) {
+void Response_LogEvent::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const Response_ModuleListResponse_Access* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Response_ModuleListResponse_Access*>(
+  const Response_LogEvent* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Response_LogEvent*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -7538,55 +9252,63 @@ void Response_ModuleListResponse_Access::MergeFrom(const ::google::protobuf::Mes
   }
 }
 
-void Response_ModuleListResponse_Access::MergeFrom(const Response_ModuleListResponse_Access& from) {
+void Response_LogEvent::MergeFrom(const Response_LogEvent& from) {
   GOOGLE_CHECK_NE(&from, this);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_module()) {
-      set_module(from.module());
+    if (from.has_level()) {
+      set_level(from.level());
     }
-    if (from.has_permission()) {
-      set_permission(from.permission());
+    if (from.has_tag()) {
+      set_tag(from.tag());
     }
-    if (from.has_priority()) {
-      set_priority(from.priority());
+    if (from.has_text()) {
+      set_text(from.text());
+    }
+    if (from.has_close_after()) {
+      set_close_after(from.close_after());
+    }
+    if (from.has_timestamp()) {
+      set_timestamp(from.timestamp());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void Response_ModuleListResponse_Access::CopyFrom(const ::google::protobuf::Message& from) {
+void Response_LogEvent::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Response_ModuleListResponse_Access::CopyFrom(const Response_ModuleListResponse_Access& from) {
+void Response_LogEvent::CopyFrom(const Response_LogEvent& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Response_ModuleListResponse_Access::IsInitialized() const {
+bool Response_LogEvent::IsInitialized() const {
 
   return true;
 }
 
-void Response_ModuleListResponse_Access::Swap(Response_ModuleListResponse_Access* other) {
+void Response_LogEvent::Swap(Response_LogEvent* other) {
   if (other != this) {
-    std::swap(module_, other->module_);
-    std::swap(permission_, other->permission_);
-    std::swap(priority_, other->priority_);
+    std::swap(level_, other->level_);
+    std::swap(tag_, other->tag_);
+    std::swap(text_, other->text_);
+    std::swap(close_after_, other->close_after_);
+    std::swap(timestamp_, other->timestamp_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata Response_ModuleListResponse_Access::GetMetadata() const {
+::google::protobuf::Metadata Response_LogEvent::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Response_ModuleListResponse_Access_descriptor_;
-  metadata.reflection = Response_ModuleListResponse_Access_reflection_;
+  metadata.descriptor = Response_LogEvent_descriptor_;
+  metadata.reflection = Response_LogEvent_reflection_;
   return metadata;
 }
 
@@ -7594,114 +9316,146 @@ void Response_ModuleListResponse_Access::Swap(Response_ModuleListResponse_Access
 // -------------------------------------------------------------------
 
 #ifndef _MSC_VER
-const int Response_ModuleListResponse_Channel::kNameFieldNumber;
-const int Response_ModuleListResponse_Channel::kAccessListFieldNumber;
+const int Response_LogEventBatch::kEventsFieldNumber;
+const int Response_LogEventBatch::kMinLevelFieldNumber;
+const int Response_LogEventBatch::kMaxLevelFieldNumber;
 #endif  // !_MSC_VER
 
-Response_ModuleListResponse_Channel::Response_ModuleListResponse_Channel()
+Response_LogEventBatch::Response_LogEventBatch()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:lms.Response.ModuleListResponse.Channel)
+  // @@protoc_insertion_point(constructor:lms.Response.LogEventBatch)
 }
 
-void Response_ModuleListResponse_Channel::InitAsDefaultInstance() {
+void Response_LogEventBatch::InitAsDefaultInstance() {
 }
 
-Response_ModuleListResponse_Channel::Response_ModuleListResponse_Channel(const Response_ModuleListResponse_Channel& from)
+Response_LogEventBatch::Response_LogEventBatch(const Response_LogEventBatch& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:lms.Response.ModuleListResponse.Channel)
+  // @@protoc_insertion_point(copy_constructor:lms.Response.LogEventBatch)
 }
 
-void Response_ModuleListResponse_Channel::SharedCtor() {
-  ::google::protobuf::internal::GetEmptyString();
+void Response_LogEventBatch::SharedCtor() {
   _cached_size_ = 0;
-  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  min_level_ = 0;
+  max_level_ = 0;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-Response_ModuleListResponse_Channel::~Response_ModuleListResponse_Channel() {
-  // @@protoc_insertion_point(destructor:lms.Response.ModuleListResponse.Channel)
+Response_LogEventBatch::~Response_LogEventBatch() {
+  // @@protoc_insertion_point(destructor:lms.Response.LogEventBatch)
   SharedDtor();
 }
 
-void Response_ModuleListResponse_Channel::SharedDtor() {
-  if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete name_;
-  }
+void Response_LogEventBatch::SharedDtor() {
   if (this != default_instance_) {
   }
 }
 
-void Response_ModuleListResponse_Channel::SetCachedSize(int size) const {
+void Response_LogEventBatch::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* Response_ModuleListResponse_Channel::descriptor() {
+const ::google::protobuf::Descriptor* Response_LogEventBatch::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return Response_ModuleListResponse_Channel_descriptor_;
+  return Response_LogEventBatch_descriptor_;
 }
 
-const Response_ModuleListResponse_Channel& Response_ModuleListResponse_Channel::default_instance() {
+const Response_LogEventBatch& Response_LogEventBatch::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_messages_2eproto();
   return *default_instance_;
 }
 
-Response_ModuleListResponse_Channel* Response_ModuleListResponse_Channel::default_instance_ = NULL;
+Response_LogEventBatch* Response_LogEventBatch::default_instance_ = NULL;
 
-Response_ModuleListResponse_Channel* Response_ModuleListResponse_Channel::New() const {
-  return new Response_ModuleListResponse_Channel;
+Response_LogEventBatch* Response_LogEventBatch::New() const {
+  return new Response_LogEventBatch;
 }
 
-void Response_ModuleListResponse_Channel::Clear() {
-  if (has_name()) {
-    if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-      name_->clear();
-    }
-  }
-  access_list_.Clear();
+void Response_LogEventBatch::Clear() {
+#define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
+  &reinterpret_cast<Response_LogEventBatch*>(16)->f) - \
+   reinterpret_cast<char*>(16))
+
+#define ZR_(first, last) do {                              \
+    size_t f = OFFSET_OF_FIELD_(first);                    \
+    size_t n = OFFSET_OF_FIELD_(last) - f + sizeof(last);  \
+    ::memset(&first, 0, n);                                \
+  } while (0)
+
+  ZR_(min_level_, max_level_);
+
+#undef OFFSET_OF_FIELD_
+#undef ZR_
+
+  events_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool Response_ModuleListResponse_Channel::MergePartialFromCodedStream(
+bool Response_LogEventBatch::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:lms.Response.ModuleListResponse.Channel)
+  // @@protoc_insertion_point(parse_start:lms.Response.LogEventBatch)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional string name = 1;
+      // repeated .lms.Response.LogEvent events = 1;
       case 1: {
         if (tag == 10) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "name");
+         parse_events:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_events()));
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(18)) goto parse_access_list;
+        if (input->ExpectTag(10)) goto parse_events;
+        if (input->ExpectTag(16)) goto parse_min_level;
         break;
       }
 
-      // repeated .lms.Response.ModuleListResponse.Access access_list = 2;
+      // optional .lms.Response.LogEvent.Level min_level = 2;
       case 2: {
-        if (tag == 18) {
-         parse_access_list:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_access_list()));
+        if (tag == 16) {
+         parse_min_level:
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::lms::Response_LogEvent_Level_IsValid(value)) {
+            set_min_level(static_cast< ::lms::Response_LogEvent_Level >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(2, value);
+          }
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(24)) goto parse_max_level;
+        break;
+      }
+
+      // optional .lms.Response.LogEvent.Level max_level = 3;
+      case 3: {
+        if (tag == 24) {
+         parse_max_level:
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::lms::Response_LogEvent_Level_IsValid(value)) {
+            set_max_level(static_cast< ::lms::Response_LogEvent_Level >(value));
+          } else {
+            mutable_unknown_fields()->AddVarint(3, value);
+          }
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(18)) goto parse_access_list;
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -7720,87 +9474,95 @@ bool Response_ModuleListResponse_Channel::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:lms.Response.ModuleListResponse.Channel)
+  // @@protoc_insertion_point(parse_success:lms.Response.LogEventBatch)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:lms.Response.ModuleListResponse.Channel)
+  // @@protoc_insertion_point(parse_failure:lms.Response.LogEventBatch)
   return false;
 #undef DO_
 }
 
-void Response_ModuleListResponse_Channel::SerializeWithCachedSizes(
+void Response_LogEventBatch::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:lms.Response.ModuleListResponse.Channel)
-  // optional string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "name");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      1, this->name(), output);
+  // @@protoc_insertion_point(serialize_start:lms.Response.LogEventBatch)
+  // repeated .lms.Response.LogEvent events = 1;
+  for (int i = 0; i < this->events_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, this->events(i), output);
   }
 
-  // repeated .lms.Response.ModuleListResponse.Access access_list = 2;
-  for (int i = 0; i < this->access_list_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->access_list(i), output);
+  // optional .lms.Response.LogEvent.Level min_level = 2;
+  if (has_min_level()) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      2, this->min_level(), output);
+  }
+
+  // optional .lms.Response.LogEvent.Level max_level = 3;
+  if (has_max_level()) {
+    ::google::protobuf::internal::WireFormatLite::WriteEnum(
+      3, this->max_level(), output);
   }
 
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:lms.Response.ModuleListResponse.Channel)
+  // @@protoc_insertion_point(serialize_end:lms.Response.LogEventBatch)
 }
 
-::google::protobuf::uint8* Response_ModuleListResponse_Channel::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* Response_LogEventBatch::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:lms.Response.ModuleListResponse.Channel)
-  // optional string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "name");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
-  }
-
-  // repeated .lms.Response.ModuleListResponse.Access access_list = 2;
-  for (int i = 0; i < this->access_list_size(); i++) {
+  // @@protoc_insertion_point(serialize_to_array_start:lms.Response.LogEventBatch)
+  // repeated .lms.Response.LogEvent events = 1;
+  for (int i = 0; i < this->events_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        2, this->access_list(i), target);
+        1, this->events(i), target);
+  }
+
+  // optional .lms.Response.LogEvent.Level min_level = 2;
+  if (has_min_level()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      2, this->min_level(), target);
+  }
+
+  // optional .lms.Response.LogEvent.Level max_level = 3;
+  if (has_max_level()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
+      3, this->max_level(), target);
   }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:lms.Response.ModuleListResponse.Channel)
+  // @@protoc_insertion_point(serialize_to_array_end:lms.Response.LogEventBatch)
   return target;
 }
 
-int Response_ModuleListResponse_Channel::ByteSize() const {
+int Response_LogEventBatch::ByteSize() const {
   int total_size = 0;
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional string name = 1;
-    if (has_name()) {
+  if (_has_bits_[1 / 32] & (0xffu << (1 % 32))) {
+    // optional .lms.Response.LogEvent.Level min_level = 2;
+    if (has_min_level()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->name());
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->min_level());
+    }
+
+    // optional .lms.Response.LogEvent.Level max_level = 3;
+    if (has_max_level()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::EnumSize(this->max_level());
     }
 
   }
-  // repeated .lms.Response.ModuleListResponse.Access access_list = 2;
-  total_size += 1 * this->access_list_size();
-  for (int i = 0; i < this->access_list_size(); i++) {
+  // repeated .lms.Response.LogEvent events = 1;
+  total_size += 1 * this->events_size();
+  for (int i = 0; i < this->events_size(); i++) {
     total_size +=
       ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->access_list(i));
+        this->events(i));
   }
 
   if (!unknown_fields().empty()) {
@@ -7814,10 +9576,10 @@ int Response_ModuleListResponse_Channel::ByteSize() const {
   return total_size;
 }
 
-void Response_ModuleListResponse_Channel::MergeFrom(const ::google::protobuf::Message& from) {
+void Response_LogEventBatch::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const Response_ModuleListResponse_Channel* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Response_ModuleListResponse_Channel*>(
+  const Response_LogEventBatch* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Response_LogEventBatch*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -7826,49 +9588,53 @@ void Response_ModuleListResponse_Channel::MergeFrom(const ::google::protobuf::Me
   }
 }
 
-void Response_ModuleListResponse_Channel::MergeFrom(const Response_ModuleListResponse_Channel& from) {
+void Response_LogEventBatch::MergeFrom(const Response_LogEventBatch& from) {
   GOOGLE_CHECK_NE(&from, this);
-  access_list_.MergeFrom(from.access_list_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_name()) {
-      set_name(from.name());
+  events_.MergeFrom(from.events_);
+  if (from._has_bits_[1 / 32] & (0xffu << (1 % 32))) {
+    if (from.has_min_level()) {
+      set_min_level(from.min_level());
+    }
+    if (from.has_max_level()) {
+      set_max_level(from.max_level());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void Response_ModuleListResponse_Channel::CopyFrom(const ::google::protobuf::Message& from) {
+void Response_LogEventBatch::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Response_ModuleListResponse_Channel::CopyFrom(const Response_ModuleListResponse_Channel& from) {
+void Response_LogEventBatch::CopyFrom(const Response_LogEventBatch& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Response_ModuleListResponse_Channel::IsInitialized() const {
+bool Response_LogEventBatch::IsInitialized() const {
 
   return true;
 }
 
-void Response_ModuleListResponse_Channel::Swap(Response_ModuleListResponse_Channel* other) {
+void Response_LogEventBatch::Swap(Response_LogEventBatch* other) {
   if (other != this) {
-    std::swap(name_, other->name_);
-    access_list_.Swap(&other->access_list_);
+    events_.Swap(&other->events_);
+    std::swap(min_level_, other->min_level_);
+    std::swap(max_level_, other->max_level_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata Response_ModuleListResponse_Channel::GetMetadata() const {
+::google::protobuf::Metadata Response_LogEventBatch::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Response_ModuleListResponse_Channel_descriptor_;
-  metadata.reflection = Response_ModuleListResponse_Channel_reflection_;
+  metadata.descriptor = Response_LogEventBatch_descriptor_;
+  metadata.reflection = Response_LogEventBatch_reflection_;
   return metadata;
 }
 
@@ -7876,87 +9642,217 @@ void Response_ModuleListResponse_Channel::Swap(Response_ModuleListResponse_Chann
 // -------------------------------------------------------------------
 
 #ifndef _MSC_VER
-const int Response_ModuleListResponse::kChannelsFieldNumber;
+const int Response_ProfilingSummary_Trace::kNameFieldNumber;
+const int Response_ProfilingSummary_Trace::kAvgFieldNumber;
+const int Response_ProfilingSummary_Trace::kStdFieldNumber;
+const int Response_ProfilingSummary_Trace::kMaxFieldNumber;
+const int Response_ProfilingSummary_Trace::kCountFieldNumber;
+const int Response_ProfilingSummary_Trace::kMinFieldNumber;
+const int Response_ProfilingSummary_Trace::kRunningSinceFieldNumber;
 #endif  // !_MSC_VER
 
-Response_ModuleListResponse::Response_ModuleListResponse()
+Response_ProfilingSummary_Trace::Response_ProfilingSummary_Trace()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:lms.Response.ModuleListResponse)
+  // @@protoc_insertion_point(constructor:lms.Response.ProfilingSummary.Trace)
 }
 
-void Response_ModuleListResponse::InitAsDefaultInstance() {
+void Response_ProfilingSummary_Trace::InitAsDefaultInstance() {
 }
 
-Response_ModuleListResponse::Response_ModuleListResponse(const Response_ModuleListResponse& from)
+Response_ProfilingSummary_Trace::Response_ProfilingSummary_Trace(const Response_ProfilingSummary_Trace& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:lms.Response.ModuleListResponse)
+  // @@protoc_insertion_point(copy_constructor:lms.Response.ProfilingSummary.Trace)
 }
 
-void Response_ModuleListResponse::SharedCtor() {
+void Response_ProfilingSummary_Trace::SharedCtor() {
+  ::google::protobuf::internal::GetEmptyString();
   _cached_size_ = 0;
+  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  avg_ = 0;
+  std_ = 0;
+  max_ = 0;
+  count_ = 0;
+  min_ = 0;
+  running_since_ = 0;
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-Response_ModuleListResponse::~Response_ModuleListResponse() {
-  // @@protoc_insertion_point(destructor:lms.Response.ModuleListResponse)
+Response_ProfilingSummary_Trace::~Response_ProfilingSummary_Trace() {
+  // @@protoc_insertion_point(destructor:lms.Response.ProfilingSummary.Trace)
   SharedDtor();
 }
 
-void Response_ModuleListResponse::SharedDtor() {
+void Response_ProfilingSummary_Trace::SharedDtor() {
+  if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete name_;
+  }
   if (this != default_instance_) {
   }
 }
 
-void Response_ModuleListResponse::SetCachedSize(int size) const {
+void Response_ProfilingSummary_Trace::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* Response_ModuleListResponse::descriptor() {
+const ::google::protobuf::Descriptor* Response_ProfilingSummary_Trace::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return Response_ModuleListResponse_descriptor_;
+  return Response_ProfilingSummary_Trace_descriptor_;
 }
 
-const Response_ModuleListResponse& Response_ModuleListResponse::default_instance() {
+const Response_ProfilingSummary_Trace& Response_ProfilingSummary_Trace::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_messages_2eproto();
   return *default_instance_;
 }
 
-Response_ModuleListResponse* Response_ModuleListResponse::default_instance_ = NULL;
+Response_ProfilingSummary_Trace* Response_ProfilingSummary_Trace::default_instance_ = NULL;
 
-Response_ModuleListResponse* Response_ModuleListResponse::New() const {
-  return new Response_ModuleListResponse;
+Response_ProfilingSummary_Trace* Response_ProfilingSummary_Trace::New() const {
+  return new Response_ProfilingSummary_Trace;
 }
 
-void Response_ModuleListResponse::Clear() {
-  channels_.Clear();
+void Response_ProfilingSummary_Trace::Clear() {
+#define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
+  &reinterpret_cast<Response_ProfilingSummary_Trace*>(16)->f) - \
+   reinterpret_cast<char*>(16))
+
+#define ZR_(first, last) do {                              \
+    size_t f = OFFSET_OF_FIELD_(first);                    \
+    size_t n = OFFSET_OF_FIELD_(last) - f + sizeof(last);  \
+    ::memset(&first, 0, n);                                \
+  } while (0)
+
+  if (_has_bits_[0 / 32] & 127) {
+    ZR_(avg_, running_since_);
+    if (has_name()) {
+      if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        name_->clear();
+      }
+    }
+  }
+
+#undef OFFSET_OF_FIELD_
+#undef ZR_
+
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool Response_ModuleListResponse::MergePartialFromCodedStream(
+bool Response_ProfilingSummary_Trace::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:lms.Response.ModuleListResponse)
+  // @@protoc_insertion_point(parse_start:lms.Response.ProfilingSummary.Trace)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated .lms.Response.ModuleListResponse.Channel channels = 1;
+      // optional string name = 1;
       case 1: {
         if (tag == 10) {
-         parse_channels:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_channels()));
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_name()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->name().data(), this->name().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "name");
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(16)) goto parse_avg;
+        break;
+      }
+
+      // optional int32 avg = 2;
+      case 2: {
+        if (tag == 16) {
+         parse_avg:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &avg_)));
+          set_has_avg();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(24)) goto parse_std;
+        break;
+      }
+
+      // optional int32 std = 3;
+      case 3: {
+        if (tag == 24) {
+         parse_std:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &std_)));
+          set_has_std();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(32)) goto parse_max;
+        break;
+      }
+
+      // optional int32 max = 4;
+      case 4: {
+        if (tag == 32) {
+         parse_max:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &max_)));
+          set_has_max();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(40)) goto parse_count;
+        break;
+      }
+
+      // optional int32 count = 5;
+      case 5: {
+        if (tag == 40) {
+         parse_count:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &count_)));
+          set_has_count();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(48)) goto parse_min;
+        break;
+      }
+
+      // optional int32 min = 6;
+      case 6: {
+        if (tag == 48) {
+         parse_min:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &min_)));
+          set_has_min();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(56)) goto parse_running_since;
+        break;
+      }
+
+      // optional int32 running_since = 7;
+      case 7: {
+        if (tag == 56) {
+         parse_running_since:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &running_since_)));
+          set_has_running_since();
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(10)) goto parse_channels;
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -7975,59 +9871,170 @@ bool Response_ModuleListResponse::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:lms.Response.ModuleListResponse)
+  // @@protoc_insertion_point(parse_success:lms.Response.ProfilingSummary.Trace)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:lms.Response.ModuleListResponse)
+  // @@protoc_insertion_point(parse_failure:lms.Response.ProfilingSummary.Trace)
   return false;
 #undef DO_
 }
 
-void Response_ModuleListResponse::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:lms.Response.ModuleListResponse)
-  // repeated .lms.Response.ModuleListResponse.Channel channels = 1;
-  for (int i = 0; i < this->channels_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->channels(i), output);
+void Response_ProfilingSummary_Trace::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:lms.Response.ProfilingSummary.Trace)
+  // optional string name = 1;
+  if (has_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->name().data(), this->name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "name");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->name(), output);
+  }
+
+  // optional int32 avg = 2;
+  if (has_avg()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->avg(), output);
+  }
+
+  // optional int32 std = 3;
+  if (has_std()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->std(), output);
+  }
+
+  // optional int32 max = 4;
+  if (has_max()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(4, this->max(), output);
+  }
+
+  // optional int32 count = 5;
+  if (has_count()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(5, this->count(), output);
+  }
+
+  // optional int32 min = 6;
+  if (has_min()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(6, this->min(), output);
+  }
+
+  // optional int32 running_since = 7;
+  if (has_running_since()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(7, this->running_since(), output);
   }
 
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:lms.Response.ModuleListResponse)
+  // @@protoc_insertion_point(serialize_end:lms.Response.ProfilingSummary.Trace)
 }
 
-::google::protobuf::uint8* Response_ModuleListResponse::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* Response_ProfilingSummary_Trace::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:lms.Response.ModuleListResponse)
-  // repeated .lms.Response.ModuleListResponse.Channel channels = 1;
-  for (int i = 0; i < this->channels_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->channels(i), target);
+  // @@protoc_insertion_point(serialize_to_array_start:lms.Response.ProfilingSummary.Trace)
+  // optional string name = 1;
+  if (has_name()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->name().data(), this->name().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "name");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        1, this->name(), target);
+  }
+
+  // optional int32 avg = 2;
+  if (has_avg()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->avg(), target);
+  }
+
+  // optional int32 std = 3;
+  if (has_std()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->std(), target);
+  }
+
+  // optional int32 max = 4;
+  if (has_max()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(4, this->max(), target);
+  }
+
+  // optional int32 count = 5;
+  if (has_count()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(5, this->count(), target);
+  }
+
+  // optional int32 min = 6;
+  if (has_min()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(6, this->min(), target);
+  }
+
+  // optional int32 running_since = 7;
+  if (has_running_since()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(7, this->running_since(), target);
   }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:lms.Response.ModuleListResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:lms.Response.ProfilingSummary.Trace)
   return target;
 }
 
-int Response_ModuleListResponse::ByteSize() const {
+int Response_ProfilingSummary_Trace::ByteSize() const {
   int total_size = 0;
 
-  // repeated .lms.Response.ModuleListResponse.Channel channels = 1;
-  total_size += 1 * this->channels_size();
-  for (int i = 0; i < this->channels_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->channels(i));
-  }
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional string name = 1;
+    if (has_name()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->name());
+    }
+
+    // optional int32 avg = 2;
+    if (has_avg()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->avg());
+    }
+
+    // optional int32 std = 3;
+    if (has_std()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->std());
+    }
+
+    // optional int32 max = 4;
+    if (has_max()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->max());
+    }
+
+    // optional int32 count = 5;
+    if (has_count()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->count());
+    }
+
+    // optional int32 min = 6;
+    if (has_min()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->min());
+    }
 
+    // optional int32 running_since = 7;
+    if (has_running_since()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->running_since());
+    }
+
+  }
   if (!unknown_fields().empty()) {
     total_size +=
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
@@ -8039,10 +10046,10 @@ int Response_ModuleListResponse::ByteSize() const {
   return total_size;
 }
 
-void Response_ModuleListResponse::MergeFrom(const ::google::protobuf::Message& from) {
+void Response_ProfilingSummary_Trace::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const Response_ModuleListResponse* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Response_ModuleListResponse*>(
+  const Response_ProfilingSummary_Trace* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Response_ProfilingSummary_Trace*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -8051,274 +10058,159 @@ void Response_ModuleListResponse::MergeFrom(const ::google::protobuf::Message& f
   }
 }
 
-void Response_ModuleListResponse::MergeFrom(const Response_ModuleListResponse& from) {
+void Response_ProfilingSummary_Trace::MergeFrom(const Response_ProfilingSummary_Trace& from) {
   GOOGLE_CHECK_NE(&from, this);
-  channels_.MergeFrom(from.channels_);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_name()) {
+      set_name(from.name());
+    }
+    if (from.has_avg()) {
+      set_avg(from.avg());
+    }
+    if (from.has_std()) {
+      set_std(from.std());
+    }
+    if (from.has_max()) {
+      set_max(from.max());
+    }
+    if (from.has_count()) {
+      set_count(from.count());
+    }
+    if (from.has_min()) {
+      set_min(from.min());
+    }
+    if (from.has_running_since()) {
+      set_running_since(from.running_since());
+    }
+  }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void Response_ModuleListResponse::CopyFrom(const ::google::protobuf::Message& from) {
+void Response_ProfilingSummary_Trace::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Response_ModuleListResponse::CopyFrom(const Response_ModuleListResponse& from) {
+void Response_ProfilingSummary_Trace::CopyFrom(const Response_ProfilingSummary_Trace& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Response_ModuleListResponse::IsInitialized() const {
+bool Response_ProfilingSummary_Trace::IsInitialized() const {
 
   return true;
 }
 
-void Response_ModuleListResponse::Swap(Response_ModuleListResponse* other) {
+void Response_ProfilingSummary_Trace::Swap(Response_ProfilingSummary_Trace* other) {
   if (other != this) {
-    channels_.Swap(&other->channels_);
+    std::swap(name_, other->name_);
+    std::swap(avg_, other->avg_);
+    std::swap(std_, other->std_);
+    std::swap(max_, other->max_);
+    std::swap(count_, other->count_);
+    std::swap(min_, other->min_);
+    std::swap(running_since_, other->running_since_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata Response_ModuleListResponse::GetMetadata() const {
+::google::protobuf::Metadata Response_ProfilingSummary_Trace::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Response_ModuleListResponse_descriptor_;
-  metadata.reflection = Response_ModuleListResponse_reflection_;
+  metadata.descriptor = Response_ProfilingSummary_Trace_descriptor_;
+  metadata.reflection = Response_ProfilingSummary_Trace_reflection_;
   return metadata;
 }
 
 
 // -------------------------------------------------------------------
 
-const ::google::protobuf::EnumDescriptor* Response_LogEvent_Level_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Response_LogEvent_Level_descriptor_;
-}
-bool Response_LogEvent_Level_IsValid(int value) {
-  switch(value) {
-    case 0:
-    case 10:
-    case 20:
-    case 30:
-    case 40:
-    case 50:
-    case 255:
-      return true;
-    default:
-      return false;
-  }
-}
-
-#ifndef _MSC_VER
-const Response_LogEvent_Level Response_LogEvent::ALL;
-const Response_LogEvent_Level Response_LogEvent::PROFILE;
-const Response_LogEvent_Level Response_LogEvent::DEBUG;
-const Response_LogEvent_Level Response_LogEvent::INFO;
-const Response_LogEvent_Level Response_LogEvent::WARN;
-const Response_LogEvent_Level Response_LogEvent::ERROR;
-const Response_LogEvent_Level Response_LogEvent::OFF;
-const Response_LogEvent_Level Response_LogEvent::Level_MIN;
-const Response_LogEvent_Level Response_LogEvent::Level_MAX;
-const int Response_LogEvent::Level_ARRAYSIZE;
-#endif  // _MSC_VER
 #ifndef _MSC_VER
-const int Response_LogEvent::kLevelFieldNumber;
-const int Response_LogEvent::kTagFieldNumber;
-const int Response_LogEvent::kTextFieldNumber;
-const int Response_LogEvent::kCloseAfterFieldNumber;
-const int Response_LogEvent::kTimestampFieldNumber;
+const int Response_ProfilingSummary::kTracesFieldNumber;
 #endif  // !_MSC_VER
 
-Response_LogEvent::Response_LogEvent()
+Response_ProfilingSummary::Response_ProfilingSummary()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:lms.Response.LogEvent)
+  // @@protoc_insertion_point(constructor:lms.Response.ProfilingSummary)
 }
 
-void Response_LogEvent::InitAsDefaultInstance() {
+void Response_ProfilingSummary::InitAsDefaultInstance() {
 }
 
-Response_LogEvent::Response_LogEvent(const Response_LogEvent& from)
+Response_ProfilingSummary::Response_ProfilingSummary(const Response_ProfilingSummary& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:lms.Response.LogEvent)
+  // @@protoc_insertion_point(copy_constructor:lms.Response.ProfilingSummary)
 }
 
-void Response_LogEvent::SharedCtor() {
-  ::google::protobuf::internal::GetEmptyString();
+void Response_ProfilingSummary::SharedCtor() {
   _cached_size_ = 0;
-  level_ = 0;
-  tag_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  text_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  close_after_ = false;
-  timestamp_ = GOOGLE_LONGLONG(0);
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-Response_LogEvent::~Response_LogEvent() {
-  // @@protoc_insertion_point(destructor:lms.Response.LogEvent)
+Response_ProfilingSummary::~Response_ProfilingSummary() {
+  // @@protoc_insertion_point(destructor:lms.Response.ProfilingSummary)
   SharedDtor();
 }
 
-void Response_LogEvent::SharedDtor() {
-  if (tag_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete tag_;
-  }
-  if (text_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-    delete text_;
-  }
+void Response_ProfilingSummary::SharedDtor() {
   if (this != default_instance_) {
   }
 }
 
-void Response_LogEvent::SetCachedSize(int size) const {
+void Response_ProfilingSummary::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* Response_LogEvent::descriptor() {
+const ::google::protobuf::Descriptor* Response_ProfilingSummary::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return Response_LogEvent_descriptor_;
+  return Response_ProfilingSummary_descriptor_;
 }
 
-const Response_LogEvent& Response_LogEvent::default_instance() {
+const Response_ProfilingSummary& Response_ProfilingSummary::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_messages_2eproto();
   return *default_instance_;
 }
 
-Response_LogEvent* Response_LogEvent::default_instance_ = NULL;
+Response_ProfilingSummary* Response_ProfilingSummary::default_instance_ = NULL;
 
-Response_LogEvent* Response_LogEvent::New() const {
-  return new Response_LogEvent;
+Response_ProfilingSummary* Response_ProfilingSummary::New() const {
+  return new Response_ProfilingSummary;
 }
 
-void Response_LogEvent::Clear() {
-#define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
-  &reinterpret_cast<Response_LogEvent*>(16)->f) - \
-   reinterpret_cast<char*>(16))
-
-#define ZR_(first, last) do {                              \
-    size_t f = OFFSET_OF_FIELD_(first);                    \
-    size_t n = OFFSET_OF_FIELD_(last) - f + sizeof(last);  \
-    ::memset(&first, 0, n);                                \
-  } while (0)
-
-  if (_has_bits_[0 / 32] & 31) {
-    ZR_(level_, close_after_);
-    if (has_tag()) {
-      if (tag_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-        tag_->clear();
-      }
-    }
-    if (has_text()) {
-      if (text_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
-        text_->clear();
-      }
-    }
-    timestamp_ = GOOGLE_LONGLONG(0);
-  }
-
-#undef OFFSET_OF_FIELD_
-#undef ZR_
-
+void Response_ProfilingSummary::Clear() {
+  traces_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool Response_LogEvent::MergePartialFromCodedStream(
+bool Response_ProfilingSummary::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:lms.Response.LogEvent)
+  // @@protoc_insertion_point(parse_start:lms.Response.ProfilingSummary)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // optional .lms.Response.LogEvent.Level level = 1;
+      // repeated .lms.Response.ProfilingSummary.Trace traces = 1;
       case 1: {
-        if (tag == 8) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::lms::Response_LogEvent_Level_IsValid(value)) {
-            set_level(static_cast< ::lms::Response_LogEvent_Level >(value));
-          } else {
-            mutable_unknown_fields()->AddVarint(1, value);
-          }
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(18)) goto parse_tag;
-        break;
-      }
-
-      // optional string tag = 2;
-      case 2: {
-        if (tag == 18) {
-         parse_tag:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_tag()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->tag().data(), this->tag().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "tag");
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(26)) goto parse_text;
-        break;
-      }
-
-      // optional string text = 3;
-      case 3: {
-        if (tag == 26) {
-         parse_text:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_text()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-            this->text().data(), this->text().length(),
-            ::google::protobuf::internal::WireFormat::PARSE,
-            "text");
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(32)) goto parse_close_after;
-        break;
-      }
-
-      // optional bool close_after = 4 [default = false];
-      case 4: {
-        if (tag == 32) {
-         parse_close_after:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &close_after_)));
-          set_has_close_after();
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(40)) goto parse_timestamp;
-        break;
-      }
-
-      // optional int64 timestamp = 5;
-      case 5: {
-        if (tag == 40) {
-         parse_timestamp:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
-                 input, &timestamp_)));
-          set_has_timestamp();
+        if (tag == 10) {
+         parse_traces:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+                input, add_traces()));
         } else {
           goto handle_unusual;
         }
+        if (input->ExpectTag(10)) goto parse_traces;
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -8337,146 +10229,59 @@ bool Response_LogEvent::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:lms.Response.LogEvent)
+  // @@protoc_insertion_point(parse_success:lms.Response.ProfilingSummary)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:lms.Response.LogEvent)
+  // @@protoc_insertion_point(parse_failure:lms.Response.ProfilingSummary)
   return false;
 #undef DO_
 }
 
-void Response_LogEvent::SerializeWithCachedSizes(
+void Response_ProfilingSummary::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:lms.Response.LogEvent)
-  // optional .lms.Response.LogEvent.Level level = 1;
-  if (has_level()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->level(), output);
-  }
-
-  // optional string tag = 2;
-  if (has_tag()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->tag().data(), this->tag().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "tag");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      2, this->tag(), output);
-  }
-
-  // optional string text = 3;
-  if (has_text()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->text().data(), this->text().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "text");
-    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
-      3, this->text(), output);
-  }
-
-  // optional bool close_after = 4 [default = false];
-  if (has_close_after()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(4, this->close_after(), output);
-  }
-
-  // optional int64 timestamp = 5;
-  if (has_timestamp()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt64(5, this->timestamp(), output);
+  // @@protoc_insertion_point(serialize_start:lms.Response.ProfilingSummary)
+  // repeated .lms.Response.ProfilingSummary.Trace traces = 1;
+  for (int i = 0; i < this->traces_size(); i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      1, this->traces(i), output);
   }
 
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:lms.Response.LogEvent)
+  // @@protoc_insertion_point(serialize_end:lms.Response.ProfilingSummary)
 }
 
-::google::protobuf::uint8* Response_LogEvent::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* Response_ProfilingSummary::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:lms.Response.LogEvent)
-  // optional .lms.Response.LogEvent.Level level = 1;
-  if (has_level()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->level(), target);
-  }
-
-  // optional string tag = 2;
-  if (has_tag()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->tag().data(), this->tag().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "tag");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->tag(), target);
-  }
-
-  // optional string text = 3;
-  if (has_text()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
-      this->text().data(), this->text().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE,
-      "text");
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->text(), target);
-  }
-
-  // optional bool close_after = 4 [default = false];
-  if (has_close_after()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(4, this->close_after(), target);
-  }
-
-  // optional int64 timestamp = 5;
-  if (has_timestamp()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(5, this->timestamp(), target);
+  // @@protoc_insertion_point(serialize_to_array_start:lms.Response.ProfilingSummary)
+  // repeated .lms.Response.ProfilingSummary.Trace traces = 1;
+  for (int i = 0; i < this->traces_size(); i++) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        1, this->traces(i), target);
   }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:lms.Response.LogEvent)
-  return target;
-}
-
-int Response_LogEvent::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional .lms.Response.LogEvent.Level level = 1;
-    if (has_level()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->level());
-    }
-
-    // optional string tag = 2;
-    if (has_tag()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->tag());
-    }
-
-    // optional string text = 3;
-    if (has_text()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->text());
-    }
-
-    // optional bool close_after = 4 [default = false];
-    if (has_close_after()) {
-      total_size += 1 + 1;
-    }
-
-    // optional int64 timestamp = 5;
-    if (has_timestamp()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int64Size(
-          this->timestamp());
-    }
+  // @@protoc_insertion_point(serialize_to_array_end:lms.Response.ProfilingSummary)
+  return target;
+}
+
+int Response_ProfilingSummary::ByteSize() const {
+  int total_size = 0;
 
+  // repeated .lms.Response.ProfilingSummary.Trace traces = 1;
+  total_size += 1 * this->traces_size();
+  for (int i = 0; i < this->traces_size(); i++) {
+    total_size +=
+      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+        this->traces(i));
   }
+
   if (!unknown_fields().empty()) {
     total_size +=
       ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
@@ -8488,10 +10293,10 @@ int Response_LogEvent::ByteSize() const {
   return total_size;
 }
 
-void Response_LogEvent::MergeFrom(const ::google::protobuf::Message& from) {
+void Response_ProfilingSummary::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const Response_LogEvent* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Response_LogEvent*>(
+  const Response_ProfilingSummary* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Response_ProfilingSummary*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -8500,63 +10305,43 @@ void Response_LogEvent::MergeFrom(const ::google::protobuf::Message& from) {
   }
 }
 
-void Response_LogEvent::MergeFrom(const Response_LogEvent& from) {
+void Response_ProfilingSummary::MergeFrom(const Response_ProfilingSummary& from) {
   GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_level()) {
-      set_level(from.level());
-    }
-    if (from.has_tag()) {
-      set_tag(from.tag());
-    }
-    if (from.has_text()) {
-      set_text(from.text());
-    }
-    if (from.has_close_after()) {
-      set_close_after(from.close_after());
-    }
-    if (from.has_timestamp()) {
-      set_timestamp(from.timestamp());
-    }
-  }
+  traces_.MergeFrom(from.traces_);
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void Response_LogEvent::CopyFrom(const ::google::protobuf::Message& from) {
+void Response_ProfilingSummary::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Response_LogEvent::CopyFrom(const Response_LogEvent& from) {
+void Response_ProfilingSummary::CopyFrom(const Response_ProfilingSummary& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Response_LogEvent::IsInitialized() const {
+bool Response_ProfilingSummary::IsInitialized() const {
 
   return true;
 }
 
-void Response_LogEvent::Swap(Response_LogEvent* other) {
+void Response_ProfilingSummary::Swap(Response_ProfilingSummary* other) {
   if (other != this) {
-    std::swap(level_, other->level_);
-    std::swap(tag_, other->tag_);
-    std::swap(text_, other->text_);
-    std::swap(close_after_, other->close_after_);
-    std::swap(timestamp_, other->timestamp_);
+    traces_.Swap(&other->traces_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata Response_LogEvent::GetMetadata() const {
+::google::protobuf::Metadata Response_ProfilingSummary::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Response_LogEvent_descriptor_;
-  metadata.reflection = Response_LogEvent_reflection_;
+  metadata.descriptor = Response_ProfilingSummary_descriptor_;
+  metadata.reflection = Response_ProfilingSummary_reflection_;
   return metadata;
 }
 
@@ -8564,110 +10349,103 @@ void Response_LogEvent::Swap(Response_LogEvent* other) {
 // -------------------------------------------------------------------
 
 #ifndef _MSC_VER
-const int Response_ProfilingSummary_Trace::kNameFieldNumber;
-const int Response_ProfilingSummary_Trace::kAvgFieldNumber;
-const int Response_ProfilingSummary_Trace::kStdFieldNumber;
-const int Response_ProfilingSummary_Trace::kMaxFieldNumber;
-const int Response_ProfilingSummary_Trace::kCountFieldNumber;
-const int Response_ProfilingSummary_Trace::kMinFieldNumber;
-const int Response_ProfilingSummary_Trace::kRunningSinceFieldNumber;
+const int Response_ChannelSnapshot_Channel::kNameFieldNumber;
+const int Response_ChannelSnapshot_Channel::kTypeFieldNumber;
+const int Response_ChannelSnapshot_Channel::kDataFieldNumber;
 #endif  // !_MSC_VER
 
-Response_ProfilingSummary_Trace::Response_ProfilingSummary_Trace()
+Response_ChannelSnapshot_Channel::Response_ChannelSnapshot_Channel()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:lms.Response.ProfilingSummary.Trace)
+  // @@protoc_insertion_point(constructor:lms.Response.ChannelSnapshot.Channel)
 }
 
-void Response_ProfilingSummary_Trace::InitAsDefaultInstance() {
+void Response_ChannelSnapshot_Channel::InitAsDefaultInstance() {
 }
 
-Response_ProfilingSummary_Trace::Response_ProfilingSummary_Trace(const Response_ProfilingSummary_Trace& from)
+Response_ChannelSnapshot_Channel::Response_ChannelSnapshot_Channel(const Response_ChannelSnapshot_Channel& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:lms.Response.ProfilingSummary.Trace)
+  // @@protoc_insertion_point(copy_constructor:lms.Response.ChannelSnapshot.Channel)
 }
 
-void Response_ProfilingSummary_Trace::SharedCtor() {
+void Response_ChannelSnapshot_Channel::SharedCtor() {
   ::google::protobuf::internal::GetEmptyString();
   _cached_size_ = 0;
   name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-  avg_ = 0;
-  std_ = 0;
-  max_ = 0;
-  count_ = 0;
-  min_ = 0;
-  running_since_ = 0;
+  type_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  data_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-Response_ProfilingSummary_Trace::~Response_ProfilingSummary_Trace() {
-  // @@protoc_insertion_point(destructor:lms.Response.ProfilingSummary.Trace)
+Response_ChannelSnapshot_Channel::~Response_ChannelSnapshot_Channel() {
+  // @@protoc_insertion_point(destructor:lms.Response.ChannelSnapshot.Channel)
   SharedDtor();
 }
 
-void Response_ProfilingSummary_Trace::SharedDtor() {
+void Response_ChannelSnapshot_Channel::SharedDtor() {
   if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
     delete name_;
   }
+  if (type_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete type_;
+  }
+  if (data_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete data_;
+  }
   if (this != default_instance_) {
   }
 }
 
-void Response_ProfilingSummary_Trace::SetCachedSize(int size) const {
+void Response_ChannelSnapshot_Channel::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* Response_ProfilingSummary_Trace::descriptor() {
+const ::google::protobuf::Descriptor* Response_ChannelSnapshot_Channel::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return Response_ProfilingSummary_Trace_descriptor_;
+  return Response_ChannelSnapshot_Channel_descriptor_;
 }
 
-const Response_ProfilingSummary_Trace& Response_ProfilingSummary_Trace::default_instance() {
+const Response_ChannelSnapshot_Channel& Response_ChannelSnapshot_Channel::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_messages_2eproto();
   return *default_instance_;
 }
 
-Response_ProfilingSummary_Trace* Response_ProfilingSummary_Trace::default_instance_ = NULL;
+Response_ChannelSnapshot_Channel* Response_ChannelSnapshot_Channel::default_instance_ = NULL;
 
-Response_ProfilingSummary_Trace* Response_ProfilingSummary_Trace::New() const {
-  return new Response_ProfilingSummary_Trace;
+Response_ChannelSnapshot_Channel* Response_ChannelSnapshot_Channel::New() const {
+  return new Response_ChannelSnapshot_Channel;
 }
 
-void Response_ProfilingSummary_Trace::Clear() {
-#define OFFSET_OF_FIELD_(f) (reinterpret_cast<char*>(      \
-  &reinterpret_cast<Response_ProfilingSummary_Trace*>(16)->f) - \
-   reinterpret_cast<char*>(16))
-
-#define ZR_(first, last) do {                              \
-    size_t f = OFFSET_OF_FIELD_(first);                    \
-    size_t n = OFFSET_OF_FIELD_(last) - f + sizeof(last);  \
-    ::memset(&first, 0, n);                                \
-  } while (0)
-
-  if (_has_bits_[0 / 32] & 127) {
-    ZR_(avg_, running_since_);
+void Response_ChannelSnapshot_Channel::Clear() {
+  if (_has_bits_[0 / 32] & 7) {
     if (has_name()) {
       if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
         name_->clear();
       }
     }
+    if (has_type()) {
+      if (type_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        type_->clear();
+      }
+    }
+    if (has_data()) {
+      if (data_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+        data_->clear();
+      }
+    }
   }
-
-#undef OFFSET_OF_FIELD_
-#undef ZR_
-
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool Response_ProfilingSummary_Trace::MergePartialFromCodedStream(
+bool Response_ChannelSnapshot_Channel::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:lms.Response.ProfilingSummary.Trace)
+  // @@protoc_insertion_point(parse_start:lms.Response.ChannelSnapshot.Channel)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
@@ -8685,93 +10463,33 @@ bool Response_ProfilingSummary_Trace::MergePartialFromCodedStream(
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(16)) goto parse_avg;
+        if (input->ExpectTag(18)) goto parse_type;
         break;
       }
 
-      // optional int32 avg = 2;
+      // optional string type = 2;
       case 2: {
-        if (tag == 16) {
-         parse_avg:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &avg_)));
-          set_has_avg();
+        if (tag == 18) {
+         parse_type:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->mutable_type()));
+          ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+            this->type().data(), this->type().length(),
+            ::google::protobuf::internal::WireFormat::PARSE,
+            "type");
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(24)) goto parse_std;
+        if (input->ExpectTag(26)) goto parse_data;
         break;
       }
 
-      // optional int32 std = 3;
+      // optional bytes data = 3;
       case 3: {
-        if (tag == 24) {
-         parse_std:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &std_)));
-          set_has_std();
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(32)) goto parse_max;
-        break;
-      }
-
-      // optional int32 max = 4;
-      case 4: {
-        if (tag == 32) {
-         parse_max:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &max_)));
-          set_has_max();
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(40)) goto parse_count;
-        break;
-      }
-
-      // optional int32 count = 5;
-      case 5: {
-        if (tag == 40) {
-         parse_count:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &count_)));
-          set_has_count();
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(48)) goto parse_min;
-        break;
-      }
-
-      // optional int32 min = 6;
-      case 6: {
-        if (tag == 48) {
-         parse_min:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &min_)));
-          set_has_min();
-        } else {
-          goto handle_unusual;
-        }
-        if (input->ExpectTag(56)) goto parse_running_since;
-        break;
-      }
-
-      // optional int32 running_since = 7;
-      case 7: {
-        if (tag == 56) {
-         parse_running_since:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &running_since_)));
-          set_has_running_since();
+        if (tag == 26) {
+         parse_data:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_data()));
         } else {
           goto handle_unusual;
         }
@@ -8793,17 +10511,17 @@ bool Response_ProfilingSummary_Trace::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:lms.Response.ProfilingSummary.Trace)
+  // @@protoc_insertion_point(parse_success:lms.Response.ChannelSnapshot.Channel)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:lms.Response.ProfilingSummary.Trace)
+  // @@protoc_insertion_point(parse_failure:lms.Response.ChannelSnapshot.Channel)
   return false;
 #undef DO_
 }
 
-void Response_ProfilingSummary_Trace::SerializeWithCachedSizes(
+void Response_ChannelSnapshot_Channel::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:lms.Response.ProfilingSummary.Trace)
+  // @@protoc_insertion_point(serialize_start:lms.Response.ChannelSnapshot.Channel)
   // optional string name = 1;
   if (has_name()) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
@@ -8814,46 +10532,32 @@ void Response_ProfilingSummary_Trace::SerializeWithCachedSizes(
       1, this->name(), output);
   }
 
-  // optional int32 avg = 2;
-  if (has_avg()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->avg(), output);
-  }
-
-  // optional int32 std = 3;
-  if (has_std()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(3, this->std(), output);
-  }
-
-  // optional int32 max = 4;
-  if (has_max()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(4, this->max(), output);
-  }
-
-  // optional int32 count = 5;
-  if (has_count()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(5, this->count(), output);
-  }
-
-  // optional int32 min = 6;
-  if (has_min()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(6, this->min(), output);
+  // optional string type = 2;
+  if (has_type()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->type().data(), this->type().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "type");
+    ::google::protobuf::internal::WireFormatLite::WriteStringMaybeAliased(
+      2, this->type(), output);
   }
 
-  // optional int32 running_since = 7;
-  if (has_running_since()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(7, this->running_since(), output);
+  // optional bytes data = 3;
+  if (has_data()) {
+    ::google::protobuf::internal::WireFormatLite::WriteBytesMaybeAliased(
+      3, this->data(), output);
   }
 
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:lms.Response.ProfilingSummary.Trace)
+  // @@protoc_insertion_point(serialize_end:lms.Response.ChannelSnapshot.Channel)
 }
 
-::google::protobuf::uint8* Response_ProfilingSummary_Trace::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* Response_ChannelSnapshot_Channel::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:lms.Response.ProfilingSummary.Trace)
+  // @@protoc_insertion_point(serialize_to_array_start:lms.Response.ChannelSnapshot.Channel)
   // optional string name = 1;
   if (has_name()) {
     ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
@@ -8864,46 +10568,34 @@ void Response_ProfilingSummary_Trace::SerializeWithCachedSizes(
       ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
         1, this->name(), target);
   }
-
-  // optional int32 avg = 2;
-  if (has_avg()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->avg(), target);
-  }
-
-  // optional int32 std = 3;
-  if (has_std()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(3, this->std(), target);
-  }
-
-  // optional int32 max = 4;
-  if (has_max()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(4, this->max(), target);
-  }
-
-  // optional int32 count = 5;
-  if (has_count()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(5, this->count(), target);
-  }
-
-  // optional int32 min = 6;
-  if (has_min()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(6, this->min(), target);
+
+  // optional string type = 2;
+  if (has_type()) {
+    ::google::protobuf::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->type().data(), this->type().length(),
+      ::google::protobuf::internal::WireFormat::SERIALIZE,
+      "type");
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
+        2, this->type(), target);
   }
 
-  // optional int32 running_since = 7;
-  if (has_running_since()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(7, this->running_since(), target);
+  // optional bytes data = 3;
+  if (has_data()) {
+    target =
+      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
+        3, this->data(), target);
   }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:lms.Response.ProfilingSummary.Trace)
+  // @@protoc_insertion_point(serialize_to_array_end:lms.Response.ChannelSnapshot.Channel)
   return target;
 }
 
-int Response_ProfilingSummary_Trace::ByteSize() const {
+int Response_ChannelSnapshot_Channel::ByteSize() const {
   int total_size = 0;
 
   if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
@@ -8914,46 +10606,18 @@ int Response_ProfilingSummary_Trace::ByteSize() const {
           this->name());
     }
 
-    // optional int32 avg = 2;
-    if (has_avg()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->avg());
-    }
-
-    // optional int32 std = 3;
-    if (has_std()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->std());
-    }
-
-    // optional int32 max = 4;
-    if (has_max()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->max());
-    }
-
-    // optional int32 count = 5;
-    if (has_count()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->count());
-    }
-
-    // optional int32 min = 6;
-    if (has_min()) {
+    // optional string type = 2;
+    if (has_type()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->min());
+        ::google::protobuf::internal::WireFormatLite::StringSize(
+          this->type());
     }
 
-    // optional int32 running_since = 7;
-    if (has_running_since()) {
+    // optional bytes data = 3;
+    if (has_data()) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->running_since());
+        ::google::protobuf::internal::WireFormatLite::BytesSize(
+          this->data());
     }
 
   }
@@ -8968,10 +10632,10 @@ int Response_ProfilingSummary_Trace::ByteSize() const {
   return total_size;
 }
 
-void Response_ProfilingSummary_Trace::MergeFrom(const ::google::protobuf::Message& from) {
+void Response_ChannelSnapshot_Channel::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const Response_ProfilingSummary_Trace* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Response_ProfilingSummary_Trace*>(
+  const Response_ChannelSnapshot_Channel* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Response_ChannelSnapshot_Channel*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -8980,71 +10644,55 @@ void Response_ProfilingSummary_Trace::MergeFrom(const ::google::protobuf::Messag
   }
 }
 
-void Response_ProfilingSummary_Trace::MergeFrom(const Response_ProfilingSummary_Trace& from) {
+void Response_ChannelSnapshot_Channel::MergeFrom(const Response_ChannelSnapshot_Channel& from) {
   GOOGLE_CHECK_NE(&from, this);
   if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     if (from.has_name()) {
       set_name(from.name());
     }
-    if (from.has_avg()) {
-      set_avg(from.avg());
-    }
-    if (from.has_std()) {
-      set_std(from.std());
-    }
-    if (from.has_max()) {
-      set_max(from.max());
-    }
-    if (from.has_count()) {
-      set_count(from.count());
-    }
-    if (from.has_min()) {
-      set_min(from.min());
+    if (from.has_type()) {
+      set_type(from.type());
     }
-    if (from.has_running_since()) {
-      set_running_since(from.running_since());
+    if (from.has_data()) {
+      set_data(from.data());
     }
   }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void Response_ProfilingSummary_Trace::CopyFrom(const ::google::protobuf::Message& from) {
+void Response_ChannelSnapshot_Channel::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Response_ProfilingSummary_Trace::CopyFrom(const Response_ProfilingSummary_Trace& from) {
+void Response_ChannelSnapshot_Channel::CopyFrom(const Response_ChannelSnapshot_Channel& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Response_ProfilingSummary_Trace::IsInitialized() const {
+bool Response_ChannelSnapshot_Channel::IsInitialized() const {
 
   return true;
 }
 
-void Response_ProfilingSummary_Trace::Swap(Response_ProfilingSummary_Trace* other) {
+void Response_ChannelSnapshot_Channel::Swap(Response_ChannelSnapshot_Channel* other) {
   if (other != this) {
     std::swap(name_, other->name_);
-    std::swap(avg_, other->avg_);
-    std::swap(std_, other->std_);
-    std::swap(max_, other->max_);
-    std::swap(count_, other->count_);
-    std::swap(min_, other->min_);
-    std::swap(running_since_, other->running_since_);
+    std::swap(type_, other->type_);
+    std::swap(data_, other->data_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata Response_ProfilingSummary_Trace::GetMetadata() const {
+::google::protobuf::Metadata Response_ChannelSnapshot_Channel::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Response_ProfilingSummary_Trace_descriptor_;
-  metadata.reflection = Response_ProfilingSummary_Trace_reflection_;
+  metadata.descriptor = Response_ChannelSnapshot_Channel_descriptor_;
+  metadata.reflection = Response_ChannelSnapshot_Channel_reflection_;
   return metadata;
 }
 
@@ -9052,87 +10700,124 @@ void Response_ProfilingSummary_Trace::Swap(Response_ProfilingSummary_Trace* othe
 // -------------------------------------------------------------------
 
 #ifndef _MSC_VER
-const int Response_ProfilingSummary::kTracesFieldNumber;
+const int Response_ChannelSnapshot::kCycleFieldNumber;
+const int Response_ChannelSnapshot::kTimestampFieldNumber;
+const int Response_ChannelSnapshot::kChannelsFieldNumber;
 #endif  // !_MSC_VER
 
-Response_ProfilingSummary::Response_ProfilingSummary()
+Response_ChannelSnapshot::Response_ChannelSnapshot()
   : ::google::protobuf::Message() {
   SharedCtor();
-  // @@protoc_insertion_point(constructor:lms.Response.ProfilingSummary)
+  // @@protoc_insertion_point(constructor:lms.Response.ChannelSnapshot)
 }
 
-void Response_ProfilingSummary::InitAsDefaultInstance() {
+void Response_ChannelSnapshot::InitAsDefaultInstance() {
 }
 
-Response_ProfilingSummary::Response_ProfilingSummary(const Response_ProfilingSummary& from)
+Response_ChannelSnapshot::Response_ChannelSnapshot(const Response_ChannelSnapshot& from)
   : ::google::protobuf::Message() {
   SharedCtor();
   MergeFrom(from);
-  // @@protoc_insertion_point(copy_constructor:lms.Response.ProfilingSummary)
+  // @@protoc_insertion_point(copy_constructor:lms.Response.ChannelSnapshot)
 }
 
-void Response_ProfilingSummary::SharedCtor() {
+void Response_ChannelSnapshot::SharedCtor() {
   _cached_size_ = 0;
+  cycle_ = 0;
+  timestamp_ = GOOGLE_LONGLONG(0);
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
 }
 
-Response_ProfilingSummary::~Response_ProfilingSummary() {
-  // @@protoc_insertion_point(destructor:lms.Response.ProfilingSummary)
+Response_ChannelSnapshot::~Response_ChannelSnapshot() {
+  // @@protoc_insertion_point(destructor:lms.Response.ChannelSnapshot)
   SharedDtor();
 }
 
-void Response_ProfilingSummary::SharedDtor() {
+void Response_ChannelSnapshot::SharedDtor() {
   if (this != default_instance_) {
   }
 }
 
-void Response_ProfilingSummary::SetCachedSize(int size) const {
+void Response_ChannelSnapshot::SetCachedSize(int size) const {
   GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
   _cached_size_ = size;
   GOOGLE_SAFE_CONCURRENT_WRITES_END();
 }
-const ::google::protobuf::Descriptor* Response_ProfilingSummary::descriptor() {
+const ::google::protobuf::Descriptor* Response_ChannelSnapshot::descriptor() {
   protobuf_AssignDescriptorsOnce();
-  return Response_ProfilingSummary_descriptor_;
+  return Response_ChannelSnapshot_descriptor_;
 }
 
-const Response_ProfilingSummary& Response_ProfilingSummary::default_instance() {
+const Response_ChannelSnapshot& Response_ChannelSnapshot::default_instance() {
   if (default_instance_ == NULL) protobuf_AddDesc_messages_2eproto();
   return *default_instance_;
 }
 
-Response_ProfilingSummary* Response_ProfilingSummary::default_instance_ = NULL;
+Response_ChannelSnapshot* Response_ChannelSnapshot::default_instance_ = NULL;
 
-Response_ProfilingSummary* Response_ProfilingSummary::New() const {
-  return new Response_ProfilingSummary;
+Response_ChannelSnapshot* Response_ChannelSnapshot::New() const {
+  return new Response_ChannelSnapshot;
 }
 
-void Response_ProfilingSummary::Clear() {
-  traces_.Clear();
+void Response_ChannelSnapshot::Clear() {
+  if (_has_bits_[0 / 32] & 3) {
+    cycle_ = 0;
+    timestamp_ = GOOGLE_LONGLONG(0);
+  }
+  channels_.Clear();
   ::memset(_has_bits_, 0, sizeof(_has_bits_));
   mutable_unknown_fields()->Clear();
 }
 
-bool Response_ProfilingSummary::MergePartialFromCodedStream(
+bool Response_ChannelSnapshot::MergePartialFromCodedStream(
     ::google::protobuf::io::CodedInputStream* input) {
 #define DO_(EXPRESSION) if (!(EXPRESSION)) goto failure
   ::google::protobuf::uint32 tag;
-  // @@protoc_insertion_point(parse_start:lms.Response.ProfilingSummary)
+  // @@protoc_insertion_point(parse_start:lms.Response.ChannelSnapshot)
   for (;;) {
     ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(127);
     tag = p.first;
     if (!p.second) goto handle_unusual;
     switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated .lms.Response.ProfilingSummary.Trace traces = 1;
+      // optional int32 cycle = 1;
       case 1: {
-        if (tag == 10) {
-         parse_traces:
+        if (tag == 8) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &cycle_)));
+          set_has_cycle();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(16)) goto parse_timestamp;
+        break;
+      }
+
+      // optional int64 timestamp = 2;
+      case 2: {
+        if (tag == 16) {
+         parse_timestamp:
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, &timestamp_)));
+          set_has_timestamp();
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(26)) goto parse_channels;
+        break;
+      }
+
+      // repeated .lms.Response.ChannelSnapshot.Channel channels = 3;
+      case 3: {
+        if (tag == 26) {
+         parse_channels:
           DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_traces()));
+                input, add_channels()));
         } else {
           goto handle_unusual;
         }
-        if (input->ExpectTag(10)) goto parse_traces;
+        if (input->ExpectTag(26)) goto parse_channels;
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -9151,57 +10836,93 @@ bool Response_ProfilingSummary::MergePartialFromCodedStream(
     }
   }
 success:
-  // @@protoc_insertion_point(parse_success:lms.Response.ProfilingSummary)
+  // @@protoc_insertion_point(parse_success:lms.Response.ChannelSnapshot)
   return true;
 failure:
-  // @@protoc_insertion_point(parse_failure:lms.Response.ProfilingSummary)
+  // @@protoc_insertion_point(parse_failure:lms.Response.ChannelSnapshot)
   return false;
 #undef DO_
 }
 
-void Response_ProfilingSummary::SerializeWithCachedSizes(
+void Response_ChannelSnapshot::SerializeWithCachedSizes(
     ::google::protobuf::io::CodedOutputStream* output) const {
-  // @@protoc_insertion_point(serialize_start:lms.Response.ProfilingSummary)
-  // repeated .lms.Response.ProfilingSummary.Trace traces = 1;
-  for (int i = 0; i < this->traces_size(); i++) {
+  // @@protoc_insertion_point(serialize_start:lms.Response.ChannelSnapshot)
+  // optional int32 cycle = 1;
+  if (has_cycle()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->cycle(), output);
+  }
+
+  // optional int64 timestamp = 2;
+  if (has_timestamp()) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt64(2, this->timestamp(), output);
+  }
+
+  // repeated .lms.Response.ChannelSnapshot.Channel channels = 3;
+  for (int i = 0; i < this->channels_size(); i++) {
     ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->traces(i), output);
+      3, this->channels(i), output);
   }
 
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
   }
-  // @@protoc_insertion_point(serialize_end:lms.Response.ProfilingSummary)
+  // @@protoc_insertion_point(serialize_end:lms.Response.ChannelSnapshot)
 }
 
-::google::protobuf::uint8* Response_ProfilingSummary::SerializeWithCachedSizesToArray(
+::google::protobuf::uint8* Response_ChannelSnapshot::SerializeWithCachedSizesToArray(
     ::google::protobuf::uint8* target) const {
-  // @@protoc_insertion_point(serialize_to_array_start:lms.Response.ProfilingSummary)
-  // repeated .lms.Response.ProfilingSummary.Trace traces = 1;
-  for (int i = 0; i < this->traces_size(); i++) {
+  // @@protoc_insertion_point(serialize_to_array_start:lms.Response.ChannelSnapshot)
+  // optional int32 cycle = 1;
+  if (has_cycle()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->cycle(), target);
+  }
+
+  // optional int64 timestamp = 2;
+  if (has_timestamp()) {
+    target = ::google::protobuf::internal::WireFormatLite::WriteInt64ToArray(2, this->timestamp(), target);
+  }
+
+  // repeated .lms.Response.ChannelSnapshot.Channel channels = 3;
+  for (int i = 0; i < this->channels_size(); i++) {
     target = ::google::protobuf::internal::WireFormatLite::
       WriteMessageNoVirtualToArray(
-        1, this->traces(i), target);
+        3, this->channels(i), target);
   }
 
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:lms.Response.ProfilingSummary)
+  // @@protoc_insertion_point(serialize_to_array_end:lms.Response.ChannelSnapshot)
   return target;
 }
 
-int Response_ProfilingSummary::ByteSize() const {
+int Response_ChannelSnapshot::ByteSize() const {
   int total_size = 0;
 
-  // repeated .lms.Response.ProfilingSummary.Trace traces = 1;
-  total_size += 1 * this->traces_size();
-  for (int i = 0; i < this->traces_size(); i++) {
+  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    // optional int32 cycle = 1;
+    if (has_cycle()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->cycle());
+    }
+
+    // optional int64 timestamp = 2;
+    if (has_timestamp()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int64Size(
+          this->timestamp());
+    }
+
+  }
+  // repeated .lms.Response.ChannelSnapshot.Channel channels = 3;
+  total_size += 1 * this->channels_size();
+  for (int i = 0; i < this->channels_size(); i++) {
     total_size +=
       ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->traces(i));
+        this->channels(i));
   }
 
   if (!unknown_fields().empty()) {
@@ -9215,10 +10936,10 @@ int Response_ProfilingSummary::ByteSize() const {
   return total_size;
 }
 
-void Response_ProfilingSummary::MergeFrom(const ::google::protobuf::Message& from) {
+void Response_ChannelSnapshot::MergeFrom(const ::google::protobuf::Message& from) {
   GOOGLE_CHECK_NE(&from, this);
-  const Response_ProfilingSummary* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Response_ProfilingSummary*>(
+  const Response_ChannelSnapshot* source =
+    ::google::protobuf::internal::dynamic_cast_if_available<const Response_ChannelSnapshot*>(
       &from);
   if (source == NULL) {
     ::google::protobuf::internal::ReflectionOps::Merge(from, this);
@@ -9227,43 +10948,53 @@ void Response_ProfilingSummary::MergeFrom(const ::google::protobuf::Message& fro
   }
 }
 
-void Response_ProfilingSummary::MergeFrom(const Response_ProfilingSummary& from) {
+void Response_ChannelSnapshot::MergeFrom(const Response_ChannelSnapshot& from) {
   GOOGLE_CHECK_NE(&from, this);
-  traces_.MergeFrom(from.traces_);
+  channels_.MergeFrom(from.channels_);
+  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+    if (from.has_cycle()) {
+      set_cycle(from.cycle());
+    }
+    if (from.has_timestamp()) {
+      set_timestamp(from.timestamp());
+    }
+  }
   mutable_unknown_fields()->MergeFrom(from.unknown_fields());
 }
 
-void Response_ProfilingSummary::CopyFrom(const ::google::protobuf::Message& from) {
+void Response_ChannelSnapshot::CopyFrom(const ::google::protobuf::Message& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Response_ProfilingSummary::CopyFrom(const Response_ProfilingSummary& from) {
+void Response_ChannelSnapshot::CopyFrom(const Response_ChannelSnapshot& from) {
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Response_ProfilingSummary::IsInitialized() const {
+bool Response_ChannelSnapshot::IsInitialized() const {
 
   return true;
 }
 
-void Response_ProfilingSummary::Swap(Response_ProfilingSummary* other) {
+void Response_ChannelSnapshot::Swap(Response_ChannelSnapshot* other) {
   if (other != this) {
-    traces_.Swap(&other->traces_);
+    std::swap(cycle_, other->cycle_);
+    std::swap(timestamp_, other->timestamp_);
+    channels_.Swap(&other->channels_);
     std::swap(_has_bits_[0], other->_has_bits_[0]);
     _unknown_fields_.Swap(&other->_unknown_fields_);
     std::swap(_cached_size_, other->_cached_size_);
   }
 }
 
-::google::protobuf::Metadata Response_ProfilingSummary::GetMetadata() const {
+::google::protobuf::Metadata Response_ChannelSnapshot::GetMetadata() const {
   protobuf_AssignDescriptorsOnce();
   ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Response_ProfilingSummary_descriptor_;
-  metadata.reflection = Response_ProfilingSummary_reflection_;
+  metadata.descriptor = Response_ChannelSnapshot_descriptor_;
+  metadata.reflection = Response_ChannelSnapshot_reflection_;
   return metadata;
 }
 
@@ -9277,6 +11008,8 @@ const int Response::kProcessListFieldNumber;
 const int Response::kModuleListFieldNumber;
 const int Response::kLogEventFieldNumber;
 const int Response::kProfilingSummaryFieldNumber;
+const int Response::kLogEventBatchFieldNumber;
+const int Response::kChannelSnapshotFieldNumber;
 #endif  // !_MSC_VER
 
 Response::Response()
@@ -9292,6 +11025,8 @@ void Response::InitAsDefaultInstance() {
   Response_default_oneof_instance_->module_list_ = const_cast< ::lms::Response_ModuleListResponse*>(&::lms::Response_ModuleListResponse::default_instance());
   Response_default_oneof_instance_->log_event_ = const_cast< ::lms::Response_LogEvent*>(&::lms::Response_LogEvent::default_instance());
   Response_default_oneof_instance_->profiling_summary_ = const_cast< ::lms::Response_ProfilingSummary*>(&::lms::Response_ProfilingSummary::default_instance());
+  Response_default_oneof_instance_->log_event_batch_ = const_cast< ::lms::Response_LogEventBatch*>(&::lms::Response_LogEventBatch::default_instance());
+  Response_default_oneof_instance_->channel_snapshot_ = const_cast< ::lms::Response_ChannelSnapshot*>(&::lms::Response_ChannelSnapshot::default_instance());
 }
 
 Response::Response(const Response& from)
@@ -9367,6 +11102,14 @@ void Response::clear_content() {
       delete content_.profiling_summary_;
       break;
     }
+    case kLogEventBatch: {
+      delete content_.log_event_batch_;
+      break;
+    }
+    case kChannelSnapshot: {
+      delete content_.channel_snapshot_;
+      break;
+    }
     case CONTENT_NOT_SET: {
       break;
     }
@@ -9464,6 +11207,32 @@ bool Response::MergePartialFromCodedStream(
         } else {
           goto handle_unusual;
         }
+        if (input->ExpectTag(58)) goto parse_log_event_batch;
+        break;
+      }
+
+      // optional .lms.Response.LogEventBatch log_event_batch = 7;
+      case 7: {
+        if (tag == 58) {
+         parse_log_event_batch:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_log_event_batch()));
+        } else {
+          goto handle_unusual;
+        }
+        if (input->ExpectTag(66)) goto parse_channel_snapshot;
+        break;
+      }
+
+      // optional .lms.Response.ChannelSnapshot channel_snapshot = 8;
+      case 8: {
+        if (tag == 66) {
+         parse_channel_snapshot:
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_channel_snapshot()));
+        } else {
+          goto handle_unusual;
+        }
         if (input->ExpectAtEnd()) goto success;
         break;
       }
@@ -9529,6 +11298,18 @@ void Response::SerializeWithCachedSizes(
       6, this->profiling_summary(), output);
   }
 
+  // optional .lms.Response.LogEventBatch log_event_batch = 7;
+  if (has_log_event_batch()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      7, this->log_event_batch(), output);
+  }
+
+  // optional .lms.Response.ChannelSnapshot channel_snapshot = 8;
+  if (has_channel_snapshot()) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
+      8, this->channel_snapshot(), output);
+  }
+
   if (!unknown_fields().empty()) {
     ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
         unknown_fields(), output);
@@ -9581,6 +11362,20 @@ void Response::SerializeWithCachedSizes(
         6, this->profiling_summary(), target);
   }
 
+  // optional .lms.Response.LogEventBatch log_event_batch = 7;
+  if (has_log_event_batch()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        7, this->log_event_batch(), target);
+  }
+
+  // optional .lms.Response.ChannelSnapshot channel_snapshot = 8;
+  if (has_channel_snapshot()) {
+    target = ::google::protobuf::internal::WireFormatLite::
+      WriteMessageNoVirtualToArray(
+        8, this->channel_snapshot(), target);
+  }
+
   if (!unknown_fields().empty()) {
     target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
         unknown_fields(), target);
@@ -9635,6 +11430,20 @@ int Response::ByteSize() const {
           this->profiling_summary());
       break;
     }
+    // optional .lms.Response.LogEventBatch log_event_batch = 7;
+    case kLogEventBatch: {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->log_event_batch());
+      break;
+    }
+    // optional .lms.Response.ChannelSnapshot channel_snapshot = 8;
+    case kChannelSnapshot: {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          this->channel_snapshot());
+      break;
+    }
     case CONTENT_NOT_SET: {
       break;
     }
@@ -9689,6 +11498,14 @@ void Response::MergeFrom(const Response& from) {
       mutable_profiling_summary()->::lms::Response_ProfilingSummary::MergeFrom(from.profiling_summary());
       break;
     }
+    case kLogEventBatch: {
+      mutable_log_event_batch()->::lms::Response_LogEventBatch::MergeFrom(from.log_event_batch());
+      break;
+    }
+    case kChannelSnapshot: {
+      mutable_channel_snapshot()->::lms::Response_ChannelSnapshot::MergeFrom(from.channel_snapshot());
+      break;
+    }
     case CONTENT_NOT_SET: {
       break;
     }
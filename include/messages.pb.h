@@ -50,6 +50,8 @@ class Request_Runtime_LogFilter;
 class Request_Runtime_Profiling;
 class Request_Runtime_StartRecording;
 class Request_Runtime_StopRecording;
+class Request_Runtime_DumpFlightRecorder;
+class Request_Runtime_ChannelSubscribe;
 class Request_Stdin;
 class Response;
 class Response_Info;
@@ -61,8 +63,11 @@ class Response_ModuleListResponse;
 class Response_ModuleListResponse_Access;
 class Response_ModuleListResponse_Channel;
 class Response_LogEvent;
+class Response_LogEventBatch;
 class Response_ProfilingSummary;
 class Response_ProfilingSummary_Trace;
+class Response_ChannelSnapshot;
+class Response_ChannelSnapshot_Channel;
 
 enum Response_ModuleListResponse_Permission {
   Response_ModuleListResponse_Permission_READ = 1,
@@ -1358,6 +1363,186 @@ class Request_Runtime_StopRecording : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
+class Request_Runtime_DumpFlightRecorder : public ::google::protobuf::Message {
+ public:
+  Request_Runtime_DumpFlightRecorder();
+  virtual ~Request_Runtime_DumpFlightRecorder();
+
+  Request_Runtime_DumpFlightRecorder(const Request_Runtime_DumpFlightRecorder& from);
+
+  inline Request_Runtime_DumpFlightRecorder& operator=(const Request_Runtime_DumpFlightRecorder& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const Request_Runtime_DumpFlightRecorder& default_instance();
+
+  void Swap(Request_Runtime_DumpFlightRecorder* other);
+
+  // implements Message ----------------------------------------------
+
+  Request_Runtime_DumpFlightRecorder* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const Request_Runtime_DumpFlightRecorder& from);
+  void MergeFrom(const Request_Runtime_DumpFlightRecorder& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional string tag = 1;
+  inline bool has_tag() const;
+  inline void clear_tag();
+  static const int kTagFieldNumber = 1;
+  inline const ::std::string& tag() const;
+  inline void set_tag(const ::std::string& value);
+  inline void set_tag(const char* value);
+  inline void set_tag(const char* value, size_t size);
+  inline ::std::string* mutable_tag();
+  inline ::std::string* release_tag();
+  inline void set_allocated_tag(::std::string* tag);
+
+  // @@protoc_insertion_point(class_scope:lms.Request.Runtime.DumpFlightRecorder)
+ private:
+  inline void set_has_tag();
+  inline void clear_has_tag();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::uint32 _has_bits_[1];
+  mutable int _cached_size_;
+  ::std::string* tag_;
+  friend void  protobuf_AddDesc_messages_2eproto();
+  friend void protobuf_AssignDesc_messages_2eproto();
+  friend void protobuf_ShutdownFile_messages_2eproto();
+
+  void InitAsDefaultInstance();
+  static Request_Runtime_DumpFlightRecorder* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class Request_Runtime_ChannelSubscribe : public ::google::protobuf::Message {
+ public:
+  Request_Runtime_ChannelSubscribe();
+  virtual ~Request_Runtime_ChannelSubscribe();
+
+  Request_Runtime_ChannelSubscribe(const Request_Runtime_ChannelSubscribe& from);
+
+  inline Request_Runtime_ChannelSubscribe& operator=(const Request_Runtime_ChannelSubscribe& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const Request_Runtime_ChannelSubscribe& default_instance();
+
+  void Swap(Request_Runtime_ChannelSubscribe* other);
+
+  // implements Message ----------------------------------------------
+
+  Request_Runtime_ChannelSubscribe* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const Request_Runtime_ChannelSubscribe& from);
+  void MergeFrom(const Request_Runtime_ChannelSubscribe& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated string channels = 1;
+  inline int channels_size() const;
+  inline void clear_channels();
+  static const int kChannelsFieldNumber = 1;
+  inline const ::std::string& channels(int index) const;
+  inline ::std::string* mutable_channels(int index);
+  inline void set_channels(int index, const ::std::string& value);
+  inline void set_channels(int index, const char* value);
+  inline void set_channels(int index, const char* value, size_t size);
+  inline ::std::string* add_channels();
+  inline void add_channels(const ::std::string& value);
+  inline void add_channels(const char* value);
+  inline void add_channels(const char* value, size_t size);
+  inline const ::google::protobuf::RepeatedPtrField< ::std::string>& channels() const;
+  inline ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_channels();
+
+  // optional float sample_rate = 2 [default = 10];
+  inline bool has_sample_rate() const;
+  inline void clear_sample_rate();
+  static const int kSampleRateFieldNumber = 2;
+  inline float sample_rate() const;
+  inline void set_sample_rate(float value);
+
+  // @@protoc_insertion_point(class_scope:lms.Request.Runtime.ChannelSubscribe)
+ private:
+  inline void set_has_sample_rate();
+  inline void clear_has_sample_rate();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::uint32 _has_bits_[1];
+  mutable int _cached_size_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> channels_;
+  float sample_rate_;
+  friend void  protobuf_AddDesc_messages_2eproto();
+  friend void protobuf_AssignDesc_messages_2eproto();
+  friend void protobuf_ShutdownFile_messages_2eproto();
+
+  void InitAsDefaultInstance();
+  static Request_Runtime_ChannelSubscribe* default_instance_;
+};
+// -------------------------------------------------------------------
+
 class Request_Runtime : public ::google::protobuf::Message {
  public:
   Request_Runtime();
@@ -1386,6 +1571,8 @@ class Request_Runtime : public ::google::protobuf::Message {
     kProfiling = 3,
     kStartRecording = 4,
     kStopRecording = 5,
+    kDumpFlightRecorder = 6,
+    kChannelSubscribe = 7,
     CONTENT_NOT_SET = 0,
   };
 
@@ -1421,6 +1608,8 @@ class Request_Runtime : public ::google::protobuf::Message {
   typedef Request_Runtime_Profiling Profiling;
   typedef Request_Runtime_StartRecording StartRecording;
   typedef Request_Runtime_StopRecording StopRecording;
+  typedef Request_Runtime_DumpFlightRecorder DumpFlightRecorder;
+  typedef Request_Runtime_ChannelSubscribe ChannelSubscribe;
 
   // accessors -------------------------------------------------------
 
@@ -1472,6 +1661,24 @@ class Request_Runtime : public ::google::protobuf::Message {
   inline ::lms::Request_Runtime_StopRecording* release_stop_recording();
   inline void set_allocated_stop_recording(::lms::Request_Runtime_StopRecording* stop_recording);
 
+  // optional .lms.Request.Runtime.DumpFlightRecorder dump_flight_recorder = 6;
+  inline bool has_dump_flight_recorder() const;
+  inline void clear_dump_flight_recorder();
+  static const int kDumpFlightRecorderFieldNumber = 6;
+  inline const ::lms::Request_Runtime_DumpFlightRecorder& dump_flight_recorder() const;
+  inline ::lms::Request_Runtime_DumpFlightRecorder* mutable_dump_flight_recorder();
+  inline ::lms::Request_Runtime_DumpFlightRecorder* release_dump_flight_recorder();
+  inline void set_allocated_dump_flight_recorder(::lms::Request_Runtime_DumpFlightRecorder* dump_flight_recorder);
+
+  // optional .lms.Request.Runtime.ChannelSubscribe channel_subscribe = 7;
+  inline bool has_channel_subscribe() const;
+  inline void clear_channel_subscribe();
+  static const int kChannelSubscribeFieldNumber = 7;
+  inline const ::lms::Request_Runtime_ChannelSubscribe& channel_subscribe() const;
+  inline ::lms::Request_Runtime_ChannelSubscribe* mutable_channel_subscribe();
+  inline ::lms::Request_Runtime_ChannelSubscribe* release_channel_subscribe();
+  inline void set_allocated_channel_subscribe(::lms::Request_Runtime_ChannelSubscribe* channel_subscribe);
+
   inline ContentCase content_case() const;
   // @@protoc_insertion_point(class_scope:lms.Request.Runtime)
  private:
@@ -1481,6 +1688,8 @@ class Request_Runtime : public ::google::protobuf::Message {
   inline void set_has_profiling();
   inline void set_has_start_recording();
   inline void set_has_stop_recording();
+  inline void set_has_dump_flight_recorder();
+  inline void set_has_channel_subscribe();
 
   inline bool has_content();
   void clear_content();
@@ -1496,6 +1705,8 @@ class Request_Runtime : public ::google::protobuf::Message {
     ::lms::Request_Runtime_Profiling* profiling_;
     ::lms::Request_Runtime_StartRecording* start_recording_;
     ::lms::Request_Runtime_StopRecording* stop_recording_;
+    ::lms::Request_Runtime_DumpFlightRecorder* dump_flight_recorder_;
+    ::lms::Request_Runtime_ChannelSubscribe* channel_subscribe_;
   } content_;
   ::google::protobuf::uint32 _oneof_case_[1];
 
@@ -2759,6 +2970,108 @@ class Response_LogEvent : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
+class Response_LogEventBatch : public ::google::protobuf::Message {
+ public:
+  Response_LogEventBatch();
+  virtual ~Response_LogEventBatch();
+
+  Response_LogEventBatch(const Response_LogEventBatch& from);
+
+  inline Response_LogEventBatch& operator=(const Response_LogEventBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const Response_LogEventBatch& default_instance();
+
+  void Swap(Response_LogEventBatch* other);
+
+  // implements Message ----------------------------------------------
+
+  Response_LogEventBatch* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const Response_LogEventBatch& from);
+  void MergeFrom(const Response_LogEventBatch& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated .lms.Response.LogEvent events = 1;
+  inline int events_size() const;
+  inline void clear_events();
+  static const int kEventsFieldNumber = 1;
+  inline const ::lms::Response_LogEvent& events(int index) const;
+  inline ::lms::Response_LogEvent* mutable_events(int index);
+  inline ::lms::Response_LogEvent* add_events();
+  inline const ::google::protobuf::RepeatedPtrField< ::lms::Response_LogEvent >&
+      events() const;
+  inline ::google::protobuf::RepeatedPtrField< ::lms::Response_LogEvent >*
+      mutable_events();
+
+  // optional .lms.Response.LogEvent.Level min_level = 2;
+  inline bool has_min_level() const;
+  inline void clear_min_level();
+  static const int kMinLevelFieldNumber = 2;
+  inline ::lms::Response_LogEvent_Level min_level() const;
+  inline void set_min_level(::lms::Response_LogEvent_Level value);
+
+  // optional .lms.Response.LogEvent.Level max_level = 3;
+  inline bool has_max_level() const;
+  inline void clear_max_level();
+  static const int kMaxLevelFieldNumber = 3;
+  inline ::lms::Response_LogEvent_Level max_level() const;
+  inline void set_max_level(::lms::Response_LogEvent_Level value);
+
+  // @@protoc_insertion_point(class_scope:lms.Response.LogEventBatch)
+ private:
+  inline void set_has_min_level();
+  inline void clear_has_min_level();
+  inline void set_has_max_level();
+  inline void clear_has_max_level();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::uint32 _has_bits_[1];
+  mutable int _cached_size_;
+  ::google::protobuf::RepeatedPtrField< ::lms::Response_LogEvent > events_;
+  int min_level_;
+  int max_level_;
+  friend void  protobuf_AddDesc_messages_2eproto();
+  friend void protobuf_AssignDesc_messages_2eproto();
+  friend void protobuf_ShutdownFile_messages_2eproto();
+
+  void InitAsDefaultInstance();
+  static Response_LogEventBatch* default_instance_;
+};
+// -------------------------------------------------------------------
+
 class Response_ProfilingSummary_Trace : public ::google::protobuf::Message {
  public:
   Response_ProfilingSummary_Trace();
@@ -2987,14 +3300,14 @@ class Response_ProfilingSummary : public ::google::protobuf::Message {
 };
 // -------------------------------------------------------------------
 
-class Response : public ::google::protobuf::Message {
+class Response_ChannelSnapshot_Channel : public ::google::protobuf::Message {
  public:
-  Response();
-  virtual ~Response();
+  Response_ChannelSnapshot_Channel();
+  virtual ~Response_ChannelSnapshot_Channel();
 
-  Response(const Response& from);
+  Response_ChannelSnapshot_Channel(const Response_ChannelSnapshot_Channel& from);
 
-  inline Response& operator=(const Response& from) {
+  inline Response_ChannelSnapshot_Channel& operator=(const Response_ChannelSnapshot_Channel& from) {
     CopyFrom(from);
     return *this;
   }
@@ -3008,27 +3321,17 @@ class Response : public ::google::protobuf::Message {
   }
 
   static const ::google::protobuf::Descriptor* descriptor();
-  static const Response& default_instance();
-
-  enum ContentCase {
-    kInfo = 1,
-    kClientList = 2,
-    kProcessList = 3,
-    kModuleList = 4,
-    kLogEvent = 5,
-    kProfilingSummary = 6,
-    CONTENT_NOT_SET = 0,
-  };
+  static const Response_ChannelSnapshot_Channel& default_instance();
 
-  void Swap(Response* other);
+  void Swap(Response_ChannelSnapshot_Channel* other);
 
   // implements Message ----------------------------------------------
 
-  Response* New() const;
+  Response_ChannelSnapshot_Channel* New() const;
   void CopyFrom(const ::google::protobuf::Message& from);
   void MergeFrom(const ::google::protobuf::Message& from);
-  void CopyFrom(const Response& from);
-  void MergeFrom(const Response& from);
+  void CopyFrom(const Response_ChannelSnapshot_Channel& from);
+  void MergeFrom(const Response_ChannelSnapshot_Channel& from);
   void Clear();
   bool IsInitialized() const;
 
@@ -3048,29 +3351,261 @@ class Response : public ::google::protobuf::Message {
 
   // nested types ----------------------------------------------------
 
-  typedef Response_Info Info;
-  typedef Response_ClientList ClientList;
-  typedef Response_ProcessList ProcessList;
-  typedef Response_ModuleListResponse ModuleListResponse;
-  typedef Response_LogEvent LogEvent;
-  typedef Response_ProfilingSummary ProfilingSummary;
-
   // accessors -------------------------------------------------------
 
-  // optional .lms.Response.Info info = 1;
-  inline bool has_info() const;
-  inline void clear_info();
-  static const int kInfoFieldNumber = 1;
-  inline const ::lms::Response_Info& info() const;
-  inline ::lms::Response_Info* mutable_info();
-  inline ::lms::Response_Info* release_info();
-  inline void set_allocated_info(::lms::Response_Info* info);
+  // optional string name = 1;
+  inline bool has_name() const;
+  inline void clear_name();
+  static const int kNameFieldNumber = 1;
+  inline const ::std::string& name() const;
+  inline void set_name(const ::std::string& value);
+  inline void set_name(const char* value);
+  inline void set_name(const char* value, size_t size);
+  inline ::std::string* mutable_name();
+  inline ::std::string* release_name();
+  inline void set_allocated_name(::std::string* name);
 
-  // optional .lms.Response.ClientList client_list = 2;
-  inline bool has_client_list() const;
-  inline void clear_client_list();
-  static const int kClientListFieldNumber = 2;
-  inline const ::lms::Response_ClientList& client_list() const;
+  // optional string type = 2;
+  inline bool has_type() const;
+  inline void clear_type();
+  static const int kTypeFieldNumber = 2;
+  inline const ::std::string& type() const;
+  inline void set_type(const ::std::string& value);
+  inline void set_type(const char* value);
+  inline void set_type(const char* value, size_t size);
+  inline ::std::string* mutable_type();
+  inline ::std::string* release_type();
+  inline void set_allocated_type(::std::string* type);
+
+  // optional bytes data = 3;
+  inline bool has_data() const;
+  inline void clear_data();
+  static const int kDataFieldNumber = 3;
+  inline const ::std::string& data() const;
+  inline void set_data(const ::std::string& value);
+  inline void set_data(const char* value);
+  inline void set_data(const void* value, size_t size);
+  inline ::std::string* mutable_data();
+  inline ::std::string* release_data();
+  inline void set_allocated_data(::std::string* data);
+
+  // @@protoc_insertion_point(class_scope:lms.Response.ChannelSnapshot.Channel)
+ private:
+  inline void set_has_name();
+  inline void clear_has_name();
+  inline void set_has_type();
+  inline void clear_has_type();
+  inline void set_has_data();
+  inline void clear_has_data();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::uint32 _has_bits_[1];
+  mutable int _cached_size_;
+  ::std::string* name_;
+  ::std::string* type_;
+  ::std::string* data_;
+  friend void  protobuf_AddDesc_messages_2eproto();
+  friend void protobuf_AssignDesc_messages_2eproto();
+  friend void protobuf_ShutdownFile_messages_2eproto();
+
+  void InitAsDefaultInstance();
+  static Response_ChannelSnapshot_Channel* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class Response_ChannelSnapshot : public ::google::protobuf::Message {
+ public:
+  Response_ChannelSnapshot();
+  virtual ~Response_ChannelSnapshot();
+
+  Response_ChannelSnapshot(const Response_ChannelSnapshot& from);
+
+  inline Response_ChannelSnapshot& operator=(const Response_ChannelSnapshot& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const Response_ChannelSnapshot& default_instance();
+
+  void Swap(Response_ChannelSnapshot* other);
+
+  // implements Message ----------------------------------------------
+
+  Response_ChannelSnapshot* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const Response_ChannelSnapshot& from);
+  void MergeFrom(const Response_ChannelSnapshot& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  typedef Response_ChannelSnapshot_Channel Channel;
+
+  // accessors -------------------------------------------------------
+
+  // optional int32 cycle = 1;
+  inline bool has_cycle() const;
+  inline void clear_cycle();
+  static const int kCycleFieldNumber = 1;
+  inline ::google::protobuf::int32 cycle() const;
+  inline void set_cycle(::google::protobuf::int32 value);
+
+  // optional int64 timestamp = 2;
+  inline bool has_timestamp() const;
+  inline void clear_timestamp();
+  static const int kTimestampFieldNumber = 2;
+  inline ::google::protobuf::int64 timestamp() const;
+  inline void set_timestamp(::google::protobuf::int64 value);
+
+  // repeated .lms.Response.ChannelSnapshot.Channel channels = 3;
+  inline int channels_size() const;
+  inline void clear_channels();
+  static const int kChannelsFieldNumber = 3;
+  inline const ::lms::Response_ChannelSnapshot_Channel& channels(int index) const;
+  inline ::lms::Response_ChannelSnapshot_Channel* mutable_channels(int index);
+  inline ::lms::Response_ChannelSnapshot_Channel* add_channels();
+  inline const ::google::protobuf::RepeatedPtrField< ::lms::Response_ChannelSnapshot_Channel >&
+      channels() const;
+  inline ::google::protobuf::RepeatedPtrField< ::lms::Response_ChannelSnapshot_Channel >*
+      mutable_channels();
+
+  // @@protoc_insertion_point(class_scope:lms.Response.ChannelSnapshot)
+ private:
+  inline void set_has_cycle();
+  inline void clear_has_cycle();
+  inline void set_has_timestamp();
+  inline void clear_has_timestamp();
+
+  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+
+  ::google::protobuf::uint32 _has_bits_[1];
+  mutable int _cached_size_;
+  ::google::protobuf::int64 timestamp_;
+  ::google::protobuf::RepeatedPtrField< ::lms::Response_ChannelSnapshot_Channel > channels_;
+  ::google::protobuf::int32 cycle_;
+  friend void  protobuf_AddDesc_messages_2eproto();
+  friend void protobuf_AssignDesc_messages_2eproto();
+  friend void protobuf_ShutdownFile_messages_2eproto();
+
+  void InitAsDefaultInstance();
+  static Response_ChannelSnapshot* default_instance_;
+};
+// -------------------------------------------------------------------
+
+class Response : public ::google::protobuf::Message {
+ public:
+  Response();
+  virtual ~Response();
+
+  Response(const Response& from);
+
+  inline Response& operator=(const Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
+    return _unknown_fields_;
+  }
+
+  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
+    return &_unknown_fields_;
+  }
+
+  static const ::google::protobuf::Descriptor* descriptor();
+  static const Response& default_instance();
+
+  enum ContentCase {
+    kInfo = 1,
+    kClientList = 2,
+    kProcessList = 3,
+    kModuleList = 4,
+    kLogEvent = 5,
+    kProfilingSummary = 6,
+    kLogEventBatch = 7,
+    kChannelSnapshot = 8,
+    CONTENT_NOT_SET = 0,
+  };
+
+  void Swap(Response* other);
+
+  // implements Message ----------------------------------------------
+
+  Response* New() const;
+  void CopyFrom(const ::google::protobuf::Message& from);
+  void MergeFrom(const ::google::protobuf::Message& from);
+  void CopyFrom(const Response& from);
+  void MergeFrom(const Response& from);
+  void Clear();
+  bool IsInitialized() const;
+
+  int ByteSize() const;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input);
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const;
+  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
+  int GetCachedSize() const { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  public:
+  ::google::protobuf::Metadata GetMetadata() const;
+
+  // nested types ----------------------------------------------------
+
+  typedef Response_Info Info;
+  typedef Response_ClientList ClientList;
+  typedef Response_ProcessList ProcessList;
+  typedef Response_ModuleListResponse ModuleListResponse;
+  typedef Response_LogEvent LogEvent;
+  typedef Response_LogEventBatch LogEventBatch;
+  typedef Response_ProfilingSummary ProfilingSummary;
+  typedef Response_ChannelSnapshot ChannelSnapshot;
+
+  // accessors -------------------------------------------------------
+
+  // optional .lms.Response.Info info = 1;
+  inline bool has_info() const;
+  inline void clear_info();
+  static const int kInfoFieldNumber = 1;
+  inline const ::lms::Response_Info& info() const;
+  inline ::lms::Response_Info* mutable_info();
+  inline ::lms::Response_Info* release_info();
+  inline void set_allocated_info(::lms::Response_Info* info);
+
+  // optional .lms.Response.ClientList client_list = 2;
+  inline bool has_client_list() const;
+  inline void clear_client_list();
+  static const int kClientListFieldNumber = 2;
+  inline const ::lms::Response_ClientList& client_list() const;
   inline ::lms::Response_ClientList* mutable_client_list();
   inline ::lms::Response_ClientList* release_client_list();
   inline void set_allocated_client_list(::lms::Response_ClientList* client_list);
@@ -3111,6 +3646,24 @@ class Response : public ::google::protobuf::Message {
   inline ::lms::Response_ProfilingSummary* release_profiling_summary();
   inline void set_allocated_profiling_summary(::lms::Response_ProfilingSummary* profiling_summary);
 
+  // optional .lms.Response.LogEventBatch log_event_batch = 7;
+  inline bool has_log_event_batch() const;
+  inline void clear_log_event_batch();
+  static const int kLogEventBatchFieldNumber = 7;
+  inline const ::lms::Response_LogEventBatch& log_event_batch() const;
+  inline ::lms::Response_LogEventBatch* mutable_log_event_batch();
+  inline ::lms::Response_LogEventBatch* release_log_event_batch();
+  inline void set_allocated_log_event_batch(::lms::Response_LogEventBatch* log_event_batch);
+
+  // optional .lms.Response.ChannelSnapshot channel_snapshot = 8;
+  inline bool has_channel_snapshot() const;
+  inline void clear_channel_snapshot();
+  static const int kChannelSnapshotFieldNumber = 8;
+  inline const ::lms::Response_ChannelSnapshot& channel_snapshot() const;
+  inline ::lms::Response_ChannelSnapshot* mutable_channel_snapshot();
+  inline ::lms::Response_ChannelSnapshot* release_channel_snapshot();
+  inline void set_allocated_channel_snapshot(::lms::Response_ChannelSnapshot* channel_snapshot);
+
   inline ContentCase content_case() const;
   // @@protoc_insertion_point(class_scope:lms.Response)
  private:
@@ -3120,6 +3673,8 @@ class Response : public ::google::protobuf::Message {
   inline void set_has_module_list();
   inline void set_has_log_event();
   inline void set_has_profiling_summary();
+  inline void set_has_log_event_batch();
+  inline void set_has_channel_snapshot();
 
   inline bool has_content();
   void clear_content();
@@ -3136,6 +3691,8 @@ class Response : public ::google::protobuf::Message {
     ::lms::Response_ModuleListResponse* module_list_;
     ::lms::Response_LogEvent* log_event_;
     ::lms::Response_ProfilingSummary* profiling_summary_;
+    ::lms::Response_LogEventBatch* log_event_batch_;
+    ::lms::Response_ChannelSnapshot* channel_snapshot_;
   } content_;
   ::google::protobuf::uint32 _oneof_case_[1];
 
@@ -4222,6 +4779,168 @@ inline void Request_Runtime_StopRecording::set_allocated_tag(::std::string* tag)
 
 // -------------------------------------------------------------------
 
+// Request_Runtime_DumpFlightRecorder
+
+// optional string tag = 1;
+inline bool Request_Runtime_DumpFlightRecorder::has_tag() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void Request_Runtime_DumpFlightRecorder::set_has_tag() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void Request_Runtime_DumpFlightRecorder::clear_has_tag() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void Request_Runtime_DumpFlightRecorder::clear_tag() {
+  if (tag_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    tag_->clear();
+  }
+  clear_has_tag();
+}
+inline const ::std::string& Request_Runtime_DumpFlightRecorder::tag() const {
+  // @@protoc_insertion_point(field_get:lms.Request.Runtime.DumpFlightRecorder.tag)
+  return *tag_;
+}
+inline void Request_Runtime_DumpFlightRecorder::set_tag(const ::std::string& value) {
+  set_has_tag();
+  if (tag_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    tag_ = new ::std::string;
+  }
+  tag_->assign(value);
+  // @@protoc_insertion_point(field_set:lms.Request.Runtime.DumpFlightRecorder.tag)
+}
+inline void Request_Runtime_DumpFlightRecorder::set_tag(const char* value) {
+  set_has_tag();
+  if (tag_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    tag_ = new ::std::string;
+  }
+  tag_->assign(value);
+  // @@protoc_insertion_point(field_set_char:lms.Request.Runtime.DumpFlightRecorder.tag)
+}
+inline void Request_Runtime_DumpFlightRecorder::set_tag(const char* value, size_t size) {
+  set_has_tag();
+  if (tag_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    tag_ = new ::std::string;
+  }
+  tag_->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:lms.Request.Runtime.DumpFlightRecorder.tag)
+}
+inline ::std::string* Request_Runtime_DumpFlightRecorder::mutable_tag() {
+  set_has_tag();
+  if (tag_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    tag_ = new ::std::string;
+  }
+  // @@protoc_insertion_point(field_mutable:lms.Request.Runtime.DumpFlightRecorder.tag)
+  return tag_;
+}
+inline ::std::string* Request_Runtime_DumpFlightRecorder::release_tag() {
+  clear_has_tag();
+  if (tag_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    return NULL;
+  } else {
+    ::std::string* temp = tag_;
+    tag_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    return temp;
+  }
+}
+inline void Request_Runtime_DumpFlightRecorder::set_allocated_tag(::std::string* tag) {
+  if (tag_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete tag_;
+  }
+  if (tag) {
+    set_has_tag();
+    tag_ = tag;
+  } else {
+    clear_has_tag();
+    tag_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  }
+  // @@protoc_insertion_point(field_set_allocated:lms.Request.Runtime.DumpFlightRecorder.tag)
+}
+
+// -------------------------------------------------------------------
+
+// Request_Runtime_ChannelSubscribe
+
+// repeated string channels = 1;
+inline int Request_Runtime_ChannelSubscribe::channels_size() const {
+  return channels_.size();
+}
+inline void Request_Runtime_ChannelSubscribe::clear_channels() {
+  channels_.Clear();
+}
+inline const ::std::string& Request_Runtime_ChannelSubscribe::channels(int index) const {
+  // @@protoc_insertion_point(field_get:lms.Request.Runtime.ChannelSubscribe.channels)
+  return channels_.Get(index);
+}
+inline ::std::string* Request_Runtime_ChannelSubscribe::mutable_channels(int index) {
+  // @@protoc_insertion_point(field_mutable:lms.Request.Runtime.ChannelSubscribe.channels)
+  return channels_.Mutable(index);
+}
+inline void Request_Runtime_ChannelSubscribe::set_channels(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:lms.Request.Runtime.ChannelSubscribe.channels)
+  channels_.Mutable(index)->assign(value);
+}
+inline void Request_Runtime_ChannelSubscribe::set_channels(int index, const char* value) {
+  channels_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:lms.Request.Runtime.ChannelSubscribe.channels)
+}
+inline void Request_Runtime_ChannelSubscribe::set_channels(int index, const char* value, size_t size) {
+  channels_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:lms.Request.Runtime.ChannelSubscribe.channels)
+}
+inline ::std::string* Request_Runtime_ChannelSubscribe::add_channels() {
+  return channels_.Add();
+}
+inline void Request_Runtime_ChannelSubscribe::add_channels(const ::std::string& value) {
+  channels_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:lms.Request.Runtime.ChannelSubscribe.channels)
+}
+inline void Request_Runtime_ChannelSubscribe::add_channels(const char* value) {
+  channels_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:lms.Request.Runtime.ChannelSubscribe.channels)
+}
+inline void Request_Runtime_ChannelSubscribe::add_channels(const char* value, size_t size) {
+  channels_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:lms.Request.Runtime.ChannelSubscribe.channels)
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+Request_Runtime_ChannelSubscribe::channels() const {
+  // @@protoc_insertion_point(field_list:lms.Request.Runtime.ChannelSubscribe.channels)
+  return channels_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+Request_Runtime_ChannelSubscribe::mutable_channels() {
+  // @@protoc_insertion_point(field_mutable_list:lms.Request.Runtime.ChannelSubscribe.channels)
+  return &channels_;
+}
+
+// optional float sample_rate = 2 [default = 10];
+inline bool Request_Runtime_ChannelSubscribe::has_sample_rate() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void Request_Runtime_ChannelSubscribe::set_has_sample_rate() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void Request_Runtime_ChannelSubscribe::clear_has_sample_rate() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void Request_Runtime_ChannelSubscribe::clear_sample_rate() {
+  sample_rate_ = 10;
+  clear_has_sample_rate();
+}
+inline float Request_Runtime_ChannelSubscribe::sample_rate() const {
+  // @@protoc_insertion_point(field_get:lms.Request.Runtime.ChannelSubscribe.sample_rate)
+  return sample_rate_;
+}
+inline void Request_Runtime_ChannelSubscribe::set_sample_rate(float value) {
+  set_has_sample_rate();
+  sample_rate_ = value;
+  // @@protoc_insertion_point(field_set:lms.Request.Runtime.ChannelSubscribe.sample_rate)
+}
+
+// -------------------------------------------------------------------
+
 // Request_Runtime
 
 // optional string name = 1;
@@ -4429,46 +5148,132 @@ inline void Request_Runtime::set_allocated_start_recording(::lms::Request_Runtim
   }
 }
 
-// optional .lms.Request.Runtime.StopRecording stop_recording = 5;
-inline bool Request_Runtime::has_stop_recording() const {
-  return content_case() == kStopRecording;
+// optional .lms.Request.Runtime.StopRecording stop_recording = 5;
+inline bool Request_Runtime::has_stop_recording() const {
+  return content_case() == kStopRecording;
+}
+inline void Request_Runtime::set_has_stop_recording() {
+  _oneof_case_[0] = kStopRecording;
+}
+inline void Request_Runtime::clear_stop_recording() {
+  if (has_stop_recording()) {
+    delete content_.stop_recording_;
+    clear_has_content();
+  }
+}
+inline const ::lms::Request_Runtime_StopRecording& Request_Runtime::stop_recording() const {
+  return has_stop_recording() ? *content_.stop_recording_
+                      : ::lms::Request_Runtime_StopRecording::default_instance();
+}
+inline ::lms::Request_Runtime_StopRecording* Request_Runtime::mutable_stop_recording() {
+  if (!has_stop_recording()) {
+    clear_content();
+    set_has_stop_recording();
+    content_.stop_recording_ = new ::lms::Request_Runtime_StopRecording;
+  }
+  return content_.stop_recording_;
+}
+inline ::lms::Request_Runtime_StopRecording* Request_Runtime::release_stop_recording() {
+  if (has_stop_recording()) {
+    clear_has_content();
+    ::lms::Request_Runtime_StopRecording* temp = content_.stop_recording_;
+    content_.stop_recording_ = NULL;
+    return temp;
+  } else {
+    return NULL;
+  }
+}
+inline void Request_Runtime::set_allocated_stop_recording(::lms::Request_Runtime_StopRecording* stop_recording) {
+  clear_content();
+  if (stop_recording) {
+    set_has_stop_recording();
+    content_.stop_recording_ = stop_recording;
+  }
+}
+
+// optional .lms.Request.Runtime.DumpFlightRecorder dump_flight_recorder = 6;
+inline bool Request_Runtime::has_dump_flight_recorder() const {
+  return content_case() == kDumpFlightRecorder;
+}
+inline void Request_Runtime::set_has_dump_flight_recorder() {
+  _oneof_case_[0] = kDumpFlightRecorder;
+}
+inline void Request_Runtime::clear_dump_flight_recorder() {
+  if (has_dump_flight_recorder()) {
+    delete content_.dump_flight_recorder_;
+    clear_has_content();
+  }
+}
+inline const ::lms::Request_Runtime_DumpFlightRecorder& Request_Runtime::dump_flight_recorder() const {
+  return has_dump_flight_recorder() ? *content_.dump_flight_recorder_
+                      : ::lms::Request_Runtime_DumpFlightRecorder::default_instance();
+}
+inline ::lms::Request_Runtime_DumpFlightRecorder* Request_Runtime::mutable_dump_flight_recorder() {
+  if (!has_dump_flight_recorder()) {
+    clear_content();
+    set_has_dump_flight_recorder();
+    content_.dump_flight_recorder_ = new ::lms::Request_Runtime_DumpFlightRecorder;
+  }
+  return content_.dump_flight_recorder_;
+}
+inline ::lms::Request_Runtime_DumpFlightRecorder* Request_Runtime::release_dump_flight_recorder() {
+  if (has_dump_flight_recorder()) {
+    clear_has_content();
+    ::lms::Request_Runtime_DumpFlightRecorder* temp = content_.dump_flight_recorder_;
+    content_.dump_flight_recorder_ = NULL;
+    return temp;
+  } else {
+    return NULL;
+  }
+}
+inline void Request_Runtime::set_allocated_dump_flight_recorder(::lms::Request_Runtime_DumpFlightRecorder* dump_flight_recorder) {
+  clear_content();
+  if (dump_flight_recorder) {
+    set_has_dump_flight_recorder();
+    content_.dump_flight_recorder_ = dump_flight_recorder;
+  }
+}
+
+// optional .lms.Request.Runtime.ChannelSubscribe channel_subscribe = 7;
+inline bool Request_Runtime::has_channel_subscribe() const {
+  return content_case() == kChannelSubscribe;
 }
-inline void Request_Runtime::set_has_stop_recording() {
-  _oneof_case_[0] = kStopRecording;
+inline void Request_Runtime::set_has_channel_subscribe() {
+  _oneof_case_[0] = kChannelSubscribe;
 }
-inline void Request_Runtime::clear_stop_recording() {
-  if (has_stop_recording()) {
-    delete content_.stop_recording_;
+inline void Request_Runtime::clear_channel_subscribe() {
+  if (has_channel_subscribe()) {
+    delete content_.channel_subscribe_;
     clear_has_content();
   }
 }
-inline const ::lms::Request_Runtime_StopRecording& Request_Runtime::stop_recording() const {
-  return has_stop_recording() ? *content_.stop_recording_
-                      : ::lms::Request_Runtime_StopRecording::default_instance();
+inline const ::lms::Request_Runtime_ChannelSubscribe& Request_Runtime::channel_subscribe() const {
+  return has_channel_subscribe() ? *content_.channel_subscribe_
+                      : ::lms::Request_Runtime_ChannelSubscribe::default_instance();
 }
-inline ::lms::Request_Runtime_StopRecording* Request_Runtime::mutable_stop_recording() {
-  if (!has_stop_recording()) {
+inline ::lms::Request_Runtime_ChannelSubscribe* Request_Runtime::mutable_channel_subscribe() {
+  if (!has_channel_subscribe()) {
     clear_content();
-    set_has_stop_recording();
-    content_.stop_recording_ = new ::lms::Request_Runtime_StopRecording;
+    set_has_channel_subscribe();
+    content_.channel_subscribe_ = new ::lms::Request_Runtime_ChannelSubscribe;
   }
-  return content_.stop_recording_;
+  return content_.channel_subscribe_;
 }
-inline ::lms::Request_Runtime_StopRecording* Request_Runtime::release_stop_recording() {
-  if (has_stop_recording()) {
+inline ::lms::Request_Runtime_ChannelSubscribe* Request_Runtime::release_channel_subscribe() {
+  if (has_channel_subscribe()) {
     clear_has_content();
-    ::lms::Request_Runtime_StopRecording* temp = content_.stop_recording_;
-    content_.stop_recording_ = NULL;
+    ::lms::Request_Runtime_ChannelSubscribe* temp = content_.channel_subscribe_;
+    content_.channel_subscribe_ = NULL;
     return temp;
   } else {
     return NULL;
   }
 }
-inline void Request_Runtime::set_allocated_stop_recording(::lms::Request_Runtime_StopRecording* stop_recording) {
+inline void Request_Runtime::set_allocated_channel_subscribe(::lms::Request_Runtime_ChannelSubscribe* channel_subscribe) {
   clear_content();
-  if (stop_recording) {
-    set_has_stop_recording();
-    content_.stop_recording_ = stop_recording;
+  if (channel_subscribe) {
+    set_has_channel_subscribe();
+    content_.channel_subscribe_ = channel_subscribe;
   }
 }
 
@@ -5998,6 +6803,90 @@ inline void Response_LogEvent::set_timestamp(::google::protobuf::int64 value) {
 
 // -------------------------------------------------------------------
 
+// Response_LogEventBatch
+
+// repeated .lms.Response.LogEvent events = 1;
+inline int Response_LogEventBatch::events_size() const {
+  return events_.size();
+}
+inline void Response_LogEventBatch::clear_events() {
+  events_.Clear();
+}
+inline const ::lms::Response_LogEvent& Response_LogEventBatch::events(int index) const {
+  // @@protoc_insertion_point(field_get:lms.Response.LogEventBatch.events)
+  return events_.Get(index);
+}
+inline ::lms::Response_LogEvent* Response_LogEventBatch::mutable_events(int index) {
+  // @@protoc_insertion_point(field_mutable:lms.Response.LogEventBatch.events)
+  return events_.Mutable(index);
+}
+inline ::lms::Response_LogEvent* Response_LogEventBatch::add_events() {
+  // @@protoc_insertion_point(field_add:lms.Response.LogEventBatch.events)
+  return events_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::lms::Response_LogEvent >&
+Response_LogEventBatch::events() const {
+  // @@protoc_insertion_point(field_list:lms.Response.LogEventBatch.events)
+  return events_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::lms::Response_LogEvent >*
+Response_LogEventBatch::mutable_events() {
+  // @@protoc_insertion_point(field_mutable_list:lms.Response.LogEventBatch.events)
+  return &events_;
+}
+
+// optional .lms.Response.LogEvent.Level min_level = 2;
+inline bool Response_LogEventBatch::has_min_level() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void Response_LogEventBatch::set_has_min_level() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void Response_LogEventBatch::clear_has_min_level() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void Response_LogEventBatch::clear_min_level() {
+  min_level_ = 0;
+  clear_has_min_level();
+}
+inline ::lms::Response_LogEvent_Level Response_LogEventBatch::min_level() const {
+  // @@protoc_insertion_point(field_get:lms.Response.LogEventBatch.min_level)
+  return static_cast< ::lms::Response_LogEvent_Level >(min_level_);
+}
+inline void Response_LogEventBatch::set_min_level(::lms::Response_LogEvent_Level value) {
+  assert(::lms::Response_LogEvent_Level_IsValid(value));
+  set_has_min_level();
+  min_level_ = value;
+  // @@protoc_insertion_point(field_set:lms.Response.LogEventBatch.min_level)
+}
+
+// optional .lms.Response.LogEvent.Level max_level = 3;
+inline bool Response_LogEventBatch::has_max_level() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void Response_LogEventBatch::set_has_max_level() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void Response_LogEventBatch::clear_has_max_level() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void Response_LogEventBatch::clear_max_level() {
+  max_level_ = 0;
+  clear_has_max_level();
+}
+inline ::lms::Response_LogEvent_Level Response_LogEventBatch::max_level() const {
+  // @@protoc_insertion_point(field_get:lms.Response.LogEventBatch.max_level)
+  return static_cast< ::lms::Response_LogEvent_Level >(max_level_);
+}
+inline void Response_LogEventBatch::set_max_level(::lms::Response_LogEvent_Level value) {
+  assert(::lms::Response_LogEvent_Level_IsValid(value));
+  set_has_max_level();
+  max_level_ = value;
+  // @@protoc_insertion_point(field_set:lms.Response.LogEventBatch.max_level)
+}
+
+// -------------------------------------------------------------------
+
 // Response_ProfilingSummary_Trace
 
 // optional string name = 1;
@@ -6256,6 +7145,320 @@ Response_ProfilingSummary::mutable_traces() {
 
 // -------------------------------------------------------------------
 
+// Response_ChannelSnapshot_Channel
+
+// optional string name = 1;
+inline bool Response_ChannelSnapshot_Channel::has_name() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void Response_ChannelSnapshot_Channel::set_has_name() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void Response_ChannelSnapshot_Channel::clear_has_name() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void Response_ChannelSnapshot_Channel::clear_name() {
+  if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    name_->clear();
+  }
+  clear_has_name();
+}
+inline const ::std::string& Response_ChannelSnapshot_Channel::name() const {
+  // @@protoc_insertion_point(field_get:lms.Response.ChannelSnapshot.Channel.name)
+  return *name_;
+}
+inline void Response_ChannelSnapshot_Channel::set_name(const ::std::string& value) {
+  set_has_name();
+  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    name_ = new ::std::string;
+  }
+  name_->assign(value);
+  // @@protoc_insertion_point(field_set:lms.Response.ChannelSnapshot.Channel.name)
+}
+inline void Response_ChannelSnapshot_Channel::set_name(const char* value) {
+  set_has_name();
+  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    name_ = new ::std::string;
+  }
+  name_->assign(value);
+  // @@protoc_insertion_point(field_set_char:lms.Response.ChannelSnapshot.Channel.name)
+}
+inline void Response_ChannelSnapshot_Channel::set_name(const char* value, size_t size) {
+  set_has_name();
+  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    name_ = new ::std::string;
+  }
+  name_->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:lms.Response.ChannelSnapshot.Channel.name)
+}
+inline ::std::string* Response_ChannelSnapshot_Channel::mutable_name() {
+  set_has_name();
+  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    name_ = new ::std::string;
+  }
+  // @@protoc_insertion_point(field_mutable:lms.Response.ChannelSnapshot.Channel.name)
+  return name_;
+}
+inline ::std::string* Response_ChannelSnapshot_Channel::release_name() {
+  clear_has_name();
+  if (name_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    return NULL;
+  } else {
+    ::std::string* temp = name_;
+    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    return temp;
+  }
+}
+inline void Response_ChannelSnapshot_Channel::set_allocated_name(::std::string* name) {
+  if (name_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete name_;
+  }
+  if (name) {
+    set_has_name();
+    name_ = name;
+  } else {
+    clear_has_name();
+    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  }
+  // @@protoc_insertion_point(field_set_allocated:lms.Response.ChannelSnapshot.Channel.name)
+}
+
+// optional string type = 2;
+inline bool Response_ChannelSnapshot_Channel::has_type() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void Response_ChannelSnapshot_Channel::set_has_type() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void Response_ChannelSnapshot_Channel::clear_has_type() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void Response_ChannelSnapshot_Channel::clear_type() {
+  if (type_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    type_->clear();
+  }
+  clear_has_type();
+}
+inline const ::std::string& Response_ChannelSnapshot_Channel::type() const {
+  // @@protoc_insertion_point(field_get:lms.Response.ChannelSnapshot.Channel.type)
+  return *type_;
+}
+inline void Response_ChannelSnapshot_Channel::set_type(const ::std::string& value) {
+  set_has_type();
+  if (type_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    type_ = new ::std::string;
+  }
+  type_->assign(value);
+  // @@protoc_insertion_point(field_set:lms.Response.ChannelSnapshot.Channel.type)
+}
+inline void Response_ChannelSnapshot_Channel::set_type(const char* value) {
+  set_has_type();
+  if (type_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    type_ = new ::std::string;
+  }
+  type_->assign(value);
+  // @@protoc_insertion_point(field_set_char:lms.Response.ChannelSnapshot.Channel.type)
+}
+inline void Response_ChannelSnapshot_Channel::set_type(const char* value, size_t size) {
+  set_has_type();
+  if (type_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    type_ = new ::std::string;
+  }
+  type_->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:lms.Response.ChannelSnapshot.Channel.type)
+}
+inline ::std::string* Response_ChannelSnapshot_Channel::mutable_type() {
+  set_has_type();
+  if (type_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    type_ = new ::std::string;
+  }
+  // @@protoc_insertion_point(field_mutable:lms.Response.ChannelSnapshot.Channel.type)
+  return type_;
+}
+inline ::std::string* Response_ChannelSnapshot_Channel::release_type() {
+  clear_has_type();
+  if (type_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    return NULL;
+  } else {
+    ::std::string* temp = type_;
+    type_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    return temp;
+  }
+}
+inline void Response_ChannelSnapshot_Channel::set_allocated_type(::std::string* type) {
+  if (type_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete type_;
+  }
+  if (type) {
+    set_has_type();
+    type_ = type;
+  } else {
+    clear_has_type();
+    type_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  }
+  // @@protoc_insertion_point(field_set_allocated:lms.Response.ChannelSnapshot.Channel.type)
+}
+
+// optional bytes data = 3;
+inline bool Response_ChannelSnapshot_Channel::has_data() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void Response_ChannelSnapshot_Channel::set_has_data() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void Response_ChannelSnapshot_Channel::clear_has_data() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void Response_ChannelSnapshot_Channel::clear_data() {
+  if (data_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    data_->clear();
+  }
+  clear_has_data();
+}
+inline const ::std::string& Response_ChannelSnapshot_Channel::data() const {
+  // @@protoc_insertion_point(field_get:lms.Response.ChannelSnapshot.Channel.data)
+  return *data_;
+}
+inline void Response_ChannelSnapshot_Channel::set_data(const ::std::string& value) {
+  set_has_data();
+  if (data_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    data_ = new ::std::string;
+  }
+  data_->assign(value);
+  // @@protoc_insertion_point(field_set:lms.Response.ChannelSnapshot.Channel.data)
+}
+inline void Response_ChannelSnapshot_Channel::set_data(const char* value) {
+  set_has_data();
+  if (data_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    data_ = new ::std::string;
+  }
+  data_->assign(value);
+  // @@protoc_insertion_point(field_set_char:lms.Response.ChannelSnapshot.Channel.data)
+}
+inline void Response_ChannelSnapshot_Channel::set_data(const void* value, size_t size) {
+  set_has_data();
+  if (data_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    data_ = new ::std::string;
+  }
+  data_->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:lms.Response.ChannelSnapshot.Channel.data)
+}
+inline ::std::string* Response_ChannelSnapshot_Channel::mutable_data() {
+  set_has_data();
+  if (data_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    data_ = new ::std::string;
+  }
+  // @@protoc_insertion_point(field_mutable:lms.Response.ChannelSnapshot.Channel.data)
+  return data_;
+}
+inline ::std::string* Response_ChannelSnapshot_Channel::release_data() {
+  clear_has_data();
+  if (data_ == &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    return NULL;
+  } else {
+    ::std::string* temp = data_;
+    data_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+    return temp;
+  }
+}
+inline void Response_ChannelSnapshot_Channel::set_allocated_data(::std::string* data) {
+  if (data_ != &::google::protobuf::internal::GetEmptyStringAlreadyInited()) {
+    delete data_;
+  }
+  if (data) {
+    set_has_data();
+    data_ = data;
+  } else {
+    clear_has_data();
+    data_ = const_cast< ::std::string*>(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  }
+  // @@protoc_insertion_point(field_set_allocated:lms.Response.ChannelSnapshot.Channel.data)
+}
+
+// -------------------------------------------------------------------
+
+// Response_ChannelSnapshot
+
+// optional int32 cycle = 1;
+inline bool Response_ChannelSnapshot::has_cycle() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void Response_ChannelSnapshot::set_has_cycle() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void Response_ChannelSnapshot::clear_has_cycle() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void Response_ChannelSnapshot::clear_cycle() {
+  cycle_ = 0;
+  clear_has_cycle();
+}
+inline ::google::protobuf::int32 Response_ChannelSnapshot::cycle() const {
+  // @@protoc_insertion_point(field_get:lms.Response.ChannelSnapshot.cycle)
+  return cycle_;
+}
+inline void Response_ChannelSnapshot::set_cycle(::google::protobuf::int32 value) {
+  set_has_cycle();
+  cycle_ = value;
+  // @@protoc_insertion_point(field_set:lms.Response.ChannelSnapshot.cycle)
+}
+
+// optional int64 timestamp = 2;
+inline bool Response_ChannelSnapshot::has_timestamp() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void Response_ChannelSnapshot::set_has_timestamp() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void Response_ChannelSnapshot::clear_has_timestamp() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void Response_ChannelSnapshot::clear_timestamp() {
+  timestamp_ = GOOGLE_LONGLONG(0);
+  clear_has_timestamp();
+}
+inline ::google::protobuf::int64 Response_ChannelSnapshot::timestamp() const {
+  // @@protoc_insertion_point(field_get:lms.Response.ChannelSnapshot.timestamp)
+  return timestamp_;
+}
+inline void Response_ChannelSnapshot::set_timestamp(::google::protobuf::int64 value) {
+  set_has_timestamp();
+  timestamp_ = value;
+  // @@protoc_insertion_point(field_set:lms.Response.ChannelSnapshot.timestamp)
+}
+
+// repeated .lms.Response.ChannelSnapshot.Channel channels = 3;
+inline int Response_ChannelSnapshot::channels_size() const {
+  return channels_.size();
+}
+inline void Response_ChannelSnapshot::clear_channels() {
+  channels_.Clear();
+}
+inline const ::lms::Response_ChannelSnapshot_Channel& Response_ChannelSnapshot::channels(int index) const {
+  // @@protoc_insertion_point(field_get:lms.Response.ChannelSnapshot.channels)
+  return channels_.Get(index);
+}
+inline ::lms::Response_ChannelSnapshot_Channel* Response_ChannelSnapshot::mutable_channels(int index) {
+  // @@protoc_insertion_point(field_mutable:lms.Response.ChannelSnapshot.channels)
+  return channels_.Mutable(index);
+}
+inline ::lms::Response_ChannelSnapshot_Channel* Response_ChannelSnapshot::add_channels() {
+  // @@protoc_insertion_point(field_add:lms.Response.ChannelSnapshot.channels)
+  return channels_.Add();
+}
+inline const ::google::protobuf::RepeatedPtrField< ::lms::Response_ChannelSnapshot_Channel >&
+Response_ChannelSnapshot::channels() const {
+  // @@protoc_insertion_point(field_list:lms.Response.ChannelSnapshot.channels)
+  return channels_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::lms::Response_ChannelSnapshot_Channel >*
+Response_ChannelSnapshot::mutable_channels() {
+  // @@protoc_insertion_point(field_mutable_list:lms.Response.ChannelSnapshot.channels)
+  return &channels_;
+}
+
+// -------------------------------------------------------------------
+
 // Response
 
 // optional .lms.Response.Info info = 1;
@@ -6516,6 +7719,92 @@ inline void Response::set_allocated_profiling_summary(::lms::Response_ProfilingS
   }
 }
 
+// optional .lms.Response.LogEventBatch log_event_batch = 7;
+inline bool Response::has_log_event_batch() const {
+  return content_case() == kLogEventBatch;
+}
+inline void Response::set_has_log_event_batch() {
+  _oneof_case_[0] = kLogEventBatch;
+}
+inline void Response::clear_log_event_batch() {
+  if (has_log_event_batch()) {
+    delete content_.log_event_batch_;
+    clear_has_content();
+  }
+}
+inline const ::lms::Response_LogEventBatch& Response::log_event_batch() const {
+  return has_log_event_batch() ? *content_.log_event_batch_
+                      : ::lms::Response_LogEventBatch::default_instance();
+}
+inline ::lms::Response_LogEventBatch* Response::mutable_log_event_batch() {
+  if (!has_log_event_batch()) {
+    clear_content();
+    set_has_log_event_batch();
+    content_.log_event_batch_ = new ::lms::Response_LogEventBatch;
+  }
+  return content_.log_event_batch_;
+}
+inline ::lms::Response_LogEventBatch* Response::release_log_event_batch() {
+  if (has_log_event_batch()) {
+    clear_has_content();
+    ::lms::Response_LogEventBatch* temp = content_.log_event_batch_;
+    content_.log_event_batch_ = NULL;
+    return temp;
+  } else {
+    return NULL;
+  }
+}
+inline void Response::set_allocated_log_event_batch(::lms::Response_LogEventBatch* log_event_batch) {
+  clear_content();
+  if (log_event_batch) {
+    set_has_log_event_batch();
+    content_.log_event_batch_ = log_event_batch;
+  }
+}
+
+// optional .lms.Response.ChannelSnapshot channel_snapshot = 8;
+inline bool Response::has_channel_snapshot() const {
+  return content_case() == kChannelSnapshot;
+}
+inline void Response::set_has_channel_snapshot() {
+  _oneof_case_[0] = kChannelSnapshot;
+}
+inline void Response::clear_channel_snapshot() {
+  if (has_channel_snapshot()) {
+    delete content_.channel_snapshot_;
+    clear_has_content();
+  }
+}
+inline const ::lms::Response_ChannelSnapshot& Response::channel_snapshot() const {
+  return has_channel_snapshot() ? *content_.channel_snapshot_
+                      : ::lms::Response_ChannelSnapshot::default_instance();
+}
+inline ::lms::Response_ChannelSnapshot* Response::mutable_channel_snapshot() {
+  if (!has_channel_snapshot()) {
+    clear_content();
+    set_has_channel_snapshot();
+    content_.channel_snapshot_ = new ::lms::Response_ChannelSnapshot;
+  }
+  return content_.channel_snapshot_;
+}
+inline ::lms::Response_ChannelSnapshot* Response::release_channel_snapshot() {
+  if (has_channel_snapshot()) {
+    clear_has_content();
+    ::lms::Response_ChannelSnapshot* temp = content_.channel_snapshot_;
+    content_.channel_snapshot_ = NULL;
+    return temp;
+  } else {
+    return NULL;
+  }
+}
+inline void Response::set_allocated_channel_snapshot(::lms::Response_ChannelSnapshot* channel_snapshot) {
+  clear_content();
+  if (channel_snapshot) {
+    set_has_channel_snapshot();
+    content_.channel_snapshot_ = channel_snapshot;
+  }
+}
+
 inline bool Response::has_content() {
   return content_case() != CONTENT_NOT_SET;
 }
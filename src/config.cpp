@@ -129,6 +129,12 @@ bool Config::empty() const { return dfunc()->properties.empty(); }
 
 void Config::clear() { dfunc()->properties.clear(); }
 
+bool Config::operator==(const Config &other) const {
+    return dfunc()->properties == other.dfunc()->properties;
+}
+
+bool Config::operator!=(const Config &other) const { return !(*this == other); }
+
 // Template specializations get<T>
 template <>
 std::string Config::get<std::string>(const std::string &key,
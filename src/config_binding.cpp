@@ -0,0 +1,14 @@
+#include <lms/config_binding.h>
+
+namespace lms {
+
+void ConfigBinding::update(const Config &config) {
+    m_config = config;
+    for (auto &values : m_values) {
+        for (auto &value : values.second) {
+            value.second->parse(m_config);
+        }
+    }
+}
+
+}  // namespace lms
@@ -2,12 +2,38 @@
 
 namespace lms {
 
-DataManager::DataManager() : logger("lms.DataManager") {}
+DataManager::DataManager() : logger("lms.DataManager"), m_observer(nullptr) {}
 
 const DataManager::ChannelMap &DataManager::getChannels() const {
     return channels;
 }
 
-void DataManager::reset() { channels.clear(); }
+void DataManager::shareChannel(const std::string &name, bool writer,
+                               std::uint32_t slots) {
+    if (channels.find(name) != channels.end()) {
+        if (sharedChannels.count(name) == 1) {
+            logger.warn("shareChannel")
+                << "Channel " << name
+                << " is already in shared memory, restart to apply the change";
+        } else {
+            logger.warn("shareChannel") << "Channel " << name
+                                        << " is already in use and stays local";
+        }
+        return;
+    }
+    sharedChannels[name] = SharedChannelInfo{writer, slots};
+}
+
+void DataManager::observeAccesses(AccessObserver *observer) {
+    m_observer = observer;
+    for (auto &channel : channels) {
+        channel.second->observer.store(observer);
+    }
+}
+
+void DataManager::reset() {
+    channels.clear();
+    sharedChannels.clear();
+}
 
 } // namespace lms
@@ -100,5 +100,23 @@ void printStacktrace(std::ostream &os) {
 #endif
 }
 
+void writeStacktrace(int fd) {
+#ifdef _WIN32
+    (void)fd;
+#else
+    const int BUFFER_SIZE = 256;
+    void *buffer[BUFFER_SIZE];
+    int size = backtrace(buffer, BUFFER_SIZE);
+    backtrace_symbols_fd(buffer, size, fd);
+#endif
+}
+
+void loadStacktrace() {
+#ifndef _WIN32
+    void *buffer[1];
+    backtrace(buffer, 1);
+#endif
+}
+
 } // namespace internal
 } // namespace lms
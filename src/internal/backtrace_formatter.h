@@ -11,6 +11,20 @@ namespace internal {
  */
 void printStacktrace(std::ostream &os);
 
+/**
+ * @brief Write the current stack trace to a file descriptor, one frame per
+ * line and without demangling.
+ *
+ * Only uses async-signal-safe calls, so it can be called from signal handlers
+ * once loadStacktrace() was called.
+ */
+void writeStacktrace(int fd);
+
+/**
+ * @brief Load the unwinder, the first stack trace of a process allocates.
+ */
+void loadStacktrace();
+
 } // namespace internal
 } // namespace lms
 
@@ -0,0 +1,89 @@
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include "channel_inspector.h"
+
+namespace lms {
+namespace internal {
+
+constexpr size_t ChannelInspector::SNAPSHOTS;
+
+ChannelInspector::ChannelInspector()
+    : m_free(SNAPSHOTS), m_ready(SNAPSHOTS),
+      m_eventFd(eventfd(0, EFD_NONBLOCK)), m_stream(&m_buffer) {
+    for (size_t i = 0; i < SNAPSHOTS; i++) {
+        m_free.push(std::unique_ptr<Snapshot>(new Snapshot));
+    }
+}
+
+ChannelInspector::~ChannelInspector() {
+    if (m_eventFd != -1) {
+        ::close(m_eventFd);
+    }
+}
+
+void ChannelInspector::subscribe(const std::vector<std::string> &channels,
+                                 lms::Time interval) {
+    m_channels = channels;
+    m_interval = interval;
+    m_nextSample = lms::Time::ZERO;
+}
+
+bool ChannelInspector::enabled() const { return !m_channels.empty(); }
+
+void ChannelInspector::sample(
+    DataManager &dm, int cycle,
+    const std::function<bool(const std::string &)> &excluded) {
+    const lms::Time now = lms::Time::now();
+    if (now < m_nextSample) {
+        return;
+    }
+    std::unique_ptr<Snapshot> snapshot;
+    if (!m_free.pop(snapshot)) {
+        // all snapshots are still being sent, skip this sample
+        return;
+    }
+    m_nextSample = now + m_interval;
+
+    snapshot->cycle = cycle;
+    snapshot->timestamp = now;
+    snapshot->channels.resize(m_channels.size());
+    for (size_t i = 0; i < m_channels.size(); i++) {
+        Snapshot::Channel &channel = snapshot->channels[i];
+        channel.name = m_channels[i];
+        channel.data.clear();
+        if (excluded && excluded(m_channels[i])) {
+            channel.type.clear();
+            channel.serializable = false;
+            continue;
+        }
+        m_buffer.target(&channel.data);
+        auto reader = dm.readChannel<lms::Any>(m_channels[i]);
+        channel.type = reader.typeName();
+        channel.serializable = reader.serialize(m_stream);
+    }
+    m_buffer.target(nullptr);
+
+    // can't fail, there are never more than SNAPSHOTS snapshots
+    m_ready.push(std::move(snapshot));
+    eventfd_write(m_eventFd, 1);
+}
+
+int ChannelInspector::eventFd() const { return m_eventFd; }
+
+bool ChannelInspector::takeSnapshot(std::unique_ptr<Snapshot> &snapshot) {
+    if (m_ready.pop(snapshot)) {
+        return true;
+    }
+    // a snapshot pushed after this read triggers a new wakeup
+    eventfd_t value;
+    eventfd_read(m_eventFd, &value);
+    return m_ready.pop(snapshot);
+}
+
+void ChannelInspector::release(std::unique_ptr<Snapshot> snapshot) {
+    m_free.push(std::move(snapshot));
+}
+
+}  // namespace internal
+}  // namespace lms
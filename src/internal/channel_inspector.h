@@ -0,0 +1,112 @@
+#ifndef LMS_INTERNAL_CHANNEL_INSPECTOR_H
+#define LMS_INTERNAL_CHANNEL_INSPECTOR_H
+
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "lms/datamanager.h"
+#include "lms/time.h"
+#include "spsc_queue.h"
+#include "string_buffer.h"
+
+namespace lms {
+namespace internal {
+
+/**
+ * @brief Samples the serialized contents of subscribed channels for live
+ * inspection by clients.
+ *
+ * The cycle thread serializes the channels at the end of a cycle into one of
+ * a few preallocated snapshots and hands it to the communication thread, which
+ * sends it and returns the snapshot afterwards. The snapshot buffers keep
+ * their capacity, so sampling does not allocate in steady state. If the
+ * communication thread is still busy with all snapshots, the sample is
+ * skipped instead of waiting.
+ *
+ * subscribe() and sample() must be called from the cycle thread,
+ * eventFd(), takeSnapshot() and release() from the communication thread.
+ */
+class ChannelInspector {
+public:
+    struct Snapshot {
+        struct Channel {
+            std::string name;
+            std::string type;
+            // empty and serializable == false if the channel can't be serialized
+            std::string data;
+            bool serializable = false;
+        };
+
+        int cycle = 0;
+        lms::Time timestamp;
+        std::vector<Channel> channels;
+    };
+
+    ChannelInspector();
+    ~ChannelInspector();
+
+    ChannelInspector(const ChannelInspector &) = delete;
+    ChannelInspector &operator=(const ChannelInspector &) = delete;
+
+    /**
+     * @brief Replace the subscribed channels.
+     * @param channels channels to sample, empty to stop sampling
+     * @param interval minimum time between two samples, zero samples every
+     * cycle
+     */
+    void subscribe(const std::vector<std::string> &channels, lms::Time interval);
+
+    bool enabled() const;
+
+    /**
+     * @brief Serialize the subscribed channels if the sample interval has
+     * passed and a snapshot is free.
+     * @param excluded returns true for channels that must not be read now,
+     * they are sent as not serializable
+     */
+    void sample(DataManager &dm, int cycle,
+                const std::function<bool(const std::string &)> &excluded = nullptr);
+
+    /**
+     * @brief File descriptor that becomes readable when a snapshot is ready.
+     */
+    int eventFd() const;
+
+    /**
+     * @brief Take the next ready snapshot. Resets eventFd() if no snapshot is
+     * left.
+     * @return false if no snapshot is ready
+     */
+    bool takeSnapshot(std::unique_ptr<Snapshot> &snapshot);
+
+    /**
+     * @brief Give a snapshot back after it was sent.
+     */
+    void release(std::unique_ptr<Snapshot> snapshot);
+
+    /**
+     * @brief Number of snapshots that can be in flight at the same time.
+     */
+    static constexpr size_t SNAPSHOTS = 3;
+private:
+    std::vector<std::string> m_channels;
+    lms::Time m_interval;
+    lms::Time m_nextSample;
+
+    // producer: communication thread, consumer: cycle thread
+    SpscQueue<std::unique_ptr<Snapshot>> m_free;
+    // producer: cycle thread, consumer: communication thread
+    SpscQueue<std::unique_ptr<Snapshot>> m_ready;
+    int m_eventFd;
+
+    StringOutputBuffer m_buffer;
+    std::ostream m_stream;
+};
+
+}  // namespace internal
+}  // namespace lms
+
+#endif  // LMS_INTERNAL_CHANNEL_INSPECTOR_H
@@ -1,8 +1,13 @@
 #ifndef LMS_INTERNAL_DAG_H
 #define LMS_INTERNAL_DAG_H
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <map>
+#include <queue>
 #include <set>
+#include <vector>
 
 namespace lms {
 namespace internal {
@@ -19,6 +24,94 @@ private:
     typedef std::map<T, std::set<T>> GraphType;
     GraphType m_data;
 
+    /**
+     * @brief Index based copy of the graph for the linear time algorithms.
+     *
+     * Nodes are numbered in the (sorted) order of m_data.
+     */
+    struct Indexed {
+        std::vector<T> nodes;
+        std::vector<std::vector<size_t>> successors;
+        // number of incoming edges, including edges from removed nodes
+        std::vector<size_t> indegree;
+        // true if an incoming edge comes from a removed node
+        bool dangling = false;
+    };
+
+    Indexed indexed() const {
+        Indexed result;
+        result.nodes.reserve(m_data.size());
+        for (auto const &pair : m_data) {
+            result.nodes.push_back(pair.first);
+        }
+        result.successors.resize(m_data.size());
+        result.indegree.resize(m_data.size());
+
+        size_t to = 0;
+        for (auto const &pair : m_data) {
+            result.indegree[to] = pair.second.size();
+            for (T const &from : pair.second) {
+                auto it = std::lower_bound(result.nodes.begin(),
+                                           result.nodes.end(), from);
+                if (it != result.nodes.end() && !(from < *it)) {
+                    result.successors[it - result.nodes.begin()].push_back(to);
+                } else {
+                    result.dangling = true;
+                }
+            }
+            to++;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Kahn's algorithm, free nodes are taken in the order of m_data.
+     * @return node indices in topological order, shorter than the number of
+     * nodes if the graph has a cycle
+     */
+    static std::vector<size_t> kahn(const Indexed &graph) {
+        std::vector<size_t> indegree(graph.indegree);
+        std::priority_queue<size_t, std::vector<size_t>, std::greater<size_t>>
+            free;
+        for (size_t i = 0; i < indegree.size(); i++) {
+            if (indegree[i] == 0) {
+                free.push(i);
+            }
+        }
+
+        std::vector<size_t> order;
+        order.reserve(indegree.size());
+        while (!free.empty()) {
+            size_t node = free.top();
+            free.pop();
+            order.push_back(node);
+            for (size_t to : graph.successors[node]) {
+                if (--indegree[to] == 0) {
+                    free.push(to);
+                }
+            }
+        }
+        return order;
+    }
+
+    static bool augment(size_t from,
+                        const std::vector<std::vector<size_t>> &successors,
+                        std::vector<size_t> &matchedFrom,
+                        std::vector<bool> &visited) {
+        for (size_t to : successors[from]) {
+            if (visited[to]) {
+                continue;
+            }
+            visited[to] = true;
+            if (matchedFrom[to] == matchedFrom.size() ||
+                augment(matchedFrom[to], successors, matchedFrom, visited)) {
+                matchedFrom[to] = from;
+                return true;
+            }
+        }
+        return false;
+    }
+
 public:
     /**
      * @brief Add an edge from dependency to node.
@@ -164,15 +257,58 @@ public:
      * @return true if the graph may get deadlocked, false otherwise
      */
     bool hasCycle() const {
-        DAG copy(*this);
+        std::vector<T> cycle;
+        // nodes depending on removed nodes never get free
+        return indexed().dangling || findCycle(cycle);
+    }
 
-        T node;
-        while (copy.getFree(node)) {
-            copy.removeNode(node);
-            copy.removeEdgesFrom(node);
+    /**
+     * @brief Search for a cycle.
+     * @param cycle nodes of the cycle in edge direction will be assigned, the
+     * last node has an edge to the first one
+     * @return true if a cycle was found
+     */
+    bool findCycle(std::vector<T> &cycle) const {
+        const Indexed graph = indexed();
+
+        // iterative depth first search, a back edge closes a cycle
+        enum Color : char { WHITE, GRAY, BLACK };
+        std::vector<char> color(graph.nodes.size(), WHITE);
+        std::vector<std::pair<size_t, size_t>> stack;
+        for (size_t root = 0; root < graph.nodes.size(); root++) {
+            if (color[root] != WHITE) {
+                continue;
+            }
+            color[root] = GRAY;
+            stack.emplace_back(root, 0);
+            while (!stack.empty()) {
+                const size_t node = stack.back().first;
+                const size_t next = stack.back().second++;
+                if (next == graph.successors[node].size()) {
+                    color[node] = BLACK;
+                    stack.pop_back();
+                    continue;
+                }
+                const size_t to = graph.successors[node][next];
+                if (color[to] == GRAY) {
+                    // the gray nodes on the stack from 'to' on form the cycle
+                    cycle.clear();
+                    bool inCycle = false;
+                    for (const auto &entry : stack) {
+                        inCycle = inCycle || entry.first == to;
+                        if (inCycle) {
+                            cycle.push_back(graph.nodes[entry.first]);
+                        }
+                    }
+                    return true;
+                }
+                if (color[to] == WHITE) {
+                    color[to] = GRAY;
+                    stack.emplace_back(to, 0);
+                }
+            }
         }
-
-        return !copy.empty();
+        return false;
     }
 
     /**
@@ -192,17 +328,165 @@ public:
      * @return true if sorting was successful, false if the graph contains
      * cycles
      */
-    template <typename ListType> bool topoSort(ListType &result) {
-        DAG copy(*this);
-
-        T node;
-        while (copy.getFree(node)) {
-            copy.removeNode(node);
-            copy.removeEdgesFrom(node);
-            result.push_back(node);
+    template <typename ListType> bool topoSort(ListType &result) const {
+        const Indexed graph = indexed();
+        const std::vector<size_t> order = kahn(graph);
+        for (size_t node : order) {
+            result.push_back(graph.nodes[node]);
+        }
+        return order.size() == graph.nodes.size();
+    }
+
+    /**
+     * @brief Return the maximum number of nodes satisfying the predicate that
+     * have no path between each other, i.e. the maximum number of such nodes
+     * that may be executed at the same time.
+     *
+     * By Dilworth's theorem this is the number of nodes minus a maximum
+     * matching between each node and its transitive successors.
+     *
+     * @param predicate a function of type bool (*)(T const&)
+     * @return width of the graph, 0 if the graph contains cycles
+     */
+    template <typename PredicateFn> size_t width(PredicateFn predicate) const {
+        std::vector<T> order;
+        if (!topoSort(order)) {
+            return 0;
+        }
+
+        // transitive predecessors of every node in topological order
+        std::map<T, std::set<T>> ancestors;
+        for (T const &node : order) {
+            std::set<T> &result = ancestors[node];
+            for (T const &dep : m_data.find(node)->second) {
+                result.insert(dep);
+                result.insert(ancestors[dep].begin(), ancestors[dep].end());
+            }
+        }
+
+        std::vector<T> nodes;
+        std::map<T, size_t> index;
+        for (T const &node : order) {
+            if (predicate(node)) {
+                index[node] = nodes.size();
+                nodes.push_back(node);
+            }
+        }
+
+        // successors[i]: indices of filtered nodes reachable from node i
+        std::vector<std::vector<size_t>> successors(nodes.size());
+        for (size_t to = 0; to < nodes.size(); to++) {
+            for (T const &from : ancestors[nodes[to]]) {
+                auto it = index.find(from);
+                if (it != index.end()) {
+                    successors[it->second].push_back(to);
+                }
+            }
+        }
+
+        // Kuhn's augmenting path algorithm
+        std::vector<size_t> matchedFrom(nodes.size(), nodes.size());
+        size_t matching = 0;
+        for (size_t from = 0; from < nodes.size(); from++) {
+            std::vector<bool> visited(nodes.size(), false);
+            if (augment(from, successors, matchedFrom, visited)) {
+                matching++;
+            }
+        }
+        return nodes.size() - matching;
+    }
+
+    /**
+     * @brief Find a longest path, i.e. the longest chain of nodes that can
+     * only be executed one after another.
+     *
+     * @param path nodes of the path are appended from first to last
+     * @return false if the graph contains cycles
+     */
+    bool criticalPath(std::vector<T> &path) const {
+        const Indexed graph = indexed();
+        const std::vector<size_t> order = kahn(graph);
+        if (order.size() != graph.nodes.size()) {
+            return false;
+        }
+
+        // longest path ending in each node, in topological order
+        const size_t none = graph.nodes.size();
+        std::vector<size_t> length(graph.nodes.size(), 1);
+        std::vector<size_t> previous(graph.nodes.size(), none);
+        size_t last = none;
+        for (size_t from : order) {
+            if (last == none || length[from] > length[last]) {
+                last = from;
+            }
+            for (size_t to : graph.successors[from]) {
+                if (length[from] + 1 > length[to]) {
+                    length[to] = length[from] + 1;
+                    previous[to] = from;
+                }
+            }
+        }
+
+        std::vector<T> reversed;
+        for (size_t node = last; node != none; node = previous[node]) {
+            reversed.push_back(graph.nodes[node]);
+        }
+        path.insert(path.end(), reversed.rbegin(), reversed.rend());
+        return true;
+    }
+
+    /**
+     * @brief Split the graph into weakly connected components, i.e. groups of
+     * nodes without any edge between two groups.
+     *
+     * @return components in the order of their smallest node, nodes of a
+     * component in the order of the graph
+     */
+    std::vector<std::vector<T>> components() const {
+        const Indexed graph = indexed();
+
+        // union find over the node indices
+        std::vector<size_t> parent(graph.nodes.size());
+        for (size_t i = 0; i < parent.size(); i++) {
+            parent[i] = i;
+        }
+        auto find = [&parent](size_t node) {
+            while (parent[node] != node) {
+                parent[node] = parent[parent[node]];
+                node = parent[node];
+            }
+            return node;
+        };
+        for (size_t from = 0; from < graph.nodes.size(); from++) {
+            for (size_t to : graph.successors[from]) {
+                size_t a = find(from), b = find(to);
+                // the smaller index stays the root
+                if (a < b) {
+                    parent[b] = a;
+                } else if (b < a) {
+                    parent[a] = b;
+                }
+            }
+        }
+
+        std::vector<std::vector<T>> result;
+        std::vector<size_t> component(graph.nodes.size());
+        for (size_t node = 0; node < graph.nodes.size(); node++) {
+            const size_t root = find(node);
+            if (root == node) {
+                component[node] = result.size();
+                result.push_back(std::vector<T>());
+            }
+            result[component[root]].push_back(graph.nodes[node]);
         }
+        return result;
+    }
 
-        return copy.empty();
+    /**
+     * @brief Width of the whole graph, see width(PredicateFn).
+     */
+    size_t width() const {
+        return width([](T const &) { return true; });
     }
 
     /**
@@ -256,6 +540,64 @@ public:
      * via a path not using this edge.
      */
     void removeTransitiveEdges() {
+        const Indexed graph = indexed();
+        const std::vector<size_t> order = kahn(graph);
+        if (order.size() != graph.nodes.size()) {
+            removeTransitiveEdgesSlow();
+            return;
+        }
+
+        std::vector<size_t> position(order.size());
+        for (size_t i = 0; i < order.size(); i++) {
+            position[order[i]] = i;
+        }
+
+        // reach[i]: bitset of nodes reachable from node i, built in reverse
+        // topological order. Successors are visited closest first, so a
+        // successor that is already reachable is connected transitively.
+        const size_t words = (order.size() + 63) / 64;
+        std::vector<std::vector<uint64_t>> reach(
+            order.size(), std::vector<uint64_t>(words, 0));
+        for (auto it = order.rbegin(); it != order.rend(); ++it) {
+            const size_t from = *it;
+            std::vector<size_t> successors(graph.successors[from]);
+            std::sort(successors.begin(), successors.end(),
+                      [&position](size_t a, size_t b) {
+                          return position[a] < position[b];
+                      });
+
+            std::vector<uint64_t> &bits = reach[from];
+            for (size_t to : successors) {
+                if (bits[to / 64] & (uint64_t(1) << (to % 64))) {
+                    removeEdge(graph.nodes[from], graph.nodes[to]);
+                } else {
+                    bits[to / 64] |= uint64_t(1) << (to % 64);
+                    for (size_t w = 0; w < words; w++) {
+                        bits[w] |= reach[to][w];
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Iterator to the internal data structure.
+     * @return read-only begin iterator
+     */
+    typename GraphType::const_iterator begin() const { return m_data.begin(); }
+
+    /**
+     * @brief Iterator to the internal data structure.
+     * @return  read-only end iterator
+     */
+    typename GraphType::const_iterator end() const { return m_data.end(); }
+
+private:
+    /**
+     * @brief Path based transitive reduction, only used for graphs with
+     * cycles where the reduction is not unique.
+     */
+    void removeTransitiveEdgesSlow() {
         bool changed;
 
         do {
@@ -275,18 +617,6 @@ public:
             }
         } while (changed);
     }
-
-    /**
-     * @brief Iterator to the internal data structure.
-     * @return read-only begin iterator
-     */
-    typename GraphType::const_iterator begin() const { return m_data.begin(); }
-
-    /**
-     * @brief Iterator to the internal data structure.
-     * @return  read-only end iterator
-     */
-    typename GraphType::const_iterator end() const { return m_data.end(); }
 };
 
 } // namespace internal
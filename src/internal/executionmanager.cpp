@@ -14,10 +14,14 @@ namespace internal {
 ExecutionManager::ExecutionManager(Framework &runtime)
     : logger("ExecutionManager"), m_numThreads(1),
       m_multithreading(false), valid(false), m_messaging(),
-      m_cycleCounter(-1), running(true),
-      m_runtime(runtime) {}
+      m_cycleCounter(-1), running(true), m_elastic(true), m_dagWidth(0),
+      m_activeThreads(0), m_runtime(runtime), m_ordered(false),
+      m_raceDetection(false),
+      m_raceDetector(moduleChannelGraph, runtime.channelMutex()),
+      m_partitioned(false), m_partitionsValid(false), m_numPartitions(0) {}
 
 ExecutionManager::~ExecutionManager() {
+    stopDetachedPartitions();
     stopRunning();
 }
 
@@ -25,15 +29,23 @@ ExecutionManager::~ExecutionManager() {
 void ExecutionManager::loop() {
     // Remove all messages from the message queue
     m_messaging.resetQueue();
+    m_messageBus.swap();
 
     m_cycleCounter++;
 
     // validate the ExecutionManager
     //validate();
 
+    if (m_raceDetection) {
+        m_raceDetector.cycleRunning(true);
+    }
+
     if (!m_multithreading) {
-        for (Module *mod : sortedCycleList) {
-            m_dog.beginModule(mod->getName());
+        for (Module *mod : m_attachedOrder) {
+            m_dog.beginModule(mod);
+            if (m_raceDetection) {
+                m_raceDetector.enter(mod);
+            }
 
             logger.time(mod->getName());
 
@@ -55,6 +67,9 @@ void ExecutionManager::loop() {
 
             logger.timeEnd(mod->getName());
 
+            if (m_raceDetection) {
+                m_raceDetector.leave();
+            }
             m_dog.endModule();
         }
     } else {
@@ -62,22 +77,28 @@ void ExecutionManager::loop() {
             logger.info() << "Cycle start";
         }
 
-        // if thread pool is not yet initialized then do it now
-        if (threadPool.empty()) {
-            for (int threadNum = 1; threadNum <= m_numThreads; threadNum++) {
-                threadPool.push_back(std::thread(
-                    [threadNum, this]() { threadFunction(threadNum); }));
-            }
+        // start or stop threads if the pool size changed
+        int poolSize = m_numThreads;
+        if (m_elastic) {
+            poolSize = std::min(poolSize, static_cast<int>(m_dagWidth));
+        }
+        if (poolSize != static_cast<int>(threadPool.size())) {
+            resizeThreadPool(poolSize);
         }
 
         {
             std::lock_guard<std::mutex> lck(mutex);
-            // copy cycleList so it can be modified
-            cycleListTmp = cycleList;
+            if (m_partitioned &&
+                m_threadPartitions.size() != static_cast<size_t>(poolSize) + 1) {
+                assignThreads(poolSize);
+            }
+
+            // copy the attached modules so they can be modified
+            cycleListTmp = m_attached;
             numModulesToExecute = cycleListTmp.countNodes();
 
             // inform all threads that there are new jobs to do
-            cv.notify_all();
+            m_notifier.notify();
         }
 
         {
@@ -94,6 +115,11 @@ void ExecutionManager::loop() {
             logger.info() << "Cycle end";
         }
     }
+
+    if (m_raceDetection) {
+        m_raceDetector.cycleRunning(false);
+        reportViolations();
+    }
 }
 
 void ExecutionManager::threadFunction(int threadNum) {
@@ -103,27 +129,17 @@ void ExecutionManager::threadFunction(int threadNum) {
 
     while (running) {
         // wait until something is in the cycleList
-        cv.wait(lck, [this, threadNum]() {
-            // the main thread stops
-            if (threadNum == 0 && numModulesToExecute == 0) {
-                return true;
-            }
-
-            return hasExecutableModules(threadNum);
-        });
+        m_notifier.wait(lck, [this, threadNum]() { return canRun(threadNum); });
 
-        if (numModulesToExecute == 0) {
+        if (numModulesToExecute == 0 || threadNum > m_activeThreads) {
             break;
         }
 
         Module *executableModule;
 
         bool found =
-            cycleListTmp.getFree(executableModule, [threadNum](Module *mod) {
-                return (mod->isMainThread() &&
-                        threadNum == 0) ||
-                       (!mod->isMainThread() &&
-                        threadNum != 0);
+            cycleListTmp.getFree(executableModule, [this, threadNum](Module *mod) {
+                return runsOn(mod, threadNum);
             });
 
         if (found) {
@@ -137,8 +153,13 @@ void ExecutionManager::threadFunction(int threadNum) {
             }
 
             // now we can execute it
+            const bool raceDetection = m_raceDetection;
             lck.unlock();
+            m_dog.beginModule(executableModule);
             logger.time(executableModule->getName());
+            if (raceDetection) {
+                m_raceDetector.enter(executableModule);
+            }
 
             try {
                 executableModule->cycle();
@@ -147,7 +168,11 @@ void ExecutionManager::threadFunction(int threadNum) {
                                       << " throws " << lms::typeName(ex)
                                       << " : " << ex.what();
             }
+            if (raceDetection) {
+                m_raceDetector.leave();
+            }
             logger.timeEnd(executableModule->getName());
+            m_dog.endModule();
 
             lck.lock();
 
@@ -164,11 +189,25 @@ void ExecutionManager::threadFunction(int threadNum) {
 
             // now inform our fellow threads that something new
             // can be executed
-            cv.notify_all();
+            m_notifier.notify();
         }
     }
 }
 
+bool ExecutionManager::canRun(int threadNum) {
+    // the main thread stops
+    if (threadNum == 0 && numModulesToExecute == 0) {
+        return true;
+    }
+
+    // the pool shrinks
+    if (threadNum > m_activeThreads) {
+        return true;
+    }
+
+    return hasExecutableModules(threadNum);
+}
+
 bool ExecutionManager::hasExecutableModules(int thread) {
     if (!running) {
         return true;
@@ -178,17 +217,59 @@ bool ExecutionManager::hasExecutableModules(int thread) {
         return false;
     }
 
-    return cycleListTmp.hasFree([thread](Module *mod) -> bool {
-        return (mod->isMainThread() && thread == 0) ||
-               ((!mod->isMainThread() && thread != 0));
+    return cycleListTmp.hasFree([this, thread](Module *mod) -> bool {
+        return runsOn(mod, thread);
     });
 }
 
+bool ExecutionManager::runsOn(Module *mod, int thread) const {
+    if (mod->isMainThread() || thread == 0) {
+        return mod->isMainThread() && thread == 0;
+    }
+    if (!m_partitioned || static_cast<size_t>(thread) >= m_threadPartitions.size()) {
+        return true;
+    }
+    auto it = m_partitionOf.find(mod);
+    return it == m_partitionOf.end() || m_threadPartitions[thread][it->second];
+}
+
+void ExecutionManager::assignThreads(int poolSize) {
+    auto assignment = assignWorkers(m_partitionWidths, poolSize);
+    m_threadPartitions.assign(poolSize + 1,
+                              std::vector<bool>(m_partitionWidths.size(), false));
+    for (size_t thread = 0; thread < assignment.size(); thread++) {
+        for (size_t partition : assignment[thread]) {
+            m_threadPartitions[thread + 1][partition] = true;
+        }
+    }
+}
+
+void ExecutionManager::resizeThreadPool(int size) {
+    logger.debug("threadPool") << "Resize from " << threadPool.size() << " to "
+                               << size << " threads";
+    {
+        std::lock_guard<std::mutex> lck(mutex);
+        m_activeThreads = size;
+        m_notifier.notify();
+    }
+
+    // threads with a number above size leave their loop
+    while (static_cast<int>(threadPool.size()) > size) {
+        threadPool.back().join();
+        threadPool.pop_back();
+    }
+
+    for (int threadNum = threadPool.size() + 1; threadNum <= size; threadNum++) {
+        threadPool.push_back(std::thread(
+            [threadNum, this]() { threadFunction(threadNum); }));
+    }
+}
+
 void ExecutionManager::stopRunning() {
     {
         std::lock_guard<std::mutex> lck(mutex);
         running = false;
-        cv.notify_all();
+        m_notifier.notify();
     }
 
     for (std::thread &th : threadPool) {
@@ -196,25 +277,124 @@ void ExecutionManager::stopRunning() {
     }
 }
 
-void ExecutionManager::invalidate() { valid = false; }
+void ExecutionManager::invalidate() {
+    // channelAccessAdded() reads the flag from detached partitions
+    std::lock_guard<std::mutex> lock(m_runtime.channelMutex());
+    valid = false;
+}
+
+void ExecutionManager::channelAccessAdded(const std::string &channel,
+                                          Module *module) {
+    // the next full rebuild includes the access anyway
+    if (valid) {
+        m_newAccesses.emplace_back(channel, module);
+    }
+}
+
+bool ExecutionManager::addNewAccesses(
+    const std::vector<std::pair<std::string, Module *>> &accesses) {
+    size_t added = 0;
+    for (const auto &access : accesses) {
+        if (!m_order.contains(access.second)) {
+            // new module
+            return false;
+        }
+        for (const auto &dep :
+             moduleChannelGraph.dependencies(access.first, access.second)) {
+            if (cycleList.hasEdge(dep.first, dep.second)) {
+                continue;
+            }
+            std::vector<Module *> cycle;
+            if (!m_order.edge(dep.first, dep.second, cycle)) {
+                // let the full rebuild report the cycle
+                return false;
+            }
+            cycleList.edge(dep.first, dep.second);
+            added++;
+        }
+    }
+
+    if (added > 0) {
+        sortedCycleList = m_order.order();
+        logger.debug("validate") << "Added " << added << " dependencies";
+    }
+    return true;
+}
+
+void ExecutionManager::logCycle(const std::vector<Module *> &cycle) {
+    if (cycle.empty()) {
+        logger.error("validate") << "Module graph has circle";
+        return;
+    }
+
+    std::string line;
+    for (size_t i = 0; i < cycle.size(); i++) {
+        Module *from = cycle[i];
+        Module *to = cycle[(i + 1) % cycle.size()];
+        line += from->getName() + " -(" +
+                moduleChannelGraph.channelBetween(from, to) + ")-> ";
+    }
+    line += cycle.front()->getName();
+    logger.error("validate") << "Module graph has circle: " << line;
+}
 
 void ExecutionManager::validate(const std::map<std::string, std::shared_ptr<Module>> &enabledModules) {
-    if (!valid) {
-        valid = true;
+    // modules of detached partitions may gain access concurrently, only
+    // work on a snapshot. Accesses added after it are kept for the next call.
+    bool ordered;
+    std::vector<std::pair<std::string, Module *>> newAccesses;
+    {
+        std::lock_guard<std::mutex> lock(m_runtime.channelMutex());
+        ordered = valid;
+        newAccesses.swap(m_newAccesses);
+    }
+    // new accesses may race even if they don't change the order
+    const bool changed = !ordered || !newAccesses.empty();
+    if (changed || m_messageBus.usersChanged()) {
+        // nothing else modifies the graph from here on
+        stopDetachedPartitions();
+        m_partitionsValid = false;
+    }
 
-        logger.debug("sort") << "No. of enabled modules: " << enabledModules.size();
+    if (ordered && !newAccesses.empty()) {
+        ordered = m_ordered && addNewAccesses(newAccesses);
+    }
 
-        // add modules to the list
-        cycleList = moduleChannelGraph.generateDAG();
-        for (auto it : enabledModules) {
-            cycleList.node(it.second.get());
+    if (!ordered) {
+        {
+            std::lock_guard<std::mutex> lock(m_runtime.channelMutex());
+            valid = true;
         }
 
+        logger.debug("sort") << "No. of enabled modules: " << enabledModules.size();
+        for (const auto &module : enabledModules) {
+            m_dog.moduleName(module.second.get(), module.first);
+        }
+        // modules may have been replaced, report everything again
+        m_reportedRaces.clear();
+
         sortedCycleList.clear();
-        bool success = cycleList.topoSort(sortedCycleList);
+        bool success = !m_schedule.order.empty() && applySchedule(enabledModules);
+        // the schedule is only valid for the modules' first channel accesses
+        m_schedule = Schedule();
 
         if (!success) {
-            logger.error("validate") << "Module graph has circle";
+            // add modules to the list
+            cycleList = moduleChannelGraph.generateDAG();
+            for (auto it : enabledModules) {
+                cycleList.node(it.second.get());
+            }
+
+            success = cycleList.topoSort(sortedCycleList);
+        }
+
+        m_ordered = success;
+        if (success) {
+            m_order.reset(cycleList, sortedCycleList);
+        } else {
+            std::vector<Module *> cycle;
+            cycleList.findCycle(cycle);
+            logCycle(cycle);
         }
 
         if(m_runtime.isDebug()) {
@@ -222,6 +402,402 @@ void ExecutionManager::validate(const std::map<std::string, std::shared_ptr<Modu
             dumpGraphs();
         }
     }
+
+    if (!m_partitionsValid) {
+        updatePartitions();
+    }
+
+    if (m_raceDetection && changed) {
+        reportUnorderedAccesses();
+    }
+}
+
+void ExecutionManager::updatePartitions() {
+    m_partitionsValid = true;
+    stopDetachedPartitions();
+
+    const std::vector<std::vector<Module *>> components = cycleList.components();
+    m_numPartitions = components.size();
+    m_partitionOf.clear();
+    for (size_t i = 0; i < components.size(); i++) {
+        for (Module *mod : components[i]) {
+            m_partitionOf[mod] = i;
+        }
+    }
+
+    const auto topics = m_messageBus.users();
+    std::vector<bool> detached(components.size(), false);
+    for (const auto &info : m_detachInfos) {
+        auto it = std::find_if(m_partitionOf.begin(), m_partitionOf.end(),
+                               [&info](const std::pair<Module *const, size_t> &p) {
+                                   return p.first->getName() == info.module;
+                               });
+        if (it == m_partitionOf.end()) {
+            logger.warn("partitions") << "Can't detach " << info.module
+                                      << ", module is not enabled";
+            continue;
+        }
+        const size_t partition = it->second;
+        const auto &modules = components[partition];
+        auto mainThread = std::find_if(modules.begin(), modules.end(),
+                                       [](Module *mod) { return mod->isMainThread(); });
+        if (mainThread != modules.end()) {
+            logger.warn("partitions") << "Can't detach " << info.module
+                                      << ", its partition contains the main thread module "
+                                      << (*mainThread)->getName();
+            continue;
+        }
+        std::string topic;
+        if (sharesTopics(partition, topics, topic)) {
+            logger.warn("partitions") << "Can't detach " << info.module
+                                      << ", topic " << topic
+                                      << " is used outside of its partition";
+            continue;
+        }
+        if (!m_ordered || detached[partition]) {
+            continue;
+        }
+        detached[partition] = true;
+
+        std::unique_ptr<DetachedPartition> runner(new DetachedPartition);
+        runner->domain = m_detached.size() + 1;
+        runner->clock.cycleTime(info.clock.cycle);
+        runner->clock.enabledSleep(info.clock.sleep);
+        runner->clock.enabledSlowWarning(info.clock.slowWarnings);
+        runner->clock.enabledCompensate(info.clock.sleepCompensate);
+        runner->raceDetection = m_raceDetection;
+        for (Module *mod : sortedCycleList) {
+            if (m_partitionOf[mod] == partition) {
+                runner->modules.push_back(mod);
+                m_detachedMessaging[mod] = &runner->messaging;
+            }
+        }
+        m_detached.push_back(std::move(runner));
+    }
+
+    std::vector<int> domainOf(components.size(), 0);
+    for (const auto &runner : m_detached) {
+        domainOf[m_partitionOf[runner->modules.front()]] = runner->domain;
+    }
+    m_messageBus.assignDomains([this, &domainOf](const std::set<const void *> &users) {
+        for (const void *user : users) {
+            auto it = m_partitionOf.find(static_cast<Module *>(const_cast<void *>(user)));
+            if (it != m_partitionOf.end()) {
+                return domainOf[it->second];
+            }
+        }
+        return 0;
+    });
+
+    m_attached = cycleList;
+    m_attachedOrder.clear();
+    for (Module *mod : sortedCycleList) {
+        if (detached[m_partitionOf[mod]]) {
+            m_attached.removeNode(mod);
+        } else {
+            m_attachedOrder.push_back(mod);
+        }
+    }
+
+    // the pool only executes attached modules that don't need the main thread
+    m_partitionWidths.assign(components.size(), 0);
+    if (m_partitioned) {
+        m_dagWidth = 0;
+        for (size_t i = 0; i < components.size(); i++) {
+            if (!detached[i]) {
+                m_partitionWidths[i] = cycleList.width([this, i](Module *mod) {
+                    return !mod->isMainThread() && m_partitionOf[mod] == i;
+                });
+                m_dagWidth += m_partitionWidths[i];
+            }
+        }
+    } else {
+        m_dagWidth = cycleList.width([this, &detached](Module *mod) {
+            return !mod->isMainThread() && !detached[m_partitionOf[mod]];
+        });
+    }
+    {
+        std::lock_guard<std::mutex> lck(mutex);
+        // assigned again by the next loop()
+        m_threadPartitions.clear();
+    }
+
+    logger.debug("validate") << "Modules that can run in parallel: "
+                             << m_dagWidth << ", partitions: " << m_numPartitions
+                             << ", detached: " << m_detached.size();
+
+    for (auto &runner : m_detached) {
+        DetachedPartition *partition = runner.get();
+        partition->thread = std::thread(
+            [this, partition]() { runDetached(*partition); });
+    }
+}
+
+bool ExecutionManager::sharesTopics(
+    size_t partition, const std::map<std::string, std::set<const void *>> &topics,
+    std::string &topic) const {
+    for (const auto &pair : topics) {
+        bool inside = false, outside = false;
+        for (const void *user : pair.second) {
+            // users that are not enabled anymore are ignored
+            auto it = m_partitionOf.find(static_cast<Module *>(const_cast<void *>(user)));
+            if (it != m_partitionOf.end()) {
+                (it->second == partition ? inside : outside) = true;
+            }
+        }
+        if (inside && outside) {
+            topic = pair.first;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ExecutionManager::runDetached(DetachedPartition &partition) {
+    while (true) {
+        partition.clock.beforeLoopIteration();
+        if (!partition.running.load()) {
+            break;
+        }
+        partition.messaging.resetQueue();
+        m_messageBus.swap(partition.domain);
+
+        for (Module *mod : partition.modules) {
+            m_dog.beginModule(mod);
+            if (partition.raceDetection) {
+                m_raceDetector.enter(mod);
+            }
+            logger.time(mod->getName());
+            try {
+                mod->cycle();
+            } catch (std::exception const &ex) {
+                logger.error("cycle") << mod->getName() << " throws "
+                                      << lms::typeName(ex) << " : "
+                                      << ex.what();
+            }
+            logger.timeEnd(mod->getName());
+            if (partition.raceDetection) {
+                m_raceDetector.leave();
+            }
+            m_dog.endModule();
+        }
+    }
+}
+
+void ExecutionManager::stopDetachedPartitions() {
+    if (m_detached.empty()) {
+        return;
+    }
+    for (auto &partition : m_detached) {
+        partition->running = false;
+    }
+    for (auto &partition : m_detached) {
+        partition->thread.join();
+    }
+    m_detached.clear();
+    m_detachedMessaging.clear();
+    m_partitionsValid = false;
+}
+
+bool ExecutionManager::detachedChannel(const std::string &channel) {
+    if (m_detachedMessaging.empty()) {
+        return false;
+    }
+    // detached modules may gain access concurrently
+    std::lock_guard<std::mutex> lock(m_runtime.channelMutex());
+    for (const auto &access : moduleChannelGraph.getChannelAccessors(channel)) {
+        if (m_detachedMessaging.count(access.module) > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ExecutionManager::partitions(bool flag) {
+    if (flag != m_partitioned) {
+        m_partitioned = flag;
+        m_partitionsValid = false;
+    }
+}
+
+bool ExecutionManager::partitions() const { return m_partitioned; }
+
+void ExecutionManager::detachPartitions(
+    const std::vector<DetachedPartitionInfo> &infos) {
+    m_detachInfos = infos;
+    m_partitionsValid = false;
+}
+
+size_t ExecutionManager::numPartitions() const { return m_numPartitions; }
+
+void ExecutionManager::reportUnorderedAccesses() {
+    // main thread modules never run at the same time
+    auto unordered = moduleChannelGraph.unorderedAccesses(
+        cycleList, [](Module *a, Module *b) {
+            return a->isMainThread() && b->isMainThread();
+        });
+
+    for (const auto &pair : unordered) {
+        auto key = std::make_tuple(pair.channel, pair.first.module,
+                                   pair.second.module);
+        if (!m_reportedRaces.insert(key).second) {
+            continue;
+        }
+        auto permission = [](const ModuleChannelGraph<Module *>::Access &a) {
+            return a.permission == MCGPermission::WRITE ? "writes" : "reads";
+        };
+        logger.warn("race") << "Unordered access to " << pair.channel << ": "
+                            << pair.first.module->getName() << " "
+                            << permission(pair.first) << ", "
+                            << pair.second.module->getName() << " "
+                            << permission(pair.second)
+                            << ", set a priority in a channelMapping";
+    }
+}
+
+void ExecutionManager::reportViolations() {
+    typedef RaceDetector<Module *>::Violation Violation;
+    for (const auto &violation : m_raceDetector.takeViolations()) {
+        switch (violation.kind) {
+        case Violation::NOT_ACCESSOR:
+            logger.error("race") << violation.module->getName()
+                                 << " accessed channel " << violation.channel
+                                 << " without readChannel() or writeChannel()";
+            break;
+        case Violation::READ_ONLY:
+            logger.error("race") << violation.module->getName()
+                                 << " wrote channel " << violation.channel
+                                 << " that it only reads";
+            break;
+        case Violation::OUTSIDE_MODULE:
+            logger.error("race") << "Channel " << violation.channel
+                                 << " was accessed by a thread outside of "
+                                    "a module during the cycle";
+            break;
+        }
+    }
+}
+
+void ExecutionManager::raceDetection(bool flag) {
+    if (flag == m_raceDetection) {
+        return;
+    }
+    m_raceDetection = flag;
+    m_runtime.dataManager().observeAccesses(flag ? &m_raceDetector : nullptr);
+    m_reportedRaces.clear();
+    // report the unordered accesses of the current graph
+    invalidate();
+}
+
+bool ExecutionManager::raceDetection() const { return m_raceDetection; }
+
+bool ExecutionManager::applySchedule(
+    const std::map<std::string, std::shared_ptr<Module>> &enabledModules) {
+    if (m_schedule.order.size() != enabledModules.size()) {
+        logger.warn("schedule") << "Modules changed, ignoring schedule";
+        return false;
+    }
+
+    DAG<Module *> dag;
+    std::vector<Module *> order;
+    std::map<std::string, size_t> position;
+    for (const auto &name : m_schedule.order) {
+        auto it = enabledModules.find(name);
+        if (it == enabledModules.end()) {
+            logger.warn("schedule") << "Module " << name
+                                    << " is not enabled, ignoring schedule";
+            return false;
+        }
+        position[name] = order.size();
+        dag.node(it->second.get());
+        order.push_back(it->second.get());
+    }
+
+    for (const auto &edge : m_schedule.edges) {
+        auto from = position.find(edge.first);
+        auto to = position.find(edge.second);
+        if (from == position.end() || to == position.end() ||
+            from->second >= to->second) {
+            logger.warn("schedule") << "Invalid edge " << edge.first << " -> "
+                                    << edge.second << ", ignoring schedule";
+            return false;
+        }
+        dag.edge(order[from->second], order[to->second]);
+    }
+
+    // same modules, but e.g. a changed channel mapping or priority needs
+    // other edges
+    if (m_schedule.accessHash != accessHash()) {
+        logger.warn("schedule") << "Channel accesses changed, ignoring schedule";
+        return false;
+    }
+
+    cycleList = dag;
+    sortedCycleList = order;
+    logger.debug("schedule") << "Using precomputed schedule";
+    return true;
+}
+
+std::uint64_t ExecutionManager::accessHash() const {
+    std::vector<Schedule::Access> accesses;
+    for (const auto &channel : moduleChannelGraph.m_data) {
+        for (const auto &access : channel.second) {
+            accesses.push_back({channel.first, access.module->getName(),
+                                access.permission == MCGPermission::WRITE,
+                                access.priority});
+        }
+    }
+    return Schedule::hashAccesses(accesses);
+}
+
+void ExecutionManager::useSchedule(const Schedule &schedule) {
+    m_schedule = schedule;
+    invalidate();
+}
+
+bool ExecutionManager::schedule(Schedule &result) {
+    if (!m_ordered) {
+        return false;
+    }
+
+    for (Module *mod : sortedCycleList) {
+        result.order.push_back(mod->getName());
+    }
+    result.accessHash = accessHash();
+
+    DAG<Module *> reduced = cycleList;
+    reduced.removeTransitiveEdges();
+    for (auto const &pair : reduced) {
+        for (Module *from : pair.second) {
+            result.edges.push_back(
+                std::make_pair(from->getName(), pair.first->getName()));
+        }
+    }
+    std::sort(result.edges.begin(), result.edges.end());
+
+    std::vector<Module *> path;
+    cycleList.criticalPath(path);
+    for (Module *mod : path) {
+        result.criticalPath.push_back(mod->getName());
+    }
+
+    // the main thread runs the main thread modules, the pool all others
+    result.width = m_dagWidth;
+    const size_t hardwareThreads =
+        std::max(1u, std::thread::hardware_concurrency());
+    result.suggestedThreads =
+        static_cast<int>(std::max<size_t>(1, std::min(m_dagWidth, hardwareThreads)));
+
+    for (const auto &conflict : moduleChannelGraph.writeConflicts()) {
+        result.conflicts.push_back({conflict.channel,
+                                    conflict.first->getName(),
+                                    conflict.second->getName()});
+    }
+    std::sort(result.conflicts.begin(), result.conflicts.end(),
+              [](const Schedule::Conflict &a, const Schedule::Conflict &b) {
+                  return a.channel < b.channel;
+              });
+    return true;
 }
 
 void ExecutionManager::dumpGraphs() {
@@ -248,6 +824,26 @@ void ExecutionManager::numThreadsAuto() {
 
 int ExecutionManager::numThreads() const { return m_numThreads; }
 
+void ExecutionManager::waitPolicy(WaitPolicy policy) {
+    std::lock_guard<std::mutex> lck(mutex);
+    m_notifier.policy(policy);
+}
+
+WaitPolicy ExecutionManager::waitPolicy() const {
+    return m_notifier.policy();
+}
+
+void ExecutionManager::spinTime(lms::Time time) {
+    std::lock_guard<std::mutex> lck(mutex);
+    m_notifier.spinTime(time);
+}
+
+void ExecutionManager::elasticThreads(bool flag) { m_elastic = flag; }
+
+bool ExecutionManager::elasticThreads() const { return m_elastic; }
+
+size_t ExecutionManager::dagWidth() const { return m_dagWidth; }
+
 void ExecutionManager::enabledMultithreading(bool flag) {
     m_multithreading = flag;
 }
@@ -276,6 +872,18 @@ void ExecutionManager::printCycleList() { printCycleList(cycleList); }
 
 Messaging &ExecutionManager::messaging() { return m_messaging; }
 
+Messaging &ExecutionManager::messaging(const Module *module) {
+    if (!m_detachedMessaging.empty()) {
+        auto it = m_detachedMessaging.find(module);
+        if (it != m_detachedMessaging.end()) {
+            return *it->second;
+        }
+    }
+    return m_messaging;
+}
+
+MessageBus &ExecutionManager::messageBus() { return m_messageBus; }
+
 int ExecutionManager::cycleCounter() { return m_cycleCounter; }
 
 void ExecutionManager::writeDAG(DotExporter &dot, const std::string &prefix) {
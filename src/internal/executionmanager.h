@@ -8,7 +8,10 @@
 #include <memory>
 #include <thread>
 #include <mutex>
-#include <condition_variable>
+#include <set>
+#include <tuple>
+#include <atomic>
+#include <unordered_map>
 
 #include "lms/module.h"
 #include "loader.h"
@@ -16,9 +19,16 @@
 #include "executionmanager.h"
 #include "lms/logger.h"
 #include "lms/messaging.h"
+#include "lms/message_bus.h"
 #include "dag.h"
 #include "watch_dog.h"
 #include "module_channel_graph.h"
+#include "online_topo_order.h"
+#include "schedule.h"
+#include "race_detector.h"
+#include "partition.h"
+#include "clock.h"
+#include "work_notifier.h"
 
 namespace lms {
 class DataManager;
@@ -66,6 +76,89 @@ public:
      */
     int numThreads() const;
 
+    /**
+     * @brief Set how idle threads of the pool wait for the next module.
+     */
+    void waitPolicy(WaitPolicy policy);
+
+    WaitPolicy waitPolicy() const;
+
+    /**
+     * @brief Set how long threads spin with WaitPolicy::SPIN_THEN_BLOCK
+     * before they sleep.
+     */
+    void spinTime(lms::Time time);
+
+    /**
+     * @brief Enable or disable elastic pool sizing.
+     *
+     * If enabled, the pool only starts as many threads as modules can run in
+     * parallel according to the DAG, numThreads() is the upper bound. The
+     * pool grows and shrinks when the DAG changes.
+     */
+    void elasticThreads(bool flag);
+
+    bool elasticThreads() const;
+
+    /**
+     * @brief Maximum number of non-main-thread modules that can run in
+     * parallel, computed by validate().
+     */
+    size_t dagWidth() const;
+
+    /**
+     * @brief Enable or disable race detection.
+     *
+     * validate() reports accesses to the same channel, at least one of them
+     * a write, by modules that may run in parallel. While modules are
+     * executed, every channel access is checked to come from a module that
+     * requested the channel with the needed permission. This slows down
+     * channel access.
+     */
+    void raceDetection(bool flag);
+
+    bool raceDetection() const;
+
+    /**
+     * @brief Give independent partitions of the module graph, i.e. parts
+     * without channels between them, their own worker threads.
+     */
+    void partitions(bool flag);
+
+    bool partitions() const;
+
+    /**
+     * @brief Run the partitions that contain the given modules on their own
+     * thread with their own clock, decoupled from loop().
+     *
+     * Partitions with main thread modules can't be detached. Modules of a
+     * detached partition use their own message queue.
+     */
+    void detachPartitions(const std::vector<DetachedPartitionInfo> &infos);
+
+    /**
+     * @brief Stop the threads of detached partitions, the next validate()
+     * starts them again.
+     *
+     * Must be called before modules are destroyed or reconfigured.
+     */
+    void stopDetachedPartitions();
+
+    /**
+     * @brief Return true if a module of a running detached partition accesses
+     * the channel.
+     *
+     * Such channels are written concurrently to loop(), the cycle thread must
+     * not read or write them between two cycles.
+     */
+    bool detachedChannel(const std::string &channel);
+
+    /**
+     * @brief Number of independent partitions of the module graph, computed
+     * by validate().
+     */
+    size_t numPartitions() const;
+
     /**
      * @brief Enable or diable multithreading.
      */
@@ -84,6 +177,20 @@ public:
 
     Messaging &messaging();
 
+    /**
+     * @brief Message queue of a module, differs from messaging() for modules
+     * of detached partitions.
+     */
+    Messaging &messaging(const Module *module);
+
+    /**
+     * @brief Typed message bus of all modules.
+     *
+     * Topics that are only used by the modules of a detached partition are
+     * swapped by the partition's cycle, all others by loop().
+     */
+    MessageBus &messageBus();
+
     /**
      * @brief Invoke configsChanged() of all enabled modules.
      */
@@ -99,17 +206,44 @@ public:
 
     ModuleChannelGraph<Module *> &getModuleChannelGraph();
 
+    /**
+     * @brief Called after a module gained access to a channel.
+     *
+     * The new dependencies are inserted into the execution order by the next
+     * validate() without rebuilding it.
+     */
+    void channelAccessAdded(const std::string &channel, Module *module);
+
     const DAG<Module *> &getDAG();
 
+    /**
+     * @brief Use a precomputed schedule for the next full validate() instead
+     * of generating the DAG from the module channel graph.
+     *
+     * The schedule is ignored if its modules or their channel accesses
+     * differ from the enabled modules. Channel accesses after that are added
+     * incrementally.
+     */
+    void useSchedule(const Schedule &schedule);
+
+    /**
+     * @brief Compute the static schedule of the modules, validate() must
+     * have been called before.
+     * @return false if the module graph has a cycle
+     */
+    bool schedule(Schedule &result);
+
 private:
     logging::Logger logger;
 
     int m_numThreads;
     bool m_multithreading;
 
+    // guarded by channelMutex(), read by channelAccessAdded()
     bool valid;
 
     Messaging m_messaging;
+    MessageBus m_messageBus;
     WatchDog m_dog;
 
     int m_cycleCounter;
@@ -117,12 +251,19 @@ private:
     // stuff for multithreading
     std::vector<std::thread> threadPool;
     std::mutex mutex;
-    std::condition_variable cv;
+    WorkNotifier m_notifier;
     size_t numModulesToExecute;
     bool running;
+    bool m_elastic;
+    size_t m_dagWidth;
+    // pool threads with a higher number stop
+    int m_activeThreads;
     bool hasExecutableModules(int thread);
+    bool canRun(int threadNum);
     void threadFunction(int threadNum);
+    void resizeThreadPool(int size);
     void stopRunning();
+    bool runsOn(Module *mod, int thread) const;
 
     Framework &m_runtime;
 
@@ -131,8 +272,62 @@ private:
     DAG<Module *> cycleListTmp;
     std::vector<Module *> sortedCycleList;
 
+    // incremental updates of sortedCycleList, only used if the DAG was
+    // sorted successfully
+    OnlineTopoOrder<Module *> m_order;
+    bool m_ordered;
+    // guarded by channelMutex(), validate() takes them in one swap
+    std::vector<std::pair<std::string, Module *>> m_newAccesses;
+    bool addNewAccesses(const std::vector<std::pair<std::string, Module *>> &accesses);
+    void logCycle(const std::vector<Module *> &cycle);
+
+    // precomputed schedule, empty if not used
+    Schedule m_schedule;
+    bool applySchedule(const std::map<std::string, std::shared_ptr<Module>> &enabledModules);
+    std::uint64_t accessHash() const;
+
     void printCycleList(DAG<Module *> &list);
     void dumpGraphs();
+
+    bool m_raceDetection;
+    RaceDetector<Module *> m_raceDetector;
+    std::set<std::tuple<std::string, Module *, Module *>> m_reportedRaces;
+    void reportUnorderedAccesses();
+    void reportViolations();
+
+    // independent partitions of the module graph
+    bool m_partitioned;
+    std::vector<DetachedPartitionInfo> m_detachInfos;
+    bool m_partitionsValid;
+    size_t m_numPartitions;
+    std::unordered_map<Module *, size_t> m_partitionOf;
+    // width of each attached partition, 0 for detached partitions
+    std::vector<size_t> m_partitionWidths;
+    // partitions each pool thread executes, index 0 is the main thread
+    std::vector<std::vector<bool>> m_threadPartitions;
+    void assignThreads(int poolSize);
+    // modules of loop(), without detached partitions
+    DAG<Module *> m_attached;
+    std::vector<Module *> m_attachedOrder;
+
+    struct DetachedPartition {
+        std::vector<Module *> modules;
+        Clock clock;
+        Messaging messaging;
+        // message bus domain, loop() uses 0
+        int domain = 0;
+        bool raceDetection = false;
+        std::atomic<bool> running;
+        std::thread thread;
+        DetachedPartition() : running(true) {}
+    };
+    std::vector<std::unique_ptr<DetachedPartition>> m_detached;
+    std::unordered_map<const Module *, Messaging *> m_detachedMessaging;
+    void updatePartitions();
+    bool sharesTopics(size_t partition,
+                      const std::map<std::string, std::set<const void *>> &topics,
+                      std::string &topic) const;
+    void runDetached(DetachedPartition &partition);
 };
 
 } // namespace internal
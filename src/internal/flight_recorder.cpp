@@ -0,0 +1,251 @@
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "flight_recorder.h"
+
+namespace lms {
+namespace internal {
+
+namespace {
+
+// async-signal-safe
+bool writeAll(int fd, const char *data, size_t size) {
+    while (size > 0) {
+        const ssize_t written = ::write(fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        size -= written;
+    }
+    return true;
+}
+
+}  // namespace
+
+FlightRecorder::FlightRecorder()
+    : logger("lms.FlightRecorder"), m_head(0), m_count(0), m_stream(&m_buffer),
+      m_dumpRequested(false), m_writing(false) {}
+
+FlightRecorder::~FlightRecorder() {
+    if (m_writer.joinable()) {
+        m_writer.join();
+    }
+}
+
+void FlightRecorder::configure(const std::vector<std::string> &channels,
+                               size_t frames) {
+    m_channels = channels;
+    m_frames.clear();
+    m_head = 0;
+    m_count = 0;
+    m_crashPath.clear();
+
+    if (frames == 0) {
+        m_channels.clear();
+        return;
+    }
+
+    m_frames.resize(m_channels.size());
+    for (auto &ring : m_frames) {
+        ring.resize(frames);
+    }
+}
+
+bool FlightRecorder::enabled() const { return !m_frames.empty(); }
+
+const std::vector<std::string> &FlightRecorder::channels() const {
+    return m_channels;
+}
+
+void FlightRecorder::record(
+    DataManager &dm, const std::function<bool(const std::string &)> &excluded) {
+    for (size_t i = 0; i < m_channels.size(); i++) {
+        std::string &frame = m_frames[i][m_head];
+        frame.clear();
+        if (excluded && excluded(m_channels[i])) {
+            continue;
+        }
+        m_buffer.target(&frame);
+        dm.readChannel<lms::Any>(m_channels[i]).serialize(m_stream);
+    }
+    m_buffer.target(nullptr);
+
+    m_head = (m_head + 1) % m_frames[0].size();
+    if (m_count < m_frames[0].size()) {
+        m_count++;
+    }
+}
+
+void FlightRecorder::requestDump(const std::string &tag) {
+    {
+        std::lock_guard<std::mutex> lock(m_tagMutex);
+        m_tag = tag;
+    }
+    m_dumpRequested = true;
+}
+
+void FlightRecorder::requestDump() { m_dumpRequested = true; }
+
+bool FlightRecorder::takeDumpRequest(std::string &tag) {
+    if (!m_dumpRequested.exchange(false)) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(m_tagMutex);
+    tag.swap(m_tag);
+    m_tag.clear();
+    return true;
+}
+
+bool FlightRecorder::dumpAsync(const std::string &path,
+                               const lms::MetaFile &meta) {
+    if (!enabled()) {
+        return false;
+    }
+    if (m_writing) {
+        logger.warn("dump") << "Still writing the previous dump, skipped "
+                            << path;
+        return false;
+    }
+
+    // copy the frames in chronological order so that the cycle thread can
+    // continue to overwrite the ring while the copy is written
+    struct Snapshot {
+        std::vector<std::vector<std::string>> frames;
+        lms::MetaFile meta;
+    };
+    std::shared_ptr<Snapshot> snapshot = std::make_shared<Snapshot>();
+    const size_t capacity = m_frames[0].size();
+    const size_t first = (m_head + capacity - m_count) % capacity;
+    snapshot->frames.resize(m_frames.size());
+    for (size_t i = 0; i < m_frames.size(); i++) {
+        snapshot->frames[i].reserve(m_count);
+        for (size_t j = 0; j < m_count; j++) {
+            snapshot->frames[i].push_back(m_frames[i][(first + j) % capacity]);
+        }
+    }
+    snapshot->meta = meta;
+
+    // the previous writer already finished, joining does not block
+    if (m_writer.joinable()) {
+        m_writer.join();
+    }
+
+    std::vector<std::string> channels = m_channels;
+    m_writing = true;
+    m_writer = std::thread([this, path, channels, snapshot]() {
+        if (write(path, channels, snapshot->frames, 0,
+                  snapshot->frames.empty() ? 0 : snapshot->frames[0].size(),
+                  snapshot->meta)) {
+            logger.info("dump") << "Wrote flight recorder to " << path;
+        } else {
+            logger.error("dump") << "Could not write flight recorder to "
+                                 << path;
+        }
+        m_writing = false;
+    });
+    return true;
+}
+
+bool FlightRecorder::dump(const std::string &path,
+                          const lms::MetaFile &meta) const {
+    if (!enabled()) {
+        return false;
+    }
+    const size_t capacity = m_frames[0].size();
+    return write(path, m_channels, m_frames,
+                 (m_head + capacity - m_count) % capacity, m_count, meta);
+}
+
+void FlightRecorder::prepareCrashDump(const std::string &path,
+                                      const lms::MetaFile &meta) {
+    m_crashPath = path;
+    m_crashTmpPath = path + ".part";
+    m_crashFiles.clear();
+    for (const auto &channel : m_channels) {
+        m_crashFiles.push_back(m_crashTmpPath + "/" + channel);
+    }
+    m_crashMetaFile = m_crashTmpPath + "/__meta";
+    m_crashMeta.clear();
+    meta.SerializePartialToString(&m_crashMeta);
+}
+
+bool FlightRecorder::crashDump() const {
+    if (!enabled() || m_crashPath.empty()) {
+        return false;
+    }
+    if (::mkdir(m_crashTmpPath.c_str(), 0775) != 0) {
+        return false;
+    }
+
+    const size_t capacity = m_frames[0].size();
+    const size_t first = (m_head + capacity - m_count) % capacity;
+    for (size_t i = 0; i < m_crashFiles.size(); i++) {
+        const int fd = ::open(m_crashFiles[i].c_str(),
+                              O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
+            return false;
+        }
+        bool ok = true;
+        for (size_t j = 0; j < m_count && ok; j++) {
+            const std::string &frame = m_frames[i][(first + j) % capacity];
+            ok = writeAll(fd, frame.data(), frame.size());
+        }
+        ::close(fd);
+        if (!ok) {
+            return false;
+        }
+    }
+
+    const int fd = ::open(m_crashMetaFile.c_str(),
+                          O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    const bool ok = writeAll(fd, m_crashMeta.data(), m_crashMeta.size());
+    ::close(fd);
+
+    return ok && ::rename(m_crashTmpPath.c_str(), m_crashPath.c_str()) == 0;
+}
+
+bool FlightRecorder::write(const std::string &path,
+                           const std::vector<std::string> &channels,
+                           const std::vector<std::vector<std::string>> &frames,
+                           size_t first, size_t count,
+                           const lms::MetaFile &meta) {
+    std::string tmpPath = path + ".part";
+    if (::mkdir(tmpPath.c_str(), 0775) != 0) {
+        return false;
+    }
+
+    for (size_t i = 0; i < channels.size(); i++) {
+        std::ofstream os(tmpPath + "/" + channels[i], std::ios::binary);
+        const size_t capacity = frames[i].size();
+        for (size_t j = 0; j < count; j++) {
+            const std::string &frame = frames[i][(first + j) % capacity];
+            os.write(frame.data(), frame.size());
+        }
+        if (!os) {
+            return false;
+        }
+    }
+
+    std::ofstream metaFile(tmpPath + "/__meta", std::ios::binary);
+    if (!meta.SerializePartialToOstream(&metaFile)) {
+        return false;
+    }
+    metaFile.close();
+
+    return ::rename(tmpPath.c_str(), path.c_str()) == 0;
+}
+
+} // namespace internal
+} // namespace lms
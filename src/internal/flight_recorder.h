@@ -0,0 +1,159 @@
+#ifndef LMS_INTERNAL_FLIGHT_RECORDER_H
+#define LMS_INTERNAL_FLIGHT_RECORDER_H
+
+#include <functional>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <ostream>
+
+#include "lms/datamanager.h"
+#include "lms/logger.h"
+#include "string_buffer.h"
+#include "recording_meta.pb.h"
+
+namespace lms {
+namespace internal {
+
+/**
+ * @brief In-memory "black box" that keeps the serialized contents of a set of
+ * data channels for the last N cycles.
+ *
+ * All frames are kept in a ring that is allocated once in configure(). The
+ * frame buffers keep their capacity when they are overwritten, so recording
+ * does not allocate in steady state as long as the serialized size of the
+ * channels does not grow.
+ *
+ * A dump writes the same layout as a regular recording (one file per channel
+ * plus __meta), so it can be replayed with --enable-load and --ch. The dump is
+ * written to a temporary directory first and renamed afterwards, so a
+ * directory with the final name is always complete.
+ *
+ * record() and the dump methods must be called from the cycle thread.
+ * requestDump() may be called from any thread.
+ */
+class FlightRecorder {
+public:
+    FlightRecorder();
+    ~FlightRecorder();
+
+    FlightRecorder(const FlightRecorder &) = delete;
+    FlightRecorder &operator=(const FlightRecorder &) = delete;
+
+    /**
+     * @brief Allocate the ring buffer. Discards all recorded frames.
+     * @param channels channels to record
+     * @param frames number of cycles to keep, 0 disables the recorder
+     */
+    void configure(const std::vector<std::string> &channels, size_t frames);
+
+    /**
+     * @brief Return true if configure() was called with at least one channel
+     * and a non-zero number of frames.
+     */
+    bool enabled() const;
+
+    /**
+     * @brief Serialize all recorded channels into the next frame, overwriting
+     * the oldest frame if the ring is full.
+     * @param excluded returns true for channels that must not be read now,
+     * their frame stays empty
+     */
+    void record(DataManager &dm,
+                const std::function<bool(const std::string &)> &excluded = nullptr);
+
+    /**
+     * @brief Request a dump with a custom tag. The dump is done by the cycle
+     * thread at the end of the current cycle.
+     */
+    void requestDump(const std::string &tag);
+
+    /**
+     * @brief Request a dump with a generated tag.
+     *
+     * Only sets an atomic flag and is therefore safe to call from signal
+     * handlers.
+     */
+    void requestDump();
+
+    /**
+     * @brief Check and reset a pending dump request.
+     * @param tag set to the requested tag, empty if none was given
+     * @return true if a dump was requested
+     */
+    bool takeDumpRequest(std::string &tag);
+
+    /**
+     * @brief Copy the ring and write it to disk on a background thread.
+     *
+     * Never waits for the previous dump, the cycle thread must not block on
+     * disk I/O. The dump is skipped with a warning while the previous one is
+     * still being written.
+     *
+     * @return false if the recorder is disabled or the dump was skipped
+     */
+    bool dumpAsync(const std::string &path, const lms::MetaFile &meta);
+
+    /**
+     * @brief Write the ring to disk on the calling thread.
+     */
+    bool dump(const std::string &path, const lms::MetaFile &meta) const;
+
+    /**
+     * @brief Compute everything crashDump() needs in advance. configure()
+     * discards it.
+     */
+    void prepareCrashDump(const std::string &path, const lms::MetaFile &meta);
+
+    /**
+     * @brief Write the ring to the path given to prepareCrashDump().
+     *
+     * Only uses async-signal-safe calls and does not allocate, so it can be
+     * called from a SIGSEGV handler. A frame that was being recorded when
+     * the signal arrived may be incomplete.
+     *
+     * @return false if no crash dump was prepared or writing failed
+     */
+    bool crashDump() const;
+
+    const std::vector<std::string> &channels() const;
+
+private:
+    logging::Logger logger;
+
+    std::vector<std::string> m_channels;
+    // one ring per channel, all rings share head and count
+    std::vector<std::vector<std::string>> m_frames;
+    size_t m_head;
+    size_t m_count;
+
+    StringOutputBuffer m_buffer;
+    std::ostream m_stream;
+
+    std::atomic<bool> m_dumpRequested;
+    std::mutex m_tagMutex;
+    std::string m_tag;
+
+    std::thread m_writer;
+    // true while m_writer writes a dump
+    std::atomic<bool> m_writing;
+
+    // prepared by prepareCrashDump()
+    std::string m_crashPath;
+    std::string m_crashTmpPath;
+    std::vector<std::string> m_crashFiles;
+    std::string m_crashMetaFile;
+    std::string m_crashMeta;
+
+    static bool write(const std::string &path,
+                      const std::vector<std::string> &channels,
+                      const std::vector<std::vector<std::string>> &frames,
+                      size_t first, size_t count, const lms::MetaFile &meta);
+};
+
+} // namespace internal
+} // namespace lms
+
+#endif // LMS_INTERNAL_FLIGHT_RECORDER_H
@@ -6,17 +6,30 @@
 #include <sys/types.h>
 #include <stdio.h>
 #include <unistd.h>
+#include <poll.h>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <ctime>
+#include <thread>
+#include <fcntl.h>
 #include "backtrace_formatter.h"
 #include "lms/protobuf_socket.h"
+#include "lms/shared_memory.h"
 #include "os.h"
 #include "recording_meta.pb.h"
 
 namespace lms {
 namespace internal {
 
+constexpr const char *Framework::DUMP_FLIGHT_RECORDER;
+constexpr std::int64_t Framework::LIBRARY_CHECK_MILLIS;
+
 Framework::Framework(const std::string &mainConfigFilePath)
     : m_executionManager(*this), logger("lms.Framework"),
-      mainConfigFilePath(mainConfigFilePath), m_running(false), is_debug(false) {
+      mainConfigFilePath(mainConfigFilePath), m_running(false), is_debug(false),
+      m_commands(16) {
 
     // start();
 }
@@ -32,53 +45,14 @@ void Framework::start() {
     while (m_running) {
         // config monitor stuff
         if (firstRun || configMonitor.hasChangedFiles()) {
-            logger.info() << "Reload configs";
-            configMonitor.unwatchAll();
-            RuntimeInfo runtime;
-            for(const auto &f: flags) {
-                logger.info("flag") << f;
-            }
-            XmlParser parser(runtime, flags);
-            parser.parseFile(mainConfigFilePath);
-
-            for (auto error : parser.errors()) {
-                logger.error("XML") << error;
-            }
-
-            if(parser.errors().size() > 0) {
-                logger.error("XML") << "Fix XML errors first. Shutting down...";
+            if(! loadConfig()) {
                 m_running = false;
                 break;
             }
+        }
 
-            // Add libraries
-            for(const auto &libraryInfo : runtime.libraries) {
-                m_loader.registerLib(libraryInfo.lib);
-            }
-
-            initChannelTypes();
-
-            try {
-                logger.time("updateSystem");
-                if(! updateSystem(runtime)) {
-                    m_running = false;
-                    break;
-                }
-                logger.timeEnd("updateSystem");
-            } catch(std::exception const &ex) {
-                logger.error() << lms::typeName(ex) << ": " <<  ex.what();
-                m_running = false;
-                break;
-            }
-
-            if(isDebug()) {
-                printOverview();
-                printModuleChannelGraph();
-            }
-
-            for (auto file : parser.files()) {
-                configMonitor.watch(file);
-            }
+        if(m_hotReload) {
+            reloadChangedModules();
         }
 
         if(!cycle()) {
@@ -92,82 +66,250 @@ void Framework::start() {
     logger.info() << "Stopped";
 }
 
+bool Framework::loadConfig() {
+    logger.info() << "Reload configs";
+    configMonitor.unwatchAll();
+    RuntimeInfo runtime;
+    for(const auto &f: flags) {
+        logger.info("flag") << f;
+    }
+    XmlParser parser(runtime, flags);
+    parser.parseFile(mainConfigFilePath);
+
+    for (auto error : parser.errors()) {
+        logger.error("XML") << error;
+    }
+
+    if(parser.errors().size() > 0) {
+        logger.error("XML") << "Fix XML errors first. Shutting down...";
+        return false;
+    }
+
+    // Add libraries
+    for(const auto &libraryInfo : runtime.libraries) {
+        m_loader.registerLib(libraryInfo.lib);
+    }
+
+    initChannelTypes();
+
+    try {
+        logger.time("updateSystem");
+        if(! updateSystem(runtime)) {
+            return false;
+        }
+        logger.timeEnd("updateSystem");
+    } catch(std::exception const &ex) {
+        logger.error() << lms::typeName(ex) << ": " <<  ex.what();
+        return false;
+    }
+
+    if(isDebug()) {
+        printOverview();
+        printModuleChannelGraph();
+    }
+
+    for (auto file : parser.files()) {
+        configMonitor.watch(file);
+    }
+    return true;
+}
+
+bool Framework::dryRun(Schedule &schedule) {
+    m_dryRun = true;
+    if(! loadConfig()) {
+        return false;
+    }
+    if(modules.size() == 0) {
+        logger.error() << "No modules enabled. Check your config file.";
+        return false;
+    }
+
+    m_executionManager.validate(modules);
+    return m_executionManager.schedule(schedule);
+}
+
 bool Framework::updateSystem(const RuntimeInfo &info) {
     if(isDebug()) {
         logger.debug() << "updateSystem()";
     }
 
+    // only touch what changed since the last call
+    const RuntimeDiff diff = diffRuntime(m_runtimeInfo, info);
+
+    // modules are reconfigured or destroyed below, detached partitions are
+    // started again by the next cycle
+    m_executionManager.stopDetachedPartitions();
+
     // Update clock
     m_clock.cycleTime(info.clock.cycle);
     m_clock.enabledSleep(info.clock.sleep);
     m_clock.enabledSlowWarning(info.clock.slowWarnings);
     m_clock.enabledCompensate(info.clock.sleepCompensate);
-
-    // Update or load services
-    for (const ServiceInfo &serviceInfo : info.services) {
-        if(isDebug()) {
-            logger.debug() << "Loading service " << serviceInfo.name;
+    m_executionManager.dog().watch(
+        info.clock.watchDogEnabled ? info.clock.watchDog : Time::ZERO,
+        info.clock.watchDogStacks);
+
+    // Update thread pool, --threads on the command line takes precedence
+    const ExecutionInfo &exec = info.execution;
+    if(exec.multithreading && !m_executionManager.enabledMultithreading()) {
+        m_executionManager.enabledMultithreading(true);
+        if(exec.threads > 0) {
+            m_executionManager.numThreads(exec.threads);
+        } else {
+            m_executionManager.numThreadsAuto();
         }
-        auto it = services.find(serviceInfo.name);
-        if (it == services.end()) {
-            // Not loaded yet
-            std::shared_ptr<Service> service(m_loader.loadService(serviceInfo));
+    }
+    m_executionManager.elasticThreads(exec.elastic);
+    m_executionManager.waitPolicy(exec.waitPolicy);
+    m_executionManager.spinTime(exec.spinTime);
+    m_executionManager.raceDetection(exec.raceDetection);
+    m_executionManager.partitions(exec.partitions);
+    m_executionManager.detachPartitions(exec.detached);
+
+    if(diff.flightRecorderChanged) {
+        configureFlightRecorder(info);
+    }
 
-            service->initBase(serviceInfo);
+    // a dry run computes the schedule that would be loaded here
+    if(info.schedule != m_runtimeInfo.schedule && !info.schedule.empty() && !m_dryRun) {
+        std::ifstream file(info.schedule);
+        Schedule schedule;
+        if(file.is_open() && schedule.read(file)) {
+            m_executionManager.useSchedule(schedule);
+        } else {
+            logger.error("schedule") << "Could not read " << info.schedule;
+        }
+    }
 
-            try {
-                if (!service->init()) {
-                    logger.error() << "Service " << serviceInfo.name
-                                   << " failed to init()";
-                    return false;
+    // a dry run must not create or remove segments of running runtimes
+    if(!m_dryRun) {
+        for(const auto &channel : info.sharedChannels) {
+            if(diff.addedSharedChannels.count(channel.name) == 1 ||
+                    diff.changedSharedChannels.count(channel.name) == 1) {
+                m_dataManager.shareChannel(channel.name, channel.writer, channel.slots);
+            }
+        }
+        for(const auto &channel : m_runtimeInfo.sharedChannels) {
+            if(diff.removedSharedChannels.count(channel.name) == 1) {
+                logger.warn() << "Shared channel " << channel.name
+                              << " was removed, restart to make it local";
+                if(channel.writer) {
+                    SharedMemorySegment::unlink(channel.name);
                 }
-            } catch (std::exception const &ex) {
-                logger.error() << serviceInfo.name << " throws "
-                               << lms::typeName(ex) << " : " << ex.what();
-                return false;
             }
+        }
+    }
+
+    m_initThreads = exec.initThreads > 0 ? exec.initThreads
+        : std::max(1u, std::thread::hardware_concurrency());
+
+    for(const auto &name : diff.removedServices) {
+        logger.warn() << "Service " << name << " was removed, restart to unload it";
+    }
+    for(const auto &name : diff.reloadedServices) {
+        logger.warn() << "Service " << name << " changed lib, class or workers, restart to apply";
+    }
 
-            services[serviceInfo.name] = service;
+    // Update or load services
+    LifeCycleScheduler serviceInit;
+    std::map<std::string, std::shared_ptr<Service>> newServices;
+    for (const ServiceInfo &serviceInfo : info.services) {
+        m_serviceInitAfter[serviceInfo.name] = serviceInfo.initAfter;
+        auto it = services.find(serviceInfo.name);
+        if (it == services.end()) {
+            // Not loaded yet
+            std::shared_ptr<Service> &service = newServices[serviceInfo.name];
+            serviceInit.add(serviceInfo.name, [this, &serviceInfo, &service]() {
+                return initService(serviceInfo, service);
+            });
         } else {
             // already loaded
-            it->second->initBase(serviceInfo);
-            it->second->configsChanged();
+            if(diff.reconfiguredServices.count(serviceInfo.name) == 1) {
+                it->second->initBase(serviceInfo);
+                it->second->configsChanged();
+            }
+            serviceInit.add(serviceInfo.name, []() { return true; });
         }
     }
+    for (const ServiceInfo &serviceInfo : info.services) {
+        addInitDependencies(serviceInit, serviceInfo.name, serviceInfo.initAfter);
+    }
+    if(serviceInit.hasCycle()) {
+        logger.error() << "Services have cyclic initAfter dependencies";
+        return false;
+    }
 
-    // Update or load modules
+    const bool servicesLoaded = serviceInit.run(m_initThreads);
+    for (auto &service : newServices) {
+        if (service.second) {
+            services[service.first] = service.second;
+        }
+    }
+    if(!servicesLoaded) {
+        return false;
+    }
+
+    // Modules that need a new instance are loaded again below
+    for(const auto &name : diff.removedModules) {
+        unloadModule(name);
+        m_moduleInitAfter.erase(name);
+    }
+    for(const auto &name : diff.reloadedModules) {
+        unloadModule(name);
+    }
+
+    // Update or load modules, all services are initialized at this point
+    LifeCycleScheduler moduleInit;
+    std::map<std::string, std::shared_ptr<Module>> newModules;
     for (const ModuleInfo &moduleInfo : info.modules) {
         if(m_ignoreModules.count(moduleInfo.name) == 1) {
             logger.warn() << "Ignoring module " << moduleInfo.name;
             continue;
         }
-        if(isDebug()) {
-            logger.debug() << "Loading module " << moduleInfo.name;
-        }
+        m_moduleInitAfter[moduleInfo.name] = moduleInfo.initAfter;
         auto it = modules.find(moduleInfo.name);
         if (it == modules.end()) {
             // Not yet loaded
-            std::shared_ptr<Module> module(m_loader.loadModule(moduleInfo));
-            module->initBase(moduleInfo, this);
-
-            try {
-                if (!module->init()) {
-                    logger.error() << "Module " << moduleInfo.name
-                                   << " failed to init()";
-                    return false;
-                }
-            } catch (std::exception const &ex) {
-                logger.error() << moduleInfo.name << " throws "
-                               << lms::typeName(ex) << " : " << ex.what();
-                return false;
+            std::shared_ptr<Module> &module = newModules[moduleInfo.name];
+            moduleInit.add(moduleInfo.name, [this, &moduleInfo, &module]() {
+                return initModule(moduleInfo, module);
+            }, moduleInfo.mainThread);
+        } else {
+            if(diff.reconfiguredModules.count(moduleInfo.name) == 1) {
+                it->second->initBase(moduleInfo, this);
+                it->second->configsChanged();
             }
+            moduleInit.add(moduleInfo.name, []() { return true; });
+        }
+    }
+    for (const ModuleInfo &moduleInfo : info.modules) {
+        if(moduleInit.has(moduleInfo.name)) {
+            addInitDependencies(moduleInit, moduleInfo.name, moduleInfo.initAfter);
+        }
+    }
+    if(moduleInit.hasCycle()) {
+        logger.error() << "Modules have cyclic initAfter dependencies";
+        return false;
+    }
 
-            modules[moduleInfo.name] = module;
-        } else {
-            it->second->initBase(moduleInfo, this);
-            it->second->configsChanged();
+    const bool modulesLoaded = moduleInit.run(m_initThreads);
+    for (auto &module : newModules) {
+        if (module.second) {
+            modules[module.first] = module.second;
+            m_executionManager.invalidate();
         }
     }
+    if(!modulesLoaded) {
+        return false;
+    }
+
+    watchLibraries(info);
+    m_runtimeInfo = info;
+
+    // channels exist once their modules are initialized
+    if(m_flightRecorder.enabled()) {
+        prepareCrashDump();
+    }
 
     if(isDebug()) {
         logger.debug() << "updated system";
@@ -176,29 +318,227 @@ bool Framework::updateSystem(const RuntimeInfo &info) {
     return true;
 }
 
+bool Framework::initService(const ServiceInfo &info,
+                            std::shared_ptr<Service> &result) {
+    if(isDebug()) {
+        logger.debug() << "Loading service " << info.name;
+    }
+    try {
+        std::shared_ptr<Service> service(m_loader.loadService(info));
+        service->initBase(info);
+
+        if (!service->init()) {
+            logger.error() << "Service " << info.name << " failed to init()";
+            return false;
+        }
+        result = service;
+        std::lock_guard<std::mutex> lock(m_initOrderMutex);
+        m_serviceInitOrder.push_back(info.name);
+        return true;
+    } catch (std::exception const &ex) {
+        logger.error() << info.name << " throws " << lms::typeName(ex)
+                       << " : " << ex.what();
+        return false;
+    }
+}
+
+bool Framework::initModule(const ModuleInfo &info,
+                           std::shared_ptr<Module> &result) {
+    if(isDebug()) {
+        logger.debug() << "Loading module " << info.name;
+    }
+    try {
+        std::shared_ptr<Module> module(m_loader.loadModule(info));
+        module->initBase(info, this);
+
+        if (!module->init()) {
+            logger.error() << "Module " << info.name << " failed to init()";
+            return false;
+        }
+        result = module;
+        std::lock_guard<std::mutex> lock(m_initOrderMutex);
+        m_moduleInitOrder.push_back(info.name);
+        return true;
+    } catch (std::exception const &ex) {
+        logger.error() << info.name << " throws " << lms::typeName(ex)
+                       << " : " << ex.what();
+        return false;
+    }
+}
+
+void Framework::addInitDependencies(LifeCycleScheduler &scheduler,
+                                    const std::string &name,
+                                    const std::vector<std::string> &initAfter) {
+    for(const auto &dependency : initAfter) {
+        if(scheduler.has(dependency)) {
+            scheduler.dependency(name, dependency);
+        } else {
+            logger.warn() << name << " should be initialized after unknown "
+                          << dependency;
+        }
+    }
+}
+
+Framework::FileSignature Framework::fileSignature(const std::string &path) {
+    struct stat info;
+    if(::stat(path.c_str(), &info) != 0) {
+        return FileSignature();
+    }
+    return FileSignature(info.st_mtime, info.st_size, info.st_ino);
+}
+
+void Framework::watchLibraries(const RuntimeInfo &info) {
+    m_hotReload = info.hotReload;
+    m_moduleInfos.clear();
+
+    std::map<std::string, WatchedLibrary> watched;
+    if(m_hotReload) {
+        for(const ModuleInfo &moduleInfo : info.modules) {
+            if(modules.count(moduleInfo.name) == 0) {
+                continue;
+            }
+            m_moduleInfos[moduleInfo.name] = moduleInfo;
+
+            if(watched.count(moduleInfo.lib) == 1) {
+                continue;
+            }
+            auto it = m_watchedLibraries.find(moduleInfo.lib);
+            if(it != m_watchedLibraries.end()) {
+                watched.insert(*it);
+            } else {
+                WatchedLibrary &lib = watched[moduleInfo.lib];
+                lib.path = m_loader.libraryPath(moduleInfo.lib);
+                lib.signature = fileSignature(lib.path);
+                logger.info("hotReload") << "Watching " << lib.path;
+            }
+        }
+    }
+    m_watchedLibraries.swap(watched);
+}
+
+void Framework::reloadChangedModules() {
+    const lms::Time now = lms::Time::now();
+    if(now < m_nextLibraryCheck) {
+        return;
+    }
+    m_nextLibraryCheck = now + lms::Time::fromMillis(LIBRARY_CHECK_MILLIS);
+
+    for(auto &lib : m_watchedLibraries) {
+        const FileSignature signature = fileSignature(lib.second.path);
+        if(signature != lib.second.signature) {
+            // the compiler may still be writing, wait until the file was not
+            // changed for one check interval
+            lib.second.signature = signature;
+            lib.second.changed = true;
+            continue;
+        }
+        if(!lib.second.changed || signature == FileSignature()) {
+            continue;
+        }
+        lib.second.changed = false;
+
+        logger.info("hotReload") << "Reloading " << lib.second.path;
+        m_executionManager.stopDetachedPartitions();
+        try {
+            m_loader.reloadLibrary(lib.first);
+        } catch(std::exception const &ex) {
+            logger.error("hotReload") << lms::typeName(ex) << ": " << ex.what();
+            continue;
+        }
+
+        for(const auto &moduleInfo : m_moduleInfos) {
+            if(moduleInfo.second.lib == lib.first) {
+                reloadModule(moduleInfo.second);
+            }
+        }
+    }
+}
+
+void Framework::unloadModule(const std::string &name) {
+    auto it = modules.find(name);
+    if(it == modules.end()) {
+        return;
+    }
+    if(isDebug()) {
+        logger.debug() << "Unloading module " << name;
+    }
+    m_executionManager.stopDetachedPartitions();
+    try {
+        it->second->destroy();
+    } catch (std::exception const &ex) {
+        logger.error() << name << " throws " << lms::typeName(ex)
+                       << " : " << ex.what();
+    }
+    // channels stay in the data manager, only the accesses are removed
+    m_executionManager.getModuleChannelGraph().removeModule(it->second.get());
+    modules.erase(it);
+    m_moduleInitOrder.erase(std::remove(m_moduleInitOrder.begin(),
+                                        m_moduleInitOrder.end(), name),
+                            m_moduleInitOrder.end());
+    m_executionManager.invalidate();
+}
+
+void Framework::reloadModule(const ModuleInfo &info) {
+    unloadModule(info.name);
+
+    std::shared_ptr<Module> module;
+    if(initModule(info, module)) {
+        modules[info.name] = module;
+        m_executionManager.invalidate();
+        logger.info("hotReload") << "Reloaded " << info.name;
+    } else {
+        logger.error("hotReload") << info.name
+                                  << " stays unloaded until its lib changes again";
+    }
+}
+
 void Framework::shutdown() {
-    // Shutdown services
-    for (auto &service : services) {
+    m_executionManager.stopDetachedPartitions();
+
+    // Destroy modules before the services they may use, one after another in
+    // reverse init order even if they were initialized in parallel
+    for(auto name = m_moduleInitOrder.rbegin(); name != m_moduleInitOrder.rend(); ++name) {
+        auto module = modules.find(*name);
+        if(module == modules.end()) {
+            continue;
+        }
         try {
-            service.second->destroy();
+            module->second->destroy();
         } catch (std::exception const &ex) {
-            logger.error() << service.first << " throws " << lms::typeName(ex)
+            logger.error() << module->first << " throws " << lms::typeName(ex)
                            << " : " << ex.what();
         }
     }
 
-    // Shutdown modules
-    for (auto &module : modules) {
+    for(auto name = m_serviceInitOrder.rbegin(); name != m_serviceInitOrder.rend(); ++name) {
+        auto service = services.find(*name);
+        if(service == services.end()) {
+            continue;
+        }
         try {
-            module.second->destroy();
+            service->second->stopWorkers();
+            service->second->destroy();
         } catch (std::exception const &ex) {
-            logger.error() << module.first << " throws " << lms::typeName(ex)
+            logger.error() << service->first << " throws " << lms::typeName(ex)
                            << " : " << ex.what();
         }
     }
 
     services.clear();
     modules.clear();
+    m_moduleInitOrder.clear();
+    m_serviceInitOrder.clear();
+
+    // readers never unlink, a crashed writer leaves its segments behind so
+    // that the readers see its values again after a restart
+    if(!m_dryRun) {
+        for(const auto &channel : m_runtimeInfo.sharedChannels) {
+            if(channel.writer) {
+                SharedMemorySegment::unlink(channel.name);
+            }
+        }
+    }
+    m_runtimeInfo.sharedChannels.clear();
 }
 
 Framework::~Framework() {
@@ -212,18 +552,19 @@ bool Framework::cycle() {
     }
 
     m_clock.beforeLoopIteration();
+    applyCommands();
     executionManager().validate(modules);
 
-    {
-        std::lock_guard<std::mutex> lock(m_recordingMutex);
-        if(m_recordingState == RecordingState::LOAD) {
-            for(auto &stream : m_recordingStreams) {
-                try {
-                    m_dataManager.writeChannel<lms::Any>(stream.first).deserialize(stream.second);
-                } catch(std::exception &ex) {
-                    // jump to beginning in case of an error
-                    stream.second.seekg(0, std::ios::beg);
-                }
+    if(m_recordingState == RecordingState::LOAD) {
+        for(auto &stream : m_recordingStreams) {
+            if(detachedChannel(stream.first)) {
+                continue;
+            }
+            try {
+                m_dataManager.writeChannel<lms::Any>(stream.first).deserialize(stream.second);
+            } catch(std::exception &ex) {
+                // jump to beginning in case of an error
+                stream.second.seekg(0, std::ios::beg);
             }
         }
     }
@@ -232,42 +573,177 @@ bool Framework::cycle() {
     m_executionManager.loop();
     logger.timeEnd("cycle");
 
-    {
-        std::lock_guard<std::mutex> lock(m_recordingMutex);
-        if(m_recordingState == RecordingState::SAVE) {
-            for(auto &stream : m_recordingStreams) {
-                m_dataManager.readChannel<lms::Any>(stream.first).serialize(stream.second);
+    if(m_recordingState == RecordingState::SAVE) {
+        for(auto &stream : m_recordingStreams) {
+            if(detachedChannel(stream.first)) {
+                continue;
             }
-            if(m_firstRecordSavingCycle) {
-                m_firstRecordSavingCycle = false;
+            m_dataManager.readChannel<lms::Any>(stream.first).serialize(stream.second);
+        }
+        if(m_firstRecordSavingCycle) {
+            m_firstRecordSavingCycle = false;
+
+            lms::MetaFile metaMessage;
+            for(auto &channels : m_recordingStreams) {
+                addChannelMeta(metaMessage, channels.first);
+            }
+            metaMessage.SerializePartialToOstream(m_recordingMetaFile.get());
+            m_recordingMetaFile.reset();
+        }
+    }
+
+    // detached partitions write their channels while this thread reads
+    const auto excluded = [this](const std::string &channel) {
+        return detachedChannel(channel);
+    };
 
+    if(m_flightRecorder.enabled()) {
+        m_flightRecorder.record(m_dataManager, excluded);
+
+        for(const auto &tag : m_executionManager.messaging().receive(DUMP_FLIGHT_RECORDER)) {
+            m_flightRecorder.requestDump(tag);
+        }
+
+        std::string tag;
+        if(m_flightRecorder.takeDumpRequest(tag)) {
+            dumpFlightRecorder(tag);
+        }
+    }
+
+    if(m_inspector.enabled()) {
+        m_inspector.sample(m_dataManager, m_executionManager.cycleCounter(),
+                           excluded);
+    }
+
+    return true;
+}
+
+bool Framework::detachedChannel(const std::string &channel) {
+    if(!m_executionManager.detachedChannel(channel)) {
+        return false;
+    }
+    if(m_reportedDetachedChannels.insert(channel).second) {
+        logger.warn() << "Channel " << channel << " is used by a detached "
+                      << "partition, it is not recorded or inspected";
+    }
+    return true;
+}
+
+void Framework::applyCommands() {
+    RuntimeCommand command;
+    while(m_commands.pop(command)) {
+        switch(command.type) {
+        case RuntimeCommand::START_RECORDING:
+            logger.info() << "Start recording...";
+            m_recordingState = RecordingState::SAVE;
+            m_firstRecordSavingCycle = true;
+            m_recordingStreams.swap(command.streams);
+            m_recordingMetaFile = std::move(command.metaFile);
+            break;
+        case RuntimeCommand::STOP_RECORDING:
+            {
+            // meta file is missing if no cycle was recorded
+            if(m_firstRecordSavingCycle) {
                 lms::MetaFile metaMessage;
                 for(auto &channels : m_recordingStreams) {
-                    lms::MetaFile::Channel *channelMessage = metaMessage.add_channels();
-                    std::string channelName = channels.first;
-                    channelMessage->set_name(channelName);
-                    channelMessage->set_type(m_dataManager.accessChannel<lms::Any>(channelName)->typeName());
-                    auto accessors = m_executionManager.getModuleChannelGraph().getChannelAccessors(channelName);
-                    for(const auto &access : accessors) {
-                        if(access.permission == MCGPermission::WRITE) {
-                            *channelMessage->add_writing_modules() = access.module->getName();
-                        }
-                    }
+                    addChannelMeta(metaMessage, channels.first);
                 }
-                std::ofstream metaFile(homepath() + "/lmslogs/temp/__meta");
-                metaMessage.SerializePartialToOstream(&metaFile);
-                metaFile.close();
+                metaMessage.SerializePartialToOstream(m_recordingMetaFile.get());
+            }
+            m_recordingMetaFile.reset();
+            m_recordingStreams.clear();
+            std::string newPath = homepath() + "/lmslogs/" + command.tag;
+            if(::rename(command.path.c_str(), newPath.c_str()) == 0) {
+                logger.info() << "Stopped recording " << command.tag;
+            } else {
+                logger.error() << "Could not move recording " << command.path
+                               << " to " << newPath << ": " << strerror(errno);
+            }
+            m_recordingState = NONE;
             }
+            break;
+        case RuntimeCommand::SET_LOG_LEVEL:
+            logging::Context::getDefault().setLevel(command.level);
+            break;
+        case RuntimeCommand::SUBSCRIBE_CHANNELS:
+            m_inspector.subscribe(command.channels, command.interval);
+            break;
+        case RuntimeCommand::NONE:
+            break;
         }
     }
+}
 
-    return true;
+void Framework::addChannelMeta(lms::MetaFile &meta, const std::string &channel) {
+    lms::MetaFile::Channel *channelMessage = meta.add_channels();
+    channelMessage->set_name(channel);
+    channelMessage->set_type(m_dataManager.accessChannel<lms::Any>(channel)->typeName());
+    auto accessors = m_executionManager.getModuleChannelGraph().getChannelAccessors(channel);
+    for(const auto &access : accessors) {
+        if(access.permission == MCGPermission::WRITE) {
+            *channelMessage->add_writing_modules() = access.module->getName();
+        }
+    }
+}
+
+void Framework::configureFlightRecorder(const RuntimeInfo &info) {
+    const FlightRecorderInfo &fr = info.flightRecorder;
+    if(!fr.enabled) {
+        m_flightRecorder.configure({}, 0);
+        return;
+    }
+
+    size_t frames = fr.frames;
+    if(frames == 0) {
+        if(info.clock.cycle > Time::ZERO) {
+            frames = fr.duration.micros() / info.clock.cycle.micros();
+        } else {
+            logger.warn("flightRecorder") << "No clock given, use frames attribute to set the size";
+        }
+    }
+
+    logger.info("flightRecorder") << "Recording " << fr.channels.size()
+                                  << " channels for the last " << frames << " cycles";
+    m_flightRecorder.configure(fr.channels, frames);
+}
+
+void Framework::prepareCrashDump() {
+    std::string basePath = homepath() + "/lmslogs";
+    ::mkdir(basePath.c_str(), MODE);
+
+    lms::MetaFile metaMessage;
+    for(const auto &channel : m_flightRecorder.channels()) {
+        addChannelMeta(metaMessage, channel);
+    }
+    m_flightRecorder.prepareCrashDump(basePath + "/crash-" + std::to_string(getpid()),
+                                      metaMessage);
+}
+
+void Framework::dumpFlightRecorder(std::string tag) {
+    if(tag.empty()) {
+        tag = "flightrecorder-" + currentTimeString();
+    }
+    std::string basePath = homepath() + "/lmslogs";
+    ::mkdir(basePath.c_str(), MODE);
+
+    lms::MetaFile metaMessage;
+    for(const auto &channel : m_flightRecorder.channels()) {
+        addChannelMeta(metaMessage, channel);
+    }
+
+    if(m_flightRecorder.dumpAsync(basePath + "/" + tag, metaMessage)) {
+        logger.info("flightRecorder") << "Dump to " << basePath << "/" << tag;
+    }
 }
 
 std::shared_ptr<Service> Framework::getService(std::string const &name) {
-    return services[name];
+    // does not insert, modules may call this in parallel during init()
+    auto it = services.find(name);
+    return it == services.end() ? nullptr : it->second;
 }
 
+std::mutex &Framework::channelMutex() { return m_channelMutex; }
+
 bool Framework::isDebug() const {
     return is_debug; /* TODO make this configurable */
 }
@@ -326,22 +802,57 @@ void Framework::addFlag(const std::string &flag) {
     flags.push_back(flag);
 }
 
+namespace {
+
+// async-signal-safe
+char *appendNumber(char *out, unsigned long value) {
+    char digits[24];
+    int count = 0;
+    do {
+        digits[count++] = '0' + value % 10;
+        value /= 10;
+    } while(value > 0);
+    while(count > 0) {
+        *out++ = digits[--count];
+    }
+    return out;
+}
+
+// async-signal-safe, writes /tmp/lms-segfault-<pid>-<time>.txt
+void writeSegfaultStacktrace() {
+    char path[80] = "/tmp/lms-segfault-";
+    char *end = appendNumber(path + strlen(path), getpid());
+    *end++ = '-';
+    end = appendNumber(end, std::time(nullptr));
+    memcpy(end, ".txt", 5);
+
+    const int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if(fd < 0) {
+        return;
+    }
+    writeStacktrace(fd);
+    ::close(fd);
+}
+
+}  // namespace
+
 void Framework::signal(int signal) {
     switch(signal) {
     case SIGFPE:
     case SIGSEGV:
-        {
-        std::ofstream of(std::string("/tmp/lms-segfault-") +
-                         std::to_string(getpid()) + "-" + std::to_string(std::time(NULL)) + ".txt");
-        printStacktrace(of);
-        of.close();
-        shutdown();
-        _exit(1);
-        }
+        // only async-signal-safe calls, the process state is undefined
+        writeSegfaultStacktrace();
+        m_flightRecorder.crashDump();
+        // let the default action terminate the process and dump core
+        ::signal(signal, SIG_DFL);
+        ::raise(signal);
         break;
     case SIGINT:
         m_running = false;
         break;
+    case SIGUSR2:
+        m_flightRecorder.requestDump();
+        break;
     }
 }
 
@@ -391,109 +902,210 @@ void Framework::startCommunicationThread(int sock) {
     dup2(in[0], STDIN_FILENO);
     int hookedStdin = in[1];
 
-    m_communicationThread = std::thread([sock, hookedStdin, this] () {
+    // the communication thread tracks the recording state on its own, the
+    // cycle thread applies the commands in the same order
+    const bool loading = m_recordingState == RecordingState::LOAD;
+
+    m_communicationThread = std::thread([sock, hookedStdin, loading, this] () {
         ProtobufSocket socket(sock);
         lms::Request message;
-        while(socket.readMessage(message) == ProtobufSocket::OK) {
-            if(message.has_stdin()) {
-                const std::string &buf = message.stdin().buffer();
-                ::write(hookedStdin, buf.c_str(), buf.size());
-                continue;
+        lms::Response snapshot;
+        bool recording = false;
+        // directory of the running recording, renamed by STOP_RECORDING
+        std::string recordingPath;
+
+        pollfd fds[2];
+        fds[0].fd = sock;
+        fds[0].events = POLLIN;
+        fds[1].fd = m_inspector.eventFd();
+        fds[1].events = POLLIN;
+        while(true) {
+            if(poll(fds, 2, -1) == -1) {
+                if(errno == EINTR) {
+                    continue;
+                }
+                break;
             }
-
-            using C = lms::Request::Runtime::ContentCase;
-            if(!message.has_runtime()) {
-                logger.error() << "Received unknown message via commSocket";
+            if(fds[1].revents & POLLIN) {
+                sendSnapshots(socket, snapshot);
+            }
+            if(fds[0].revents == 0) {
                 continue;
             }
+            ProtobufSocket::Error readRes = socket.receive();
+            if(readRes != ProtobufSocket::OK) {
+                break;
+            }
+            while(socket.nextMessage(message, readRes)) {
+                if(message.has_stdin()) {
+                    const std::string &buf = message.stdin().buffer();
+                    ::write(hookedStdin, buf.c_str(), buf.size());
+                    continue;
+                }
 
-            switch(message.runtime().content_case()) {
-            case C::kProfiling:
-                {
-                std::map<std::string, logging::Trace<double>> measurements;
-                logging::Context::getDefault().profilingSummary(measurements);
-                if(message.runtime().profiling().reset()) {
-                    logging::Context::getDefault().resetProfiling();
+                using C = lms::Request::Runtime::ContentCase;
+                if(!message.has_runtime()) {
+                    logger.error() << "Received unknown message via commSocket";
+                    continue;
                 }
-                lms::Response summary;
-                summary.mutable_profiling_summary(); // set type of response even if no measurements available
-                for(const auto &pair : measurements) {
-                    Response::ProfilingSummary::Trace *trace = summary.mutable_profiling_summary()->add_traces();
-                    trace->set_name(pair.first);
-                    trace->set_count(pair.second.count());
-                    trace->set_avg(pair.second.avg());
-                    if(pair.second.count() > 0) {
-                        trace->set_min(pair.second.min());
-                        trace->set_max(pair.second.max());
-                    } else {
-                        trace->set_min(0);
-                        trace->set_max(0);
+
+                switch(message.runtime().content_case()) {
+                case C::kProfiling:
+                    {
+                    std::map<std::string, logging::Trace<double>> measurements;
+                    logging::Context::getDefault().profilingSummary(measurements);
+                    if(message.runtime().profiling().reset()) {
+                        logging::Context::getDefault().resetProfiling();
                     }
-                    trace->set_std(pair.second.std());
-                    if(pair.second.hasBegin()) {
-                        trace->set_running_since((lms::Time::now() - pair.second.begin()).micros());
+                    lms::Response summary;
+                    summary.mutable_profiling_summary(); // set type of response even if no measurements available
+                    for(const auto &pair : measurements) {
+                        Response::ProfilingSummary::Trace *trace = summary.mutable_profiling_summary()->add_traces();
+                        trace->set_name(pair.first);
+                        trace->set_count(pair.second.count());
+                        trace->set_avg(pair.second.avg());
+                        if(pair.second.count() > 0) {
+                            trace->set_min(pair.second.min());
+                            trace->set_max(pair.second.max());
+                        } else {
+                            trace->set_min(0);
+                            trace->set_max(0);
+                        }
+                        trace->set_std(pair.second.std());
+                        if(pair.second.hasBegin()) {
+                            trace->set_running_since((lms::Time::now() - pair.second.begin()).micros());
+                        }
                     }
-                }
-                socket.writeMessage(summary);
-                }
-                break;
-            case C::kFilter:
-                // TODO
-                {
-                logging::Context::getDefault().setLevel(
-                    static_cast<logging::Level>(message.runtime().filter().log_level()));
-                }
-                break;
-            case C::kStartRecording:
-                {
-                // TODO better do this during a cycle
-                std::lock_guard<std::mutex> lock(m_recordingMutex);
-                if(m_recordingState == RecordingState::NONE) {
-                    logger.info() << "Start recording...";
-                    m_recordingState = RecordingState::SAVE;
-                    m_firstRecordSavingCycle = true;
+                    socket.writeMessage(summary);
+                    }
+                    break;
+                case C::kFilter:
+                    {
+                    RuntimeCommand command;
+                    command.type = RuntimeCommand::SET_LOG_LEVEL;
+                    command.level = static_cast<logging::Level>(message.runtime().filter().log_level());
+                    if(! m_commands.push(std::move(command))) {
+                        logger.error() << "Command queue is full, dropped log filter";
+                    }
+                    }
+                    break;
+                case C::kStartRecording:
+                    {
+                    if(loading || recording) {
+                        logger.error() << "Can't start recording.";
+                        break;
+                    }
+                    RuntimeCommand command;
+                    command.type = RuntimeCommand::START_RECORDING;
                     const auto &channels = message.runtime().start_recording().channels();
-                    std::string path = homepath() + "/lmslogs/temp";
-                    ::mkdir(path.c_str(), MODE);
+                    std::string basePath = homepath() + "/lmslogs";
+                    ::mkdir(basePath.c_str(), MODE);
+                    // unique per recording, an earlier recording may still
+                    // be moved to its final name by the cycle thread
+                    std::string pattern = basePath + "/temp-XXXXXX";
+                    std::vector<char> buffer(pattern.begin(), pattern.end());
+                    buffer.push_back('\0');
+                    if(::mkdtemp(buffer.data()) == nullptr) {
+                        logger.error() << "Can't start recording, could not create "
+                                       << pattern << ": " << strerror(errno);
+                        break;
+                    }
+                    std::string path = buffer.data();
+                    // mkdtemp() creates it with 0700
+                    ::chmod(path.c_str(), MODE);
                     for(int i = 0; i < channels.size(); i++) {
-                        std::fstream &stream = m_recordingStreams[channels.Get(i)];
+                        std::fstream &stream = command.streams[channels.Get(i)];
                         stream.open(path + "/" + channels.Get(i), std::fstream::out);
                     }
-                } else {
-                    logger.error() << "Can't start recording.";
-                }
-                }
-                break;
-            case C::kStopRecording:
-                {
-                // TODO better do this during a cycle
-                std::lock_guard<std::mutex> lock(m_recordingMutex);
-                if(m_recordingState == RecordingState::SAVE) {
-                    for(auto &stream : m_recordingStreams) {
-                        stream.second.close();
+                    command.metaFile.reset(new std::ofstream(path + "/__meta"));
+                    if(m_commands.push(std::move(command))) {
+                        recording = true;
+                        recordingPath = path;
+                    } else {
+                        logger.error() << "Command queue is full, can't start recording.";
                     }
-                    std::string oldPath = homepath() + "/lmslogs/temp";
-                    std::string newPath = homepath() + "/lmslogs/" + message.runtime().stop_recording().tag();
-                    ::rename(oldPath.c_str(), newPath.c_str());
-                    m_recordingState = NONE;
-                } else {
-                    logger.error() << "Can't stop recording";
-                }
+                    }
+                    break;
+                case C::kStopRecording:
+                    {
+                    if(! recording) {
+                        logger.error() << "Can't stop recording";
+                        break;
+                    }
+                    RuntimeCommand command;
+                    command.type = RuntimeCommand::STOP_RECORDING;
+                    command.tag = message.runtime().stop_recording().tag();
+                    command.path = recordingPath;
+                    if(m_commands.push(std::move(command))) {
+                        recording = false;
+                    } else {
+                        logger.error() << "Command queue is full, can't stop recording";
+                    }
+                    }
+                    break;
+                case C::kDumpFlightRecorder:
+                    if(m_flightRecorder.enabled()) {
+                        m_flightRecorder.requestDump(message.runtime().dump_flight_recorder().tag());
+                    } else {
+                        logger.error() << "Flight recorder is not enabled";
+                    }
+                    break;
+                case C::kChannelSubscribe:
+                    {
+                    const auto &subscribe = message.runtime().channel_subscribe();
+                    RuntimeCommand command;
+                    command.type = RuntimeCommand::SUBSCRIBE_CHANNELS;
+                    command.channels.assign(subscribe.channels().begin(),
+                                            subscribe.channels().end());
+                    if(subscribe.sample_rate() > 0) {
+                        command.interval = lms::Time::fromMicros(1000000 / subscribe.sample_rate());
+                    }
+                    if(! m_commands.push(std::move(command))) {
+                        logger.error() << "Command queue is full, dropped channel subscription";
+                    }
+                    }
+                    break;
+                case C::CONTENT_NOT_SET:
+                    break;
                 }
+            }
+            if(readRes != ProtobufSocket::OK) {
+                logger.error() << "Received invalid message via commSocket, closing it";
                 break;
             }
+        }
+    });
+}
 
+void Framework::sendSnapshots(ProtobufSocket &socket, lms::Response &response) {
+    std::unique_ptr<ChannelInspector::Snapshot> snapshot;
+    while(m_inspector.takeSnapshot(snapshot)) {
+        Response::ChannelSnapshot *message = response.mutable_channel_snapshot();
+        message->Clear();
+        message->set_cycle(snapshot->cycle);
+        message->set_timestamp(snapshot->timestamp.micros());
+        for(auto &channel : snapshot->channels) {
+            Response::ChannelSnapshot::Channel *ch = message->add_channels();
+            ch->set_name(channel.name);
+            ch->set_type(channel.type);
+            if(channel.serializable) {
+                // lend the buffer to the message instead of copying it
+                ch->mutable_data()->swap(channel.data);
+            }
+        }
+        socket.writeMessage(response);
 
-            /*std::lock_guard<std::mutex> lock(m_queueMutex);
-            m_queue.push_back(message);*/
-
-
+        // give the buffers back, they keep their capacity for the next sample
+        for(int i = 0; i < message->channels_size(); i++) {
+            if(snapshot->channels[i].serializable) {
+                message->mutable_channels(i)->mutable_data()->swap(snapshot->channels[i].data);
+            }
         }
-    });
+        m_inspector.release(std::move(snapshot));
+    }
 }
 
 void Framework::loadRecordings(const std::string &absPath, const std::vector<std::string> &channels) {
-    std::lock_guard<std::mutex> lock(m_recordingMutex);
     logger.info() << "Loading records from " << absPath;
     m_recordingState = RecordingState::LOAD;
     m_firstRecordLoadingCycle = true;
@@ -507,7 +1119,6 @@ void Framework::loadRecordings(const std::string &absPath, const std::vector<std
 }
 
 void Framework::initChannelTypes() {
-    std::lock_guard<std::mutex> lock(m_recordingMutex);
     if(m_recordingState == RecordingState::LOAD && m_firstRecordLoadingCycle) {
         m_firstRecordLoadingCycle = false;
         lms::MetaFile metaMessage;
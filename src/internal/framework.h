@@ -1,6 +1,9 @@
 #pragma once
 
+#include <set>
 #include <string>
+#include <tuple>
+#include <sys/types.h>
 #include <vector>
 
 #include "lms/datamanager.h"
@@ -13,7 +16,14 @@
 #include "file_monitor.h"
 #include "debug_server.h"
 #include "signalhandler.h"
+#include "flight_recorder.h"
+#include "channel_inspector.h"
+#include "lifecycle_scheduler.h"
+#include "runtime_diff.h"
+#include "spsc_queue.h"
+#include "lms/protobuf_socket.h"
 #include "messages.pb.h"
+#include "recording_meta.pb.h"
 
 namespace lms {
 namespace internal {
@@ -40,6 +50,12 @@ public:
 
     std::shared_ptr<Service> getService(std::string const &name);
 
+    /**
+     * @brief Mutex that serializes channel access of modules, which may be
+     * initialized in parallel.
+     */
+    std::mutex &channelMutex();
+
     bool isDebug() const;
     void setDebug(bool debug);
 
@@ -64,6 +80,18 @@ public:
     void start();
     void stop();
 
+    /**
+     * @brief Load the config and initialize all services and modules without
+     * executing a cycle, then compute the static schedule of the modules.
+     *
+     * Channel accesses that modules only make in cycle() are not part of the
+     * schedule.
+     *
+     * @return false if the config could not be loaded or the module graph
+     * has a cycle
+     */
+    bool dryRun(Schedule &schedule);
+
     DataManager& dataManager();
     ExecutionManager &executionManager();
 
@@ -74,12 +102,27 @@ public:
     void startCommunicationThread(int sock);
 
     void loadRecordings(const std::string &absPath, const std::vector<std::string> &channels);
+
+    /**
+     * @brief Messages sent with this command trigger a flight recorder dump at
+     * the end of the next cycle. The message content is used as tag.
+     */
+    static constexpr const char *DUMP_FLIGHT_RECORDER = "lms.dumpFlightRecorder";
 private:
+    bool loadConfig();
     bool updateSystem(const RuntimeInfo &info);
     void printOverview();
     void printModuleChannelGraph();
     void shutdown();
 
+    /**
+     * @brief Return true if a detached partition uses the channel, it must
+     * not be recorded, replayed or inspected by the cycle thread. Warns once
+     * per channel.
+     */
+    bool detachedChannel(const std::string &channel);
+    std::set<std::string> m_reportedDetachedChannels;
+
     ExecutionManager m_executionManager;
     DataManager m_dataManager;
     Clock m_clock;
@@ -94,10 +137,47 @@ private:
 
     bool m_running;
     bool is_debug;
+    bool m_dryRun = false;
 
     std::map<std::string, std::shared_ptr<Service>> services;
     std::map<std::string, std::shared_ptr<Module>> modules;
 
+    // parallel init()
+    int m_initThreads = 1;
+    // names in the order their init() finished, destroyed in reverse
+    std::mutex m_initOrderMutex;
+    std::vector<std::string> m_serviceInitOrder;
+    std::vector<std::string> m_moduleInitOrder;
+    std::map<std::string, std::vector<std::string>> m_serviceInitAfter;
+    std::map<std::string, std::vector<std::string>> m_moduleInitAfter;
+    std::mutex m_channelMutex;
+    bool initService(const ServiceInfo &info, std::shared_ptr<Service> &result);
+    bool initModule(const ModuleInfo &info, std::shared_ptr<Module> &result);
+    void addInitDependencies(LifeCycleScheduler &scheduler, const std::string &name,
+                             const std::vector<std::string> &initAfter);
+
+    // hot reload of modules whose lib changed on disk
+    typedef std::tuple<time_t, off_t, ino_t> FileSignature;
+    struct WatchedLibrary {
+        std::string path;
+        FileSignature signature;
+        // changed since the last check, reloaded once it is stable
+        bool changed = false;
+    };
+    static constexpr std::int64_t LIBRARY_CHECK_MILLIS = 500;
+    bool m_hotReload = false;
+    lms::Time m_nextLibraryCheck;
+    std::map<std::string, WatchedLibrary> m_watchedLibraries;
+    std::map<std::string, ModuleInfo> m_moduleInfos;
+    static FileSignature fileSignature(const std::string &path);
+    void watchLibraries(const RuntimeInfo &info);
+    void reloadChangedModules();
+    void reloadModule(const ModuleInfo &info);
+
+    // last applied config, updateSystem() only applies the differences
+    RuntimeInfo m_runtimeInfo;
+    void unloadModule(const std::string &name);
+
     std::string configPath;
     std::vector<std::string> flags;
 
@@ -108,22 +188,62 @@ private:
     bool m_isEnableSave = false;
 
     std::thread m_communicationThread;
-    std::mutex m_queueMutex;
-    std::list<lms::Request> m_queue;
 
-    // recording
+    /**
+     * @brief Control request from the communication thread that is applied
+     * by the cycle thread at the beginning of the next cycle.
+     *
+     * Everything that needs a syscall (opening files, creating directories)
+     * is prepared by the communication thread before the command is queued.
+     */
+    struct RuntimeCommand {
+        enum Type {
+            NONE, START_RECORDING, STOP_RECORDING, SET_LOG_LEVEL,
+            SUBSCRIBE_CHANNELS
+        };
+        Type type = NONE;
+        // START_RECORDING
+        std::map<std::string, std::fstream> streams;
+        std::unique_ptr<std::ofstream> metaFile;
+        // STOP_RECORDING
+        std::string tag;
+        // directory the recording was written to
+        std::string path;
+        // SET_LOG_LEVEL
+        logging::Level level = logging::Level::ALL;
+        // SUBSCRIBE_CHANNELS
+        std::vector<std::string> channels;
+        lms::Time interval;
+    };
+    // producer: communication thread, consumer: cycle thread
+    SpscQueue<RuntimeCommand> m_commands;
+    void applyCommands();
+
+    // recording, only accessed by the cycle thread after start()
     enum RecordingState {
         NONE, LOAD, SAVE
     };
-    std::mutex m_recordingMutex;
     RecordingState m_recordingState = NONE;
     bool m_firstRecordSavingCycle = false;
     std::map<std::string, std::fstream> m_recordingStreams;
+    std::unique_ptr<std::ofstream> m_recordingMetaFile;
     // modules that write into channels that were serialized
     std::set<std::string> m_ignoreModules;
     std::string m_absLoadPath;
     bool m_firstRecordLoadingCycle = false;
     void initChannelTypes();
+    void addChannelMeta(lms::MetaFile &meta, const std::string &channel);
+
+    // flight recorder
+    FlightRecorder m_flightRecorder;
+    void configureFlightRecorder(const RuntimeInfo &info);
+    void dumpFlightRecorder(std::string tag);
+    // precompute the dump of the SIGSEGV handler
+    void prepareCrashDump();
+
+    // live channel inspection, snapshots are sent by the communication thread
+    ChannelInspector m_inspector;
+    void sendSnapshots(ProtobufSocket &socket, lms::Response &response);
 };
 
 } // namespace internal
@@ -0,0 +1,101 @@
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "lifecycle_scheduler.h"
+
+namespace lms {
+namespace internal {
+
+void LifeCycleScheduler::add(const std::string &name, Task task,
+                             bool mainThread) {
+    m_tasks[name] = Entry{task, mainThread};
+    m_graph.node(name);
+}
+
+void LifeCycleScheduler::dependency(const std::string &name,
+                                    const std::string &dependsOn) {
+    m_graph.edge(dependsOn, name);
+}
+
+bool LifeCycleScheduler::has(const std::string &name) const {
+    return m_tasks.count(name) == 1;
+}
+
+bool LifeCycleScheduler::hasCycle() const { return m_graph.hasCycle(); }
+
+size_t LifeCycleScheduler::size() const { return m_tasks.size(); }
+
+bool LifeCycleScheduler::run(int numThreads) {
+    // drop dependencies to unknown tasks
+    DAG<std::string> graph;
+    for (const auto &node : m_graph) {
+        if (!has(node.first)) {
+            continue;
+        }
+        graph.node(node.first);
+        for (const auto &dependsOn : node.second) {
+            if (has(dependsOn)) {
+                graph.edge(dependsOn, node.first);
+            }
+        }
+    }
+    if (graph.hasCycle()) {
+        return false;
+    }
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::set<std::string> running;
+    bool success = true;
+
+    auto worker = [&](bool isMainThread) {
+        auto runnable = [&](const std::string &name) {
+            return running.count(name) == 0 &&
+                   (isMainThread || !m_tasks.at(name).mainThread);
+        };
+
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            std::string name;
+            cv.wait(lock, [&] {
+                return graph.empty() || !success ||
+                       graph.getFree(name, runnable);
+            });
+            if (graph.empty() || !success) {
+                return;
+            }
+
+            running.insert(name);
+            Task &task = m_tasks.at(name).task;
+            lock.unlock();
+            const bool result = task();
+            lock.lock();
+            running.erase(name);
+
+            if (result) {
+                graph.removeNode(name);
+                graph.removeEdgesFrom(name);
+            } else {
+                success = false;
+            }
+            cv.notify_all();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 1; i < numThreads && i < static_cast<int>(m_tasks.size());
+         i++) {
+        threads.emplace_back(worker, false);
+    }
+    worker(true);
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    return success;
+}
+
+}  // namespace internal
+}  // namespace lms
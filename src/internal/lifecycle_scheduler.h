@@ -0,0 +1,71 @@
+#ifndef LMS_INTERNAL_LIFECYCLE_SCHEDULER_H
+#define LMS_INTERNAL_LIFECYCLE_SCHEDULER_H
+
+#include <functional>
+#include <map>
+#include <string>
+
+#include "dag.h"
+
+namespace lms {
+namespace internal {
+
+/**
+ * @brief Run named tasks with dependencies between them on a pool of threads.
+ *
+ * Used to call init() of services and modules in parallel.
+ * A task is started as soon as all tasks it depends on have finished
+ * successfully. Tasks that were added with mainThread = true are only run by
+ * the thread that calls run().
+ */
+class LifeCycleScheduler {
+public:
+    typedef std::function<bool()> Task;
+
+    /**
+     * @brief Add a task. Replaces a task with the same name.
+     * @param task returns false on failure, must not throw
+     * @param mainThread run the task on the thread that calls run()
+     */
+    void add(const std::string &name, Task task, bool mainThread = false);
+
+    /**
+     * @brief Start a task only after another one has finished.
+     *
+     * Dependencies to tasks that were not added are ignored.
+     */
+    void dependency(const std::string &name, const std::string &dependsOn);
+
+    bool has(const std::string &name) const;
+
+    /**
+     * @brief Check if the dependencies contain a cycle.
+     */
+    bool hasCycle() const;
+
+    /**
+     * @brief Run all tasks and wait for them to finish.
+     *
+     * After the first failed task no further tasks are started, tasks that
+     * are already running are waited for.
+     *
+     * @param numThreads maximum number of tasks that run at the same time
+     * including the calling thread, 1 runs all tasks sequentially
+     * @return false if any task failed or the dependencies contain a cycle
+     */
+    bool run(int numThreads);
+
+    size_t size() const;
+private:
+    struct Entry {
+        Task task;
+        bool mainThread;
+    };
+    std::map<std::string, Entry> m_tasks;
+    DAG<std::string> m_graph;
+};
+
+}  // namespace internal
+}  // namespace lms
+
+#endif  // LMS_INTERNAL_LIFECYCLE_SCHEDULER_H
@@ -4,6 +4,9 @@
 #include <sys/stat.h>
 #endif
 
+#include <cstdlib>
+#include <fstream>
+
 #include "loader.h"
 #include "os.h"
 #include "lms/definitions.h"
@@ -13,11 +16,16 @@ namespace lms {
 namespace internal {
 
 bool Loader::exists(const std::string &fileName) {
-    std::ifstream infile(fileName);
-    return infile.good();
+    struct stat info;
+    return ::stat(fileName.c_str(), &info) == 0 && S_ISREG(info.st_mode);
 }
 
-void Loader::addSearchPath(std::string const &path) { m_paths.push_back(path); }
+void Loader::addSearchPath(std::string const &path) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_paths.push_back(path);
+    // libs that were not found may be found now
+    m_resolved.clear();
+}
 
 Module *Loader::loadModule(const ModuleInfo &info) {
     return static_cast<Module *>(
@@ -29,94 +37,135 @@ Service *Loader::loadService(const ServiceInfo &info) {
         load(info.lib, std::string("lms_service_") + info.clazz));
 }
 
-LifeCycle *Loader::load(const std::string &libname,
-                        const std::string &function) {
-#ifdef _WIN32
-
-    // TODO implementation for Win32
-    logger.error("load") << "Not implemented";
-    return nullptr;
-
-#endif
-    // for information on dlopen, dlsym, dlerror and dlclose
-    // see here: http://linux.die.net/man/3/dlclose
-
-    bool foundLib = false;
-    std::string libpath;
-
-    if (m_paths.size() == 0) {
-        logger.error("LMS_PATH") << "no path to modules given!";
+const std::string &Loader::findLibrary(const std::string &libname) {
+    auto it = m_resolved.find(libname);
+    if (it != m_resolved.end()) {
+        return it->second;
     }
 
+    std::string &libpath = m_resolved[libname];
     for (const std::string &path : m_paths) {
-        if (exists(libpath = path + "/lib" + libname + ".so")) {
-            foundLib = true;
+        if (exists(path + "/lib" + libname + ".so")) {
+            libpath = path + "/lib" + libname + ".so";
             break;
         }
 #if __APPLE__
-        if (exists(libpath = path + "/lib" + libname + ".dylib")) {
-            foundLib = true;
+        if (exists(path + "/lib" + libname + ".dylib")) {
+            libpath = path + "/lib" + libname + ".dylib";
             break;
         }
 #endif
     }
+    return libpath;
+}
 
-    if (!foundLib) {
-        for (const auto &path : m_paths) {
-            logger.debug("LMS_PATH") << path;
-        }
-        LMS_EXCEPTION(std::string("Could not find lib ") + libname);
+Loader::Library &Loader::openLibrary(const std::string &libpath) {
+    auto it = m_libraries.find(libpath);
+    if (it != m_libraries.end()) {
+        return it->second;
     }
 
+    // for information on dlopen, dlsym, dlerror and dlclose
+    // see here: http://linux.die.net/man/3/dlclose
+
     // open dynamic library (*.so file)
-    void *lib = dlopen(libpath.c_str(), RTLD_NOW);
+    void *handle = dlopen(libpath.c_str(), RTLD_NOW);
 
     // check for errors while opening
-    if (lib == NULL) {
+    if (handle == NULL) {
         LMS_EXCEPTION(std::string("Could not open dynamic lib ") + libpath +
                       ": " + dlerror());
     }
 
-    // clear error code
-    dlerror();
+    Library &lib = m_libraries[libpath];
+    lib.handle = handle;
+    return lib;
+}
 
-    UnionHack<void *, uint32_t (*)()> getLmsVersion;
-    getLmsVersion.src = dlsym(lib, "lms_version");
-    char *err;
-    if ((err = dlerror()) != NULL) {
-        logger.warn("load") << "Lib " << libpath
-                            << " does not provide lms_version()";
-    } else {
-        constexpr uint32_t MAJOR_MASK = LMS_VERSION(0xff, 0, 0);
-        constexpr uint32_t MINOR_MASK = LMS_VERSION(0, 0xff, 0);
-
-        uint32_t libVersion = getLmsVersion.target();
-
-        if ((libVersion & MAJOR_MASK) != (LMS_VERSION_CODE & MAJOR_MASK) ||
-            (LMS_VERSION_CODE & MINOR_MASK) < (libVersion & MINOR_MASK)) {
-
-            LMS_EXCEPTION(std::string("Lib ") + libpath + " has bad version. " +
-                          "LMS Version " + LMS_VERSION_STRING +
-                          ", Lib was compiled for " +
-                          versionCodeToString(libVersion));
-        }
+void *Loader::symbol(Library &lib, const std::string &name) {
+    auto it = lib.symbols.find(name);
+    if (it != lib.symbols.end()) {
+        return it->second;
     }
 
     // clear error code
     dlerror();
+    void *sym = dlsym(lib.handle, name.c_str());
+    if (dlerror() != NULL) {
+        sym = nullptr;
+    }
+    lib.symbols[name] = sym;
+    return sym;
+}
 
-    // get the pointer to a C-function with name 'lms_module_*' (or similar)
-    // that was declared inside the dynamic library
-    // Union-Hack to avoid a warning message
-    // We use it here to convert a void* to a function pointer.
-    // The function has this signature: void* function_name();
+LifeCycle *Loader::load(const std::string &libname,
+                        const std::string &function) {
+#ifdef _WIN32
+
+    // TODO implementation for Win32
+    logger.error("load") << "Not implemented";
+    return nullptr;
+
+#endif
     UnionHack<void *, LifeCycle *(*)()> conv;
-    conv.src = dlsym(lib, function.c_str());
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_paths.size() == 0) {
+            logger.error("LMS_PATH") << "no path to modules given!";
+        }
 
-    // check for errors while calling dlsym
-    if ((err = dlerror()) != NULL) {
-        LMS_EXCEPTION(std::string("Could not get symbol ") + function + ": " +
-                      err);
+        const std::string &libpath = findLibrary(libname);
+        if (libpath.empty()) {
+            for (const auto &path : m_paths) {
+                logger.debug("LMS_PATH") << path;
+            }
+            LMS_EXCEPTION(std::string("Could not find lib ") + libname);
+        }
+
+        Library &lib = openLibrary(libpath);
+
+        if (!lib.versionChecked) {
+            lib.versionChecked = true;
+
+            UnionHack<void *, uint32_t (*)()> getLmsVersion;
+            getLmsVersion.src = symbol(lib, "lms_version");
+            if (getLmsVersion.src == nullptr) {
+                logger.warn("load") << "Lib " << libpath
+                                    << " does not provide lms_version()";
+            } else {
+                constexpr uint32_t MAJOR_MASK = LMS_VERSION(0xff, 0, 0);
+                constexpr uint32_t MINOR_MASK = LMS_VERSION(0, 0xff, 0);
+
+                uint32_t libVersion = getLmsVersion.target();
+
+                if ((libVersion & MAJOR_MASK) != (LMS_VERSION_CODE & MAJOR_MASK) ||
+                    (LMS_VERSION_CODE & MINOR_MASK) < (libVersion & MINOR_MASK)) {
+                    lib.versionError = std::string("Lib ") + libpath +
+                                       " has bad version. " + "LMS Version " +
+                                       LMS_VERSION_STRING +
+                                       ", Lib was compiled for " +
+                                       versionCodeToString(libVersion);
+                }
+            }
+        }
+
+        if (!lib.versionError.empty()) {
+            LMS_EXCEPTION(lib.versionError);
+        }
+
+        // get the pointer to a C-function with name 'lms_module_*' (or similar)
+        // that was declared inside the dynamic library
+        // Union-Hack to avoid a warning message
+        // We use it here to convert a void* to a function pointer.
+        // The function has this signature: void* function_name();
+        conv.src = symbol(lib, function);
+
+        // check for errors while calling dlsym
+        if (conv.src == nullptr) {
+            LMS_EXCEPTION(std::string("Could not get symbol ") + function +
+                          " in " + libpath);
+        }
     }
 
     // call the interface function -> should return a newly created object
@@ -124,6 +173,7 @@ LifeCycle *Loader::load(const std::string &libname,
 }
 
 void Loader::registerLib(const std::string &lib) {
+    std::lock_guard<std::mutex> lock(m_mutex);
     bool found = false;
     for (const auto &l : m_libs) {
         if (l == lib) {
@@ -136,62 +186,77 @@ void Loader::registerLib(const std::string &lib) {
     }
 }
 
-std::shared_ptr<lms::DataChannelInternal>
-Loader::getChannel(lms::DataManager &dm, const std::string &name,
-                   const std::string &type) {
-    std::string libpath;
-    std::shared_ptr<lms::DataChannelInternal> channel;
+std::string Loader::libraryPath(const std::string &libname) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return findLibrary(libname);
+}
 
-    for (const std::string &path : m_paths) {
-        for (const auto &lib : m_libs) {
-            if (exists(libpath = path + "/lib" + lib + ".so")) {
-                channel = getChannelByLib(libpath, dm, name, type);
-                if (channel) {
-                    return channel;
-                }
-            }
-#if __APPLE__
-            if (exists(libpath = path + "/lib" + lib + ".dylib")) {
-                channel = getChannelByLib(libpath, dm, name, type);
-                if (channel) {
-                    return channel;
-                }
-            }
-#endif
-        }
-    }
+void Loader::reloadLibrary(const std::string &libname) {
+    std::lock_guard<std::mutex> lock(m_mutex);
 
-    return channel;
-}
+    const std::string &libpath = findLibrary(libname);
+    if (libpath.empty()) {
+        LMS_EXCEPTION(std::string("Could not find lib ") + libname);
+    }
 
-std::shared_ptr<lms::DataChannelInternal>
-Loader::getChannelByLib(const std::string &libpath, DataManager &dm,
-                        const std::string &name, const std::string &type) {
-    // open dynamic library (*.so file)
-    void *lib = dlopen(libpath.c_str(), RTLD_NOW);
+    const char *tmpdir = std::getenv("TMPDIR");
+    std::string copyPath = std::string(tmpdir ? tmpdir : "/tmp") + "/lms-" +
+                           std::to_string(getpid()) + "-" +
+                           std::to_string(++m_reloads) + "-lib" + libname +
+                           ".so";
+    {
+        std::ifstream src(libpath, std::ios::binary);
+        std::ofstream dst(copyPath, std::ios::binary | std::ios::trunc);
+        dst << src.rdbuf();
+        if (!src || !dst) {
+            ::unlink(copyPath.c_str());
+            LMS_EXCEPTION(std::string("Could not copy ") + libpath + " to " +
+                          copyPath);
+        }
+    }
 
-    // check for errors while opening
-    if (lib == NULL) {
+    void *handle = dlopen(copyPath.c_str(), RTLD_NOW);
+    // the mapping stays valid after the file is removed
+    ::unlink(copyPath.c_str());
+    if (handle == NULL) {
         LMS_EXCEPTION(std::string("Could not open dynamic lib ") + libpath +
                       ": " + dlerror());
     }
 
-    // clear error code
-    dlerror();
+    Library lib;
+    lib.handle = handle;
+    m_libraries[libpath] = lib;
+}
 
+std::shared_ptr<lms::DataChannelInternal>
+Loader::getChannel(lms::DataManager &dm, const std::string &name,
+                   const std::string &type) {
     using get_type = std::shared_ptr<lms::DataChannelInternal>(
         *)(lms::DataManager &dm, const std::string &name,
            const std::string &type);
-    UnionHack<void *, get_type> conv;
-    conv.src = dlsym(lib, "get_type");
 
-    char *err;
-    // check for errors while calling dlsym
-    if ((err = dlerror()) != NULL) {
-        return nullptr;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::shared_ptr<lms::DataChannelInternal> channel;
+
+    for (const auto &libname : m_libs) {
+        const std::string &libpath = findLibrary(libname);
+        if (libpath.empty()) {
+            continue;
+        }
+
+        UnionHack<void *, get_type> conv;
+        conv.src = symbol(openLibrary(libpath), "get_type");
+        if (conv.src == nullptr) {
+            continue;
+        }
+
+        channel = conv.target(dm, name, type);
+        if (channel) {
+            return channel;
+        }
     }
 
-    return conv.target(dm, name, type);
+    return channel;
 }
 
 }  // namespace internal
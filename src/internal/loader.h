@@ -1,6 +1,9 @@
 #ifndef LMS_LOADER_H
 #define LMS_LOADER_H
 
+#include <map>
+#include <mutex>
+
 #include "lms/logger.h"
 #include "xml_parser.h"
 #include "lms/module.h"
@@ -13,6 +16,13 @@ class Wrapper;
 /**
  * @brief Open so/dylib/dll files and load Module
  * or Service objects.
+ *
+ * Opened libraries are cached by path together with their version check
+ * and resolved symbols, so loading many modules from the same lib or
+ * reloading the config does not touch the filesystem or the dynamic linker
+ * again. Libraries are never closed.
+ *
+ * This class is thread-safe.
  */
 class Loader {
 public:
@@ -32,6 +42,25 @@ public:
 
     void registerLib(const std::string &lib);
 
+    /**
+     * @brief Path of the file that the lib is loaded from.
+     * @return empty if the lib was not found in the search paths
+     */
+    std::string libraryPath(const std::string &libname);
+
+    /**
+     * @brief Load a fresh copy of a lib that was changed on disk.
+     *
+     * The file is copied to a temporary location before it is opened,
+     * otherwise dlopen would return the already loaded lib. Instances that
+     * are created afterwards use the new code. The old copy stays loaded,
+     * because its code may still be referenced by data channels.
+     *
+     * Throws if the new copy can't be opened, the old one is kept in that
+     * case.
+     */
+    void reloadLibrary(const std::string &libname);
+
     /**
      * @brief Calls get_type in all registered libs.
      * @param dm Framework's current data manager instance
@@ -44,16 +73,33 @@ public:
                const std::string &type);
 
 private:
+    struct Library {
+        void *handle = nullptr;
+        bool versionChecked = false;
+        // empty if the version is compatible
+        std::string versionError;
+        // resolved symbols, nullptr if not available
+        std::map<std::string, void *> symbols;
+    };
+
     /**
-     * @brief Open a so/dylib/dll file and load the wrapper with an instance.
-     * @param wrapper Wrapper object to load
-     * @return true if successful, false otherwise
+     * @brief Open a so/dylib/dll file and call the given factory function.
+     * @return newly created instance
      */
     LifeCycle *load(const std::string &libname, const std::string &function);
 
-    std::shared_ptr<lms::DataChannelInternal>
-    getChannelByLib(const std::string &libpath, lms::DataManager &dm,
-                    const std::string &name, const std::string &type);
+    /**
+     * @brief Search the lib in all search paths, the result is memoized.
+     * @return path to the lib, empty if not found
+     */
+    const std::string &findLibrary(const std::string &libname);
+
+    /**
+     * @brief Open the lib at the given path or return the cached handle.
+     */
+    Library &openLibrary(const std::string &libpath);
+
+    void *symbol(Library &lib, const std::string &name);
 
     bool exists(const std::string &fileName);
 
@@ -77,6 +123,13 @@ private:
     logging::Logger logger;
     std::vector<std::string> m_paths;
     std::vector<std::string> m_libs;
+
+    std::mutex m_mutex;
+    // lib name -> path, empty if not found
+    std::map<std::string, std::string> m_resolved;
+    // path -> opened lib
+    std::map<std::string, Library> m_libraries;
+    int m_reloads = 0;
 };
 
 }  // namespace internal
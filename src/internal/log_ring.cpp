@@ -0,0 +1,180 @@
+#include <sys/mman.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <new>
+
+#include "log_ring.h"
+
+namespace lms {
+namespace internal {
+
+namespace {
+
+/**
+ * @brief Fixed part of a record, follows the commit word and is followed by
+ * tag and text.
+ */
+struct RecordHeader {
+    logging::Level level;
+    std::uint16_t tagSize;
+    std::uint32_t textSize;
+    std::int64_t timestamp;
+};
+
+// records start at multiples of 8, so the commit word never wraps
+constexpr size_t ALIGN = 8;
+constexpr size_t COMMIT_SIZE = sizeof(std::uint64_t);
+
+size_t align(size_t size) {
+    return (size + ALIGN - 1) / ALIGN * ALIGN;
+}
+
+}  // namespace
+
+constexpr size_t LogRing::DEFAULT_CAPACITY;
+
+LogRing::LogRing(size_t capacity)
+    : m_header(nullptr), m_data(nullptr), m_capacity(align(capacity)),
+      m_mapSize(sizeof(Header) + m_capacity), m_eventFd(-1) {
+    void *map = mmap(nullptr, m_mapSize, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if(map == MAP_FAILED) {
+        return;
+    }
+    // anonymous mappings are zeroed, so no record is committed yet
+    m_header = new (map) Header();
+    m_data = static_cast<char *>(map) + sizeof(Header);
+    m_eventFd = eventfd(0, EFD_NONBLOCK);
+}
+
+LogRing::~LogRing() {
+    if(m_header != nullptr) {
+        m_header->~Header();
+        munmap(m_header, m_mapSize);
+    }
+    closeEventFd();
+}
+
+bool LogRing::valid() const {
+    return m_header != nullptr && m_eventFd != -1;
+}
+
+bool LogRing::push(logging::Level level, std::int64_t timestamp,
+                   const std::string &tag, const std::string &text) {
+    const size_t size = align(COMMIT_SIZE + sizeof(RecordHeader) + tag.size() + text.size());
+    if(size > m_capacity || tag.size() > std::numeric_limits<std::uint16_t>::max()) {
+        m_header->dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // reserve space
+    std::uint64_t pos = m_header->write.load(std::memory_order_relaxed);
+    do {
+        // acquire: the consumer cleared everything before the read position
+        if(pos + size - m_header->read.load(std::memory_order_acquire) > m_capacity) {
+            m_header->dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    } while(! m_header->write.compare_exchange_weak(pos, pos + size,
+                                                    std::memory_order_relaxed));
+
+    RecordHeader header;
+    memset(&header, 0, sizeof(header));
+    header.level = level;
+    header.tagSize = tag.size();
+    header.textSize = text.size();
+    header.timestamp = timestamp;
+    copyIn(pos + COMMIT_SIZE, &header, sizeof(header));
+    copyIn(pos + COMMIT_SIZE + sizeof(header), tag.data(), tag.size());
+    copyIn(pos + COMMIT_SIZE + sizeof(header) + tag.size(), text.data(), text.size());
+
+    // the commit store and the sleeping load must not be reordered, see sleep()
+    auto *commit = reinterpret_cast<std::atomic<std::uint64_t> *>(m_data + pos % m_capacity);
+    commit->store(size, std::memory_order_seq_cst);
+    if(m_header->sleeping.load(std::memory_order_seq_cst) != 0 &&
+            m_header->sleeping.exchange(0) != 0) {
+        wakeup();
+    }
+    return true;
+}
+
+bool LogRing::pop(Record &record) {
+    const std::uint64_t pos = m_header->read.load(std::memory_order_relaxed);
+    auto *commit = reinterpret_cast<std::atomic<std::uint64_t> *>(m_data + pos % m_capacity);
+    const std::uint64_t size = commit->load(std::memory_order_acquire);
+    if(size == 0) {
+        return false;
+    }
+
+    RecordHeader header;
+    copyOut(pos + COMMIT_SIZE, &header, sizeof(header));
+    record.level = header.level;
+    record.timestamp = header.timestamp;
+    record.tag.resize(header.tagSize);
+    copyOut(pos + COMMIT_SIZE + sizeof(header), &record.tag[0], header.tagSize);
+    record.text.resize(header.textSize);
+    copyOut(pos + COMMIT_SIZE + sizeof(header) + header.tagSize, &record.text[0],
+            header.textSize);
+
+    // stale bytes must never look like a committed record in the next round
+    commit->store(0, std::memory_order_relaxed);
+    const size_t offset = (pos + COMMIT_SIZE) % m_capacity;
+    const size_t first = std::min<size_t>(size - COMMIT_SIZE, m_capacity - offset);
+    memset(m_data + offset, 0, first);
+    memset(m_data, 0, size - COMMIT_SIZE - first);
+
+    m_header->read.store(pos + size, std::memory_order_release);
+    return true;
+}
+
+bool LogRing::sleep() {
+    m_header->sleeping.store(1, std::memory_order_seq_cst);
+    const std::uint64_t pos = m_header->read.load(std::memory_order_relaxed);
+    auto *commit = reinterpret_cast<std::atomic<std::uint64_t> *>(m_data + pos % m_capacity);
+    return commit->load(std::memory_order_seq_cst) == 0;
+}
+
+void LogRing::clearWakeup() {
+    eventfd_t value;
+    eventfd_read(m_eventFd, &value);
+}
+
+void LogRing::wakeup() {
+    eventfd_write(m_eventFd, 1);
+}
+
+std::uint64_t LogRing::takeDropped() {
+    return m_header->dropped.exchange(0, std::memory_order_relaxed);
+}
+
+int LogRing::eventFd() const {
+    return m_eventFd;
+}
+
+void LogRing::closeEventFd() {
+    if(m_eventFd != -1) {
+        ::close(m_eventFd);
+        m_eventFd = -1;
+    }
+}
+
+void LogRing::copyIn(std::uint64_t pos, const void *src, size_t size) {
+    const size_t offset = pos % m_capacity;
+    const size_t first = std::min(size, m_capacity - offset);
+    memcpy(m_data + offset, src, first);
+    memcpy(m_data, static_cast<const char *>(src) + first, size - first);
+}
+
+void LogRing::copyOut(std::uint64_t pos, void *dst, size_t size) const {
+    const size_t offset = pos % m_capacity;
+    const size_t first = std::min(size, m_capacity - offset);
+    memcpy(dst, m_data + offset, first);
+    memcpy(static_cast<char *>(dst) + first, m_data, size - first);
+}
+
+}  // namespace internal
+}  // namespace lms
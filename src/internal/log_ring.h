@@ -0,0 +1,125 @@
+#ifndef LMS_INTERNAL_LOG_RING_H
+#define LMS_INTERNAL_LOG_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "lms/logging/level.h"
+
+namespace lms {
+namespace internal {
+
+/**
+ * @brief Multi-producer single-consumer ring of log records in shared memory.
+ *
+ * The master creates one ring per runtime before forking. Threads of the
+ * runtime push records without any system call, the master pops them after
+ * it was woken up through eventFd().
+ *
+ * Producers reserve space with a CAS on the write position, copy the record
+ * and mark it committed. A full ring never blocks a producer, the record is
+ * counted as dropped instead.
+ *
+ * The consumer only sleeps after calling sleep(). Producers write to the
+ * eventfd only if the consumer is sleeping, so a busy ring costs no system
+ * calls at all.
+ */
+class LogRing {
+public:
+    /**
+     * @brief Log record returned by pop(). The strings keep their capacity
+     * if the record is reused.
+     */
+    struct Record {
+        logging::Level level;
+        std::int64_t timestamp;
+        std::string tag;
+        std::string text;
+    };
+
+    static constexpr size_t DEFAULT_CAPACITY = 1024 * 1024;
+
+    /**
+     * @brief Map an anonymous shared ring and create its eventfd. Must be
+     * called before fork() to be shared with the child.
+     * @param capacity size of the data area in bytes
+     */
+    explicit LogRing(size_t capacity = DEFAULT_CAPACITY);
+    ~LogRing();
+
+    LogRing(const LogRing &) = delete;
+    LogRing &operator=(const LogRing &) = delete;
+
+    /**
+     * @brief Check if mapping the ring and creating the eventfd succeeded.
+     */
+    bool valid() const;
+
+    /**
+     * @brief Append a record. Safe to call from any thread of the producing
+     * process.
+     * @return false if the ring is full and the record was dropped
+     */
+    bool push(logging::Level level, std::int64_t timestamp,
+              const std::string &tag, const std::string &text);
+
+    /**
+     * @brief Remove the oldest committed record. Consumer only.
+     * @return false if there is no committed record
+     */
+    bool pop(Record &record);
+
+    /**
+     * @brief Ask producers to wake up the consumer through the eventfd.
+     * Consumer only.
+     * @return false if records arrived meanwhile, the consumer should pop
+     * them instead of waiting
+     */
+    bool sleep();
+
+    /**
+     * @brief Reset the eventfd after it became readable. Consumer only.
+     */
+    void clearWakeup();
+
+    /**
+     * @brief Make the eventfd readable.
+     */
+    void wakeup();
+
+    /**
+     * @brief Return and reset the number of dropped records. Consumer only.
+     */
+    std::uint64_t takeDropped();
+
+    int eventFd() const;
+
+    /**
+     * @brief Close the eventfd in a process that does not use the ring.
+     */
+    void closeEventFd();
+
+private:
+    struct Header {
+        alignas(64) std::atomic<std::uint64_t> write;
+        alignas(64) std::atomic<std::uint64_t> read;
+        alignas(64) std::atomic<std::uint32_t> sleeping;
+        std::atomic<std::uint64_t> dropped;
+    };
+
+    Header *m_header;
+    char *m_data;
+    size_t m_capacity;
+    size_t m_mapSize;
+    int m_eventFd;
+
+    void copyIn(std::uint64_t pos, const void *src, size_t size);
+    void copyOut(std::uint64_t pos, void *dst, size_t size) const;
+};
+
+}  // namespace internal
+}  // namespace lms
+
+#endif  // LMS_INTERNAL_LOG_RING_H
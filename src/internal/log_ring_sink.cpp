@@ -0,0 +1,17 @@
+#include "log_ring_sink.h"
+
+namespace lms {
+namespace internal {
+
+LogRingSink::LogRingSink(LogRing &ring, logging::Level level)
+    : ring(ring), level(level) {}
+
+void LogRingSink::sink(const lms::logging::Event &message) {
+    if(message.level < level) return;
+
+    ring.push(message.level, message.timestamp.micros(), message.tag,
+              message.messageText());
+}
+
+}  // namespace internal
+}  // namespace lms
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "lms/logging/sink.h"
+#include "lms/logging/event.h"
+#include "log_ring.h"
+
+namespace lms {
+namespace internal {
+
+/**
+ * @brief Sink that passes log events of a runtime to the master through a
+ * shared LogRing.
+ *
+ * Sinking an event copies it into the ring and never blocks. If the master
+ * does not keep up, events are dropped and the master reports how many.
+ */
+class LogRingSink : public lms::logging::Sink {
+public:
+    LogRingSink(LogRing &ring, logging::Level level);
+
+    void sink(const lms::logging::Event &message) override;
+private:
+    LogRing &ring;
+    logging::Level level;
+};
+
+}  // namespace internal
+}  // namespace lms
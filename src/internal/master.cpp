@@ -3,6 +3,7 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <sys/wait.h>
+#include <sys/epoll.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
 #include <csignal>
@@ -12,10 +13,12 @@
 #include <iostream>
 #include <cmath>
 #include <termios.h>
+#include <fstream>
+#include <cerrno>
 
 #include "messages.pb.h"
 #include "lms/protobuf_socket.h"
-#include "protobuf_sink.h"
+#include "log_ring_sink.h"
 
 #include "master.h"
 #include "lms/exception.h"
@@ -23,9 +26,11 @@
 #include "string.h"
 #include "tclap/CmdLine.h"
 #include "framework.h"
+#include "schedule.h"
 #include "colors.h"
 #include "lms/client.h"
 #include "os.h"
+#include "backtrace_formatter.h"
 
 
 namespace lms {
@@ -59,12 +64,52 @@ void enableReuseAddr(int sock) {
     }
 }
 
+/**
+ * @brief Copy the events of a batch that pass the given level into a new
+ * frame.
+ */
+ProtobufSocket::SharedFrame filterLogEvents(const Response &response,
+                                            logging::Level level) {
+    Response filtered;
+    Response::LogEventBatch *batch = filtered.mutable_log_event_batch();
+    for(const auto &event : response.log_event_batch().events()) {
+        if(static_cast<logging::Level>(event.level()) >= level) {
+            *batch->add_events() = event;
+        }
+    }
+    batch->set_min_level(static_cast<Response::LogEvent::Level>(level));
+    batch->set_max_level(response.log_event_batch().max_level());
+
+    std::string data;
+    filtered.SerializeToString(&data);
+    return ProtobufSocket::makeFrame(data.data(), data.size());
+}
+
+MasterServer::Connection::Connection(int fd)
+    : sock(fd), waitWritable(false) {}
+
 MasterServer::Client::Client(int fd, const std::string &peer)
-    : sock(fd), peer(peer), isAttached(false) {}
+    : conn(fd), peer(peer), isAttached(false) {}
 
 MasterServer::Server::Server(int fd) : fd(fd) {}
 
-MasterServer::MasterServer() : m_running(true) {}
+MasterServer::Runtime::Runtime(const std::string &name, pid_t pid,
+                               std::unique_ptr<LogRing> log, int commFd,
+                               const std::string &config_file)
+    : name(name), pid(pid), log(std::move(log)), comm(commFd), config_file(config_file) {}
+
+constexpr size_t MasterServer::MAX_CLIENT_BACKLOG;
+constexpr int MasterServer::MAX_LOG_EVENTS_PER_WAKEUP;
+
+MasterServer::MasterServer() : m_running(true), m_epoll(epoll_create1(0)) {
+    if(m_epoll == -1) {
+        perror("epoll_create1");
+    }
+}
+
+MasterServer::~MasterServer() {
+    ::close(m_epoll);
+}
 
 int MasterServer::useUnix(const std::string &path) {
     int sockfd;
@@ -141,6 +186,45 @@ void rickGrimes(int signal) {
     }
 }
 
+void MasterServer::addToLoop(int fd) {
+    epoll_event event;
+    event.events = EPOLLIN;
+    event.data.fd = fd;
+    if(epoll_ctl(m_epoll, EPOLL_CTL_ADD, fd, &event) == -1) {
+        perror("epoll_ctl.ADD");
+    }
+}
+
+void MasterServer::removeFromLoop(int fd) {
+    // children share the epoll instance's file descriptors, so closing the
+    // socket is not enough to remove it from the interest list
+    epoll_ctl(m_epoll, EPOLL_CTL_DEL, fd, nullptr);
+}
+
+void MasterServer::send(Connection &conn, const google::protobuf::Message &message) {
+    conn.sock.enqueue(message);
+
+    // try to send right away, errors are handled by the reading side
+    if(!conn.waitWritable) {
+        flush(conn);
+    }
+}
+
+bool MasterServer::flush(Connection &conn) {
+    const bool ok = conn.sock.flush() == ProtobufSocket::OK;
+
+    // only wait for writability while something is queued
+    const bool waitWritable = ok && conn.sock.pending() > 0;
+    if(waitWritable != conn.waitWritable) {
+        epoll_event event;
+        event.events = waitWritable ? EPOLLIN | EPOLLOUT : EPOLLIN;
+        event.data.fd = conn.sock.getFD();
+        epoll_ctl(m_epoll, EPOLL_CTL_MOD, conn.sock.getFD(), &event);
+        conn.waitWritable = waitWritable;
+    }
+    return ok;
+}
+
 void MasterServer::start() {
     // Fix broken pipe behavior
     ::signal(SIGPIPE, SIG_IGN);
@@ -148,160 +232,294 @@ void MasterServer::start() {
     // Kill zombie child processes
     ::signal(SIGCHLD, rickGrimes);
 
-    fd_set fds;
+    for(const Server &server : m_servers) {
+        enableNonBlock(server.fd);
+        addToLoop(server.fd);
+    }
 
-    //save cout from master
-    //std::ofstream out("/tmp/master.txt",std::trunc);
-    //old buffer
-    //std::streambuf *coutbuf = std::cout.rdbuf();
-    //save it to file
-    //std::cout.rdbuf(out.rdbuf());
+    constexpr int MAX_EVENTS = 64;
+    epoll_event events[MAX_EVENTS];
 
     while (m_running) {
-        FD_ZERO(&fds);
-        int maxFD = 0;
-        for (const Server &server : m_servers) {
-            FD_SET(server.fd, &fds);
-            maxFD = std::max(maxFD, server.fd);
+        int ret = epoll_wait(m_epoll, events, MAX_EVENTS, -1);
+
+        if (ret == -1) {
+            if(errno == EINTR) {
+                // e.g. SIGCHLD
+                continue;
+            }
+            perror("epoll_wait");
+            break;
         }
-        for (const auto &client : m_clients) {
-            FD_SET(client.sock.getFD(), &fds);
-            maxFD = std::max(maxFD, client.sock.getFD());
+
+        for(int i = 0; i < ret && m_running; i++) {
+            const int fd = events[i].data.fd;
+
+            bool isServer = false;
+            for (const Server &server : m_servers) {
+                if(server.fd == fd) {
+                    acceptClients(server);
+                    isServer = true;
+                    break;
+                }
+            }
+            if(isServer) {
+                continue;
+            }
+
+            if(m_clients.find(fd) != m_clients.end()) {
+                handleClient(fd, events[i].events);
+                continue;
+            }
+
+            Runtime *runtime = getRuntimeByFd(fd);
+            if(runtime != nullptr) {
+                handleRuntime(*runtime, fd, events[i].events);
+            }
+
+            // otherwise the socket was closed by an earlier event
         }
-        for(const Runtime &runtime : m_runtimes) {
-            FD_SET(runtime.logSock.getFD(), &fds);
-            maxFD = std::max(runtime.logSock.getFD(), maxFD);
-            FD_SET(runtime.commSock.getFD(), &fds);
-            maxFD = std::max(runtime.commSock.getFD(), maxFD);
+    }
+
+    // graceful shutdown
+    for(const auto &rt : m_runtimes) {
+        std::cout << "Shutdown " << rt.pid << std::endl;
+        kill(rt.pid, SIGINT);
+    }
+}
+
+void MasterServer::acceptClients(const Server &server) {
+    while(true) {
+        sockaddr_storage peer;
+        socklen_t peerLen = sizeof peer;
+        int clientfd = accept(server.fd, (sockaddr *)&peer, &peerLen);
+        if(clientfd == -1) {
+            if(errno == EINTR) {
+                continue;
+            }
+            if(errno != EAGAIN && errno != EWOULDBLOCK) {
+                perror("accept");
+            }
+            break;
         }
 
-        timeval timeout;
-        timeout.tv_sec = 1;
-        timeout.tv_usec = 0;
+        std::cout << "New Client" << std::endl;
+        enableNonBlock(clientfd);
+        addToLoop(clientfd);
+        m_clients.emplace(clientfd, Client(clientfd, getPeer(peer)));
+
+        // push broadcast
+        lms::Response response;
+        buildListClientsResponse(response);
+        broadcastResponse(response);
+    }
+}
 
-        int ret = select(maxFD + 1, &fds, nullptr, nullptr, &timeout);
+void MasterServer::handleClient(int fd, std::uint32_t events) {
+    auto it = m_clients.find(fd);
+    Client &client = it->second;
 
-        if (ret == -1) {
-            // TODO error
-        }
-
-        for (const Server &server : m_servers) {
-            if (FD_ISSET(server.fd, &fds)) {
-                std::cout << "New Client" << std::endl;
-                sockaddr_storage peer;
-                socklen_t peerLen = sizeof peer;
-                int clientfd = accept(server.fd, (sockaddr *)&peer, &peerLen);
-                //enableNonBlock(clientfd);
-                m_clients.push_back(Client(clientfd, getPeer(peer)));
-
-                // push broadcast
-                lms::Response response;
-                buildListClientsResponse(response);
-                broadcastResponse(response);
-            }
-        }
-        for (auto it = m_clients.begin(); it != m_clients.end(); ++it) {
-            auto &client = *it;
-            if (FD_ISSET(client.sock.getFD(), &fds)) {
-                std::cout << "Client packet" << std::endl;
-
-                lms::Request req;
-                auto readRes = client.sock.readMessage(req);
-
-                if(readRes == ProtobufSocket::OK) {
-                    processClient(client, req);
-                } else {
-                    if(client.isAttached && client.shutdownRuntimeOnDetach) {
-                        std::cout << "Kill runtime " << client.attachedRuntime << " because client detached" << std::endl;
-                        kill(client.attachedRuntime, SIGINT);
-                    }
+    if(events & EPOLLOUT) {
+        if(!flush(client.conn)) {
+            closeClient(it);
+            return;
+        }
+    }
+
+    if(events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+        ProtobufSocket::Error readRes = client.conn.sock.receive();
+
+        lms::Request req;
+        // a message that can't be parsed drops the client like a read error
+        while(client.conn.sock.nextMessage(req, readRes)) {
+            processClient(client, req);
+        }
 
-                    // push broadcast
-                    lms::Response response;
-                    buildListClientsResponse(response);
-                    broadcastResponse(response);
+        if(readRes != ProtobufSocket::OK) {
+            closeClient(it);
+        }
+    }
+}
+
+void MasterServer::closeClient(std::map<int, Client>::iterator it) {
+    Client &client = it->second;
+    if(client.isAttached && client.shutdownRuntimeOnDetach) {
+        std::cout << "Kill runtime " << client.attachedRuntime << " because client detached" << std::endl;
+        kill(client.attachedRuntime, SIGINT);
+    }
+
+    pid_t rtPid = client.attachedRuntime;
+    bool wasAttached = client.isAttached;
 
-                    pid_t rtPid = client.attachedRuntime;
-                    bool wasAttached = client.isAttached;
+    removeFromLoop(client.conn.sock.getFD());
+    client.conn.sock.close();
+    m_clients.erase(it);
 
-                    client.sock.close();
-                    m_clients.erase(it);
-                    --it;
+    // push broadcast
+    lms::Response response;
+    buildListClientsResponse(response);
+    broadcastResponse(response);
 
-                    if(wasAttached) {
-                        Runtime *rt = getRuntimeByPid(rtPid);
-                        if(rt != nullptr && !isSomeoneAttached(rtPid)) {
-                            setLogLevel(rt->commSock, logging::Level::OFF);
-                        }
+    if(wasAttached) {
+        Runtime *rt = getRuntimeByPid(rtPid);
+        if(rt != nullptr && !isSomeoneAttached(rtPid)) {
+            setLogLevel(*rt, logging::Level::OFF);
+            unsubscribeChannels(*rt);
+        }
+    }
+}
+
+void MasterServer::handleRuntime(Runtime &runtime, int fd, std::uint32_t events) {
+    const pid_t pid = runtime.pid;
+
+    if(fd == runtime.comm.sock.getFD()) {
+        if(events & EPOLLOUT) {
+            flush(runtime.comm);
+        }
+        if(events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+            ProtobufSocket::Error readRes = runtime.comm.sock.receive();
+            Response response;
+            while(runtime.comm.sock.nextMessage(response, readRes)) {
+                std::cout << "Got message via commSocket from " << runtime.name << "\n";
+                for(auto &client : m_clients) {
+                    if(client.second.isAttached && client.second.attachedRuntime == pid) {
+                        send(client.second.conn, response);
                     }
                 }
             }
+            if(readRes != ProtobufSocket::OK) {
+                std::cout << "Could not read msg from runtime" << std::endl;
+                // the process exited, its last log events are in the ring
+                while(!forwardLogEvents(runtime, MAX_LOG_EVENTS_PER_WAKEUP)) {}
+                closeRuntime(pid);
+            }
         }
-        for(auto it = m_runtimes.begin(); it != m_runtimes.end(); ++it) {
-            auto &runtime = *it;
-            if(FD_ISSET(runtime.logSock.getFD(), &fds)) {
-                // forward log events to attached clients
-                Response response;
-                if(runtime.logSock.readMessage(response) == ProtobufSocket::OK) {
-                    for(auto &client : m_clients) {
-                        if(client.isAttached && client.attachedRuntime == runtime.pid) {
-                            if(!response.has_log_event()
-                                || static_cast<logging::Level>(response.log_event().level()) >= client.logLevel) {
-                                client.sock.writeMessage(response);
-                            }
-                        }
-                    }
-                } else {
-                    Response closeEvent;
-                    Response::LogEvent *event = closeEvent.mutable_log_event();
-                    event->set_level(Response::LogEvent::INFO);
-                    event->set_tag("master");
-                    event->set_text("Runtime stopped");
-                    event->set_close_after(true);
-                    for(auto &client : m_clients) {
-                        if(client.isAttached && client.attachedRuntime == runtime.pid) {
-                             client.sock.writeMessage(closeEvent);
-                        }
-                    }
+        return;
+    }
 
-                    // push broadcast
-                    lms::Response response;
-                    buildListRuntimesResponse(response);
-                    broadcastResponse(response);
-
-                    // close runtime connection
-                    runtime.logSock.close();
-                    runtime.commSock.close();
-                    m_runtimes.erase(it);
-                    it--;
-                    std::cout << "Could not read msg from runtime" << std::endl;
-                    //TODO error handling
-                }
+    // forward log events to attached clients
+    LogRing &ring = *runtime.log;
+    ring.clearWakeup();
+    if(!forwardLogEvents(runtime, MAX_LOG_EVENTS_PER_WAKEUP) || !ring.sleep()) {
+        // more events are waiting, let epoll report the ring again after the
+        // other connections were served
+        ring.wakeup();
+    }
+}
+
+bool MasterServer::forwardLogEvents(Runtime &runtime, int maxEvents) {
+    const pid_t pid = runtime.pid;
+    LogRing &ring = *runtime.log;
+
+    Response::LogEventBatch *batch = m_logBatch.mutable_log_event_batch();
+    batch->Clear();
+    logging::Level minLevel = logging::Level::OFF;
+    logging::Level maxLevel = logging::Level::ALL;
+    LogRing::Record record;
+    while(batch->events_size() < maxEvents && ring.pop(record)) {
+        Response::LogEvent *event = batch->add_events();
+        event->set_tag(record.tag);
+        event->set_level(static_cast<Response::LogEvent::Level>(record.level));
+        event->set_text(record.text);
+        event->set_timestamp(record.timestamp);
+        minLevel = std::min(minLevel, record.level);
+        maxLevel = std::max(maxLevel, record.level);
+    }
+    const bool drained = batch->events_size() < maxEvents;
+    batch->set_min_level(static_cast<Response::LogEvent::Level>(minLevel));
+    batch->set_max_level(static_cast<Response::LogEvent::Level>(maxLevel));
+
+    const std::uint64_t dropped = ring.takeDropped();
+    if(batch->events_size() == 0 && dropped == 0) {
+        return drained;
+    }
+
+    // serialized once and shared by all clients that get the whole batch
+    ProtobufSocket::SharedFrame shared;
+    std::map<logging::Level, ProtobufSocket::SharedFrame> filtered;
+
+    for(auto &it : m_clients) {
+        Client &client = it.second;
+        if(!client.isAttached || client.attachedRuntime != pid) {
+            continue;
+        }
+        client.droppedLogEvents += dropped;
+
+        if(batch->events_size() == 0 || maxLevel < client.logLevel) {
+            continue;
+        }
+        // backpressure: drop log events for clients that do not keep up
+        if(client.conn.sock.pending() > MAX_CLIENT_BACKLOG) {
+            client.droppedLogEvents += batch->events_size();
+            continue;
+        }
+        if(client.droppedLogEvents > 0) {
+            Response notice;
+            Response::LogEvent *event = notice.mutable_log_event();
+            event->set_level(Response::LogEvent::WARN);
+            event->set_tag("master");
+            event->set_text("Dropped " + std::to_string(client.droppedLogEvents)
+                            + " log events, runtime or client is too slow");
+            event->set_timestamp(lms::Time::now().micros());
+            client.conn.sock.enqueue(notice);
+            client.droppedLogEvents = 0;
+        }
+
+        if(minLevel >= client.logLevel) {
+            if(!shared) {
+                std::string data;
+                m_logBatch.SerializeToString(&data);
+                shared = ProtobufSocket::makeFrame(data.data(), data.size());
             }
-            if(FD_ISSET(runtime.commSock.getFD(), &fds)) {
-                Response response;
-                if(runtime.commSock.readMessage(response) == ProtobufSocket::OK) {
-                    std::cout << "Got message via commSocket from " << runtime.name << "\n";
-                    for(auto &client : m_clients) {
-                        if(client.isAttached && client.attachedRuntime == runtime.pid) {
-                            client.sock.writeMessage(response);
-                        }
-                    }
-                }
+            client.conn.sock.enqueue(shared);
+        } else {
+            // only some events of the batch pass the client's filter
+            ProtobufSocket::SharedFrame &part = filtered[client.logLevel];
+            if(!part) {
+                part = filterLogEvents(m_logBatch, client.logLevel);
             }
+            client.conn.sock.enqueue(part);
+        }
+        if(!client.conn.waitWritable) {
+            flush(client.conn);
         }
     }
+    return drained;
+}
 
-    // graceful shutdown
-    for(const auto &rt : m_runtimes) {
-        std::cout << "Shutdown " << rt.pid << std::endl;
-        kill(rt.pid, SIGINT);
+void MasterServer::closeRuntime(pid_t pid) {
+    Response closeEvent;
+    Response::LogEvent *event = closeEvent.mutable_log_event();
+    event->set_level(Response::LogEvent::INFO);
+    event->set_tag("master");
+    event->set_text("Runtime stopped");
+    event->set_close_after(true);
+    for(auto &client : m_clients) {
+        if(client.second.isAttached && client.second.attachedRuntime == pid) {
+            send(client.second.conn, closeEvent);
+        }
     }
+
+    // close runtime connection
+    for(auto it = m_runtimes.begin(); it != m_runtimes.end(); ++it) {
+        if(it->pid == pid) {
+            removeFromLoop(it->log->eventFd());
+            removeFromLoop(it->comm.sock.getFD());
+            it->comm.sock.close();
+            m_runtimes.erase(it);
+            break;
+        }
+    }
+
+    // push broadcast
+    lms::Response response;
+    buildListRuntimesResponse(response);
+    broadcastResponse(response);
 }
 
 bool MasterServer::isSomeoneAttached(pid_t id) {
     for(const auto &cl : m_clients) {
-        if(cl.isAttached && cl.attachedRuntime == id) {
+        if(cl.second.isAttached && cl.second.attachedRuntime == id) {
             return true;
         }
     }
@@ -310,8 +528,8 @@ bool MasterServer::isSomeoneAttached(pid_t id) {
 
 void MasterServer::broadcastResponse(const Response &response) {
     for(auto &client : m_clients) {
-        if(client.listenBroadcats) {
-            client.sock.writeMessage(response);
+        if(client.second.listenBroadcats) {
+            send(client.second.conn, response);
         }
     }
 }
@@ -330,8 +548,8 @@ void MasterServer::buildListClientsResponse(lms::Response &response) {
     auto list = response.mutable_client_list();
     for (const auto &cl : m_clients) {
         auto client = list->add_clients();
-        client->set_fd(cl.sock.getFD());
-        client->set_peer(cl.peer);
+        client->set_fd(cl.first);
+        client->set_peer(cl.second.peer);
     }
 }
 
@@ -378,7 +596,7 @@ void MasterServer::processClient(Client &client, const lms::Request &message) {
             client.attachedRuntime = rt->pid;
             client.shutdownRuntimeOnDetach = false;
             client.logLevel = static_cast<logging::Level>(message.attach().log_level());
-            setLogLevel(rt->commSock, logging::Level::ALL);
+            setLogLevel(*rt, logging::Level::ALL);
         }
         }
         break;
@@ -410,7 +628,7 @@ void MasterServer::processClient(Client &client, const lms::Request &message) {
             client.attachedRuntime = rt->pid;
             client.shutdownRuntimeOnDetach = false;
             client.logLevel = logging::Level::OFF;
-            rt->commSock.writeMessage(message);
+            send(rt->comm, message);
             sendResponse = false;
         }
         }
@@ -429,7 +647,8 @@ void MasterServer::processClient(Client &client, const lms::Request &message) {
         if(wasAttached) {
             Runtime *rt = getRuntimeByPid(rtPid);
             if(rt != nullptr && !isSomeoneAttached(rtPid)) {
-                setLogLevel(rt->commSock, logging::Level::OFF);
+                setLogLevel(*rt, logging::Level::OFF);
+                unsubscribeChannels(*rt);
             }
         }
         }
@@ -439,7 +658,7 @@ void MasterServer::processClient(Client &client, const lms::Request &message) {
         if(client.isAttached) {
             Runtime *rt = getRuntimeByPid(client.attachedRuntime);
             if(rt != nullptr) {
-                rt->commSock.writeMessage(message);
+                send(rt->comm, message);
                 sendResponse = false;
             }
         }
@@ -448,7 +667,7 @@ void MasterServer::processClient(Client &client, const lms::Request &message) {
     }
 
     if(sendResponse) {
-        client.sock.writeMessage(response);
+        send(client.conn, response);
     }
 
     /*} else if (message == "tcpip") {
@@ -471,18 +690,30 @@ void MasterServer::processClient(Client &client, const lms::Request &message) {
     }*/
 }
 
-void setLogLevel(ProtobufSocket &sock, logging::Level level) {
+void MasterServer::setLogLevel(Runtime &runtime, logging::Level level) {
     lms::Request req;
     req.mutable_runtime()->mutable_filter()->set_log_level(
                 static_cast<Response::LogEvent::Level>(level));
-    sock.writeMessage(req);
+    send(runtime.comm, req);
+}
+
+void MasterServer::unsubscribeChannels(Runtime &runtime) {
+    lms::Request req;
+    req.mutable_runtime()->mutable_channel_subscribe();
+    send(runtime.comm, req);
 }
 
 void MasterServer::runFramework(Client &client, const Request_Run &options) {
     pid_t childpid;
-    int logFd[2];
     int commFd[2];
-    socketpair(AF_UNIX, SOCK_STREAM, 0, logFd); // used in the logger
+    // shared with the logger of the runtime
+    std::unique_ptr<LogRing> logRing(new LogRing());
+    if(!logRing->valid()) {
+        perror("log ring");
+        return;
+    }
+    // wake up the master for the first event
+    logRing->sleep();
     socketpair(AF_UNIX, SOCK_STREAM, 0, commFd); // used in communication thread of the framework
 
     // FORK
@@ -495,12 +726,25 @@ void MasterServer::runFramework(Client &client, const Request_Run &options) {
         // init framework
 
         // close other end of socket
-        close(logFd[0]);
         close(commFd[0]);
 
+        // close sockets inherited from the master, otherwise clients and
+        // other runtimes would not notice when the master closes them
+        ::close(m_epoll);
+        for(const auto &server : m_servers) {
+            ::close(server.fd);
+        }
+        for(const auto &cl : m_clients) {
+            ::close(cl.first);
+        }
+        for(const auto &rt : m_runtimes) {
+            rt.log->closeEventFd();
+            ::close(rt.comm.sock.getFD());
+        }
+
         logging::Context &ctx = logging::Context::getDefault();
         logging::Level logLevel = options.production() ? logging::Level::WARN : logging::Level::ALL;
-        ctx.appendSink(new ProtobufSink(logFd[1], logLevel));
+        ctx.appendSink(new LogRingSink(*logRing, logLevel));
         ctx.hookStdoutAndStderr();
 
         if(options.detached()) {
@@ -533,17 +777,21 @@ void MasterServer::runFramework(Client &client, const Request_Run &options) {
             fw.loadRecordings(options.load_path(), channels);
         }
 
+        // the SIGSEGV handler must not allocate
+        loadStacktrace();
         SignalHandler::getInstance().addListener(SIGSEGV, &fw);
         SignalHandler::getInstance().addListener(SIGINT, &fw);
+        SignalHandler::getInstance().addListener(SIGUSR2, &fw);
 
         fw.startCommunicationThread(commFd[1]);
         fw.start();
+        // write out buffered log events before the process exits
+        logging::Context::getDefault().flush();
         exit(0);
     } else {
         // master server
 
         // close writing ends of pipes
-        close(logFd[1]);
         close(commFd[1]);
 
         std::string name;
@@ -552,7 +800,9 @@ void MasterServer::runFramework(Client &client, const Request_Run &options) {
         } else {
             name = std::to_string(runtimeNameCounter++);
         }
-        Runtime rt{name, childpid, logFd[0], commFd[0], options.config_file()};
+        enableNonBlock(commFd[0]);
+        addToLoop(logRing->eventFd());
+        addToLoop(commFd[0]);
         if(! options.detached()) {
             client.isAttached = true;
             client.attachedRuntime = childpid;
@@ -561,7 +811,8 @@ void MasterServer::runFramework(Client &client, const Request_Run &options) {
                     && options.shutdown_runtime_on_detach();
 
         }
-        m_runtimes.push_back(rt);
+        m_runtimes.emplace_back(name, childpid, std::move(logRing), commFd[0],
+                                options.config_file());
     }
 }
 
@@ -574,6 +825,15 @@ MasterServer::Runtime* MasterServer::getRuntimeByPid(pid_t id) {
     return nullptr;
 }
 
+MasterServer::Runtime* MasterServer::getRuntimeByFd(int fd) {
+    for(auto &rt : m_runtimes) {
+        if(rt.log->eventFd() == fd || rt.comm.sock.getFD() == fd) {
+            return &rt;
+        }
+    }
+    return nullptr;
+}
+
 MasterServer::Runtime* MasterServer::getRuntimeByName(const std::string &name) {
     for(auto &rt : m_runtimes) {
         if(rt.name == name) {
@@ -583,6 +843,58 @@ MasterServer::Runtime* MasterServer::getRuntimeByName(const std::string &name) {
     return nullptr;
 }
 
+/**
+ * @brief Print a log event received from the master.
+ * @return true if the client should stop streaming logs
+ */
+bool printLogEvent(const Response::LogEvent &event) {
+    // get time now
+    time_t rawtime = event.timestamp() / 1000 / 1000;
+    //std::time(&rawtime);
+    struct tm *now = std::localtime(&rawtime);
+
+    // format time to "HH:MM:SS"
+    char buffer[10];
+    std::strftime(buffer, 10, "%T", now);
+
+    std::cout << buffer << " ";
+
+    std::cout << lms::logging::levelColor(static_cast<lms::logging::Level>(event.level()));
+    std::cout << lms::logging::levelName(static_cast<lms::logging::Level>(event.level())) << " " << event.tag();
+    std::cout << lms::internal::COLOR_WHITE;
+    std::cout << " " << event.text() << std::endl;
+
+    return event.has_close_after() && event.close_after();
+}
+
+/**
+ * @brief Print size and the first bytes of every channel in a snapshot.
+ */
+void printChannelSnapshot(const Response::ChannelSnapshot &snapshot) {
+    constexpr int PREVIEW_BYTES = 16;
+    std::cout << COLOR_GREEN << "cycle " << snapshot.cycle() << COLOR_WHITE << "\n";
+    for(const auto &channel : snapshot.channels()) {
+        std::cout << "  " << channel.name() << " (" << channel.type() << ") ";
+        if(!channel.has_data()) {
+            std::cout << "not serializable\n";
+            continue;
+        }
+        std::cout << channel.data().size() << " bytes";
+        char hex[4];
+        const int preview = std::min<int>(channel.data().size(), PREVIEW_BYTES);
+        for(int i = 0; i < preview; i++) {
+            snprintf(hex, sizeof(hex), " %02x",
+                     static_cast<unsigned char>(channel.data()[i]));
+            std::cout << hex;
+        }
+        if(static_cast<int>(channel.data().size()) > preview) {
+            std::cout << " ...";
+        }
+        std::cout << "\n";
+    }
+    std::cout << std::flush;
+}
+
 void streamLogs(ProtobufSocket &socket) {
     Response response;
     fd_set fds;
@@ -626,26 +938,18 @@ void streamLogs(ProtobufSocket &socket) {
                 break;
             }
 
-            if(!response.has_log_event()) continue;
-
-            const auto &event = response.log_event();
-            // get time now
-            time_t rawtime = event.timestamp() / 1000 / 1000;
-            //std::time(&rawtime);
-            struct tm *now = std::localtime(&rawtime);
-
-            // format time to "HH:MM:SS"
-            char buffer[10];
-            std::strftime(buffer, 10, "%T", now);
-
-            std::cout << buffer << " ";
-
-            std::cout << lms::logging::levelColor(static_cast<lms::logging::Level>(event.level()));
-            std::cout << lms::logging::levelName(static_cast<lms::logging::Level>(event.level())) << " " << event.tag();
-            std::cout << lms::internal::COLOR_WHITE;
-            std::cout << " " << event.text() << std::endl;
+            bool closeAfter = false;
+            if(response.has_log_event()) {
+                closeAfter = printLogEvent(response.log_event());
+            } else if(response.has_log_event_batch()) {
+                for(const auto &event : response.log_event_batch().events()) {
+                    closeAfter |= printLogEvent(event);
+                }
+            } else if(response.has_channel_snapshot()) {
+                printChannelSnapshot(response.channel_snapshot());
+            }
 
-            if(event.has_close_after() && event.close_after()) {
+            if(closeAfter) {
                 break;
             }
         }
@@ -882,6 +1186,51 @@ void connectToMaster(int argc, char *argv[]) {
             }
             stopRecording->set_tag(tagArg.getValue());
             socket.writeMessage(req);
+        } else if(strcmp(argv[1], "dump-flight-recorder") == 0) {
+            TCLAP::CmdLine cmd("lms dump-flight-recorder", ' ', LMS_VERSION_STRING);
+            TCLAP::UnlabeledValueArg<std::string> nameArg(
+                "name", "Runtime name", false, "my_runtime", "NAME", cmd);
+            TCLAP::ValueArg<std::string> tagArg(
+                "", "tag",
+                "Set folder name for dumped data", false, "",
+                "tag", cmd);
+            cmd.parse(argc-1, argv+1);
+
+            lms::Request::Runtime::DumpFlightRecorder *dump =
+                req.mutable_runtime()->mutable_dump_flight_recorder();
+
+            if(nameArg.isSet()) {
+                req.mutable_runtime()->set_name(nameArg.getValue());
+            }
+            if(tagArg.isSet()) {
+                dump->set_tag(tagArg.getValue());
+            }
+            socket.writeMessage(req);
+        } else if(strcmp(argv[1], "inspect") == 0) {
+            TCLAP::CmdLine cmd("lms inspect", ' ', LMS_VERSION_STRING);
+            TCLAP::UnlabeledValueArg<std::string> nameArg(
+                "name", "Runtime name", false, "my_runtime", "NAME", cmd);
+            TCLAP::MultiArg<std::string> channelsArg(
+                "", "ch", "Add channel to inspect", true, "Channel", cmd);
+            TCLAP::ValueArg<float> rateArg(
+                "", "rate", "Snapshots per second, 0 for every cycle",
+                false, 10, "RATE", cmd);
+            cmd.parse(argc-1, argv+1);
+
+            lms::Request::Runtime::ChannelSubscribe *subscribe =
+                req.mutable_runtime()->mutable_channel_subscribe();
+
+            if(nameArg.isSet()) {
+                req.mutable_runtime()->set_name(nameArg.getValue());
+            }
+            for(const auto& ch : channelsArg) {
+                *subscribe->add_channels() = ch;
+            }
+            subscribe->set_sample_rate(rateArg.getValue());
+            socket.writeMessage(req);
+
+            // the master stops the snapshots when this client disconnects
+            streamLogs(socket);
         } else if(strcmp(argv[1], "profiling") == 0 || strcmp(argv[1], "prof") == 0) {
             TCLAP::CmdLine cmd("lms profiling", ' ', LMS_VERSION_STRING);
             TCLAP::UnlabeledValueArg<std::string> nameArg(
@@ -943,7 +1292,62 @@ void connectToMaster(int argc, char *argv[]) {
         std::cout << "  kill <name> - Kill runtime (SIGKILL)\n";
         std::cout << "  stop <name> - Stop runtime (SIGINT)\n";
         std::cout << "  profiling <name> - Show profiling\n";
+        std::cout << "  dump-flight-recorder <name> - Write the flight recorder to ~/lmslogs\n";
+        std::cout << "  inspect <name> --ch <channel> - Show live snapshots of channels\n";
+        std::cout << "  schedule <file> - Show the static schedule of an XML config file\n";
+    }
+}
+
+int schedule(int argc, char *argv[]) {
+    auto levels = logLevels();
+    TCLAP::ValuesConstraint<std::string> logConstraint(levels);
+
+    TCLAP::CmdLine cmd("lms schedule", ' ', LMS_VERSION_STRING);
+    TCLAP::UnlabeledValueArg<std::string> configArg(
+        "config", "XML config path", true, "lms.xml", "XML Config", cmd);
+    TCLAP::MultiArg<std::string> loadPathsArg(
+        "l", "load-path", "Add additional load path", false, "Path", cmd);
+    TCLAP::MultiArg<std::string> flagsArg(
+        "f", "flag", "Add flag for XML config", false, "Flag", cmd);
+    TCLAP::ValueArg<std::string> logArg(
+        "", "log", "Minimum logging level",
+        false, "warn", &logConstraint, cmd);
+    TCLAP::ValueArg<std::string> saveArg(
+        "s", "save", "Save the schedule, load it with <schedule src=\"FILE\" />",
+        false, "", "FILE", cmd);
+    cmd.parse(argc-1, argv+1);
+
+    logging::Level logLevel = logging::Level::WARN;
+    logging::levelFromName(logArg.getValue(), logLevel);
+    logging::Context::getDefault().setLevel(logLevel);
+
+    Schedule result;
+    {
+        // modules are destroyed before the schedule is printed
+        Framework fw(internal::realpath(configArg.getValue()));
+        for(const auto& path : loadPathsArg) {
+            fw.addSearchPath(internal::realpath(path));
+        }
+        for(const auto& flag : flagsArg) {
+            fw.addFlag(flag);
+        }
+        if(! fw.dryRun(result)) {
+            std::cout << "Could not compute schedule" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    result.print(std::cout);
+
+    if(saveArg.isSet()) {
+        std::ofstream file(saveArg.getValue());
+        result.write(file);
+        if(! file) {
+            std::cout << "Could not write " << saveArg.getValue() << std::endl;
+            return EXIT_FAILURE;
+        }
     }
+    return result.conflicts.empty() ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 
 /*void interactive() {
@@ -5,32 +5,73 @@
 #include <memory>
 #include <map>
 #include <list>
+#include <deque>
 #include <cmath>
 
 #include "lms/protobuf_socket.h"
 #include "messages.pb.h"
+#include "log_ring.h"
 #include "lms/logger.h"
 
 namespace lms {
 namespace internal {
 
+/**
+ * @brief Server that forks runtimes and relays messages between runtimes and
+ * clients.
+ *
+ * All sockets are non-blocking and are served by a single epoll loop. Every
+ * outgoing message is appended to the output queue of its connection and
+ * written as soon as the socket is writable, so a slow client never blocks
+ * the master. If a client's queue grows beyond MAX_CLIENT_BACKLOG, log events
+ * for that client are dropped until the queue is drained.
+ *
+ * Runtimes pass log events through a shared LogRing, the master is woken up
+ * by the ring's eventfd. Events are collected into one batch per wakeup that
+ * is serialized once and referenced by the queues of all attached clients.
+ */
 class MasterServer {
 public:
     MasterServer();
+    ~MasterServer();
     int useUnix(const std::string &path);
     int useIPv4(int port);
     void start();
 
+    /**
+     * @brief Number of queued bytes after which log events for a client are
+     * dropped.
+     */
+    static constexpr size_t MAX_CLIENT_BACKLOG = 4 * 1024 * 1024;
+
+    /**
+     * @brief Maximum number of log events taken from a runtime's ring per
+     * wakeup, so that a flooding runtime does not starve the other
+     * connections.
+     */
+    static constexpr int MAX_LOG_EVENTS_PER_WAKEUP = 1024;
+
 private:
+    /**
+     * @brief Non-blocking socket registered in the epoll loop.
+     */
+    struct Connection {
+        explicit Connection(int fd);
+        ProtobufSocket sock;
+        // true if EPOLLOUT is registered
+        bool waitWritable;
+    };
+
     struct Client {
         Client(int fd, const std::string &peer);
-        ProtobufSocket sock;
+        Connection conn;
         std::string peer;
         bool isAttached;
         pid_t attachedRuntime;
         bool shutdownRuntimeOnDetach;
         bool listenBroadcats = false;
         logging::Level logLevel = logging::Level::ALL;
+        size_t droppedLogEvents = 0;
     };
 
     struct Server {
@@ -39,32 +80,67 @@ private:
     };
 
     struct Runtime {
+        Runtime(const std::string &name, pid_t pid, std::unique_ptr<LogRing> log,
+                int commFd, const std::string &config_file);
         std::string name;
         pid_t pid;
-        ProtobufSocket logSock;
-        ProtobufSocket commSock;
+        std::unique_ptr<LogRing> log;
+        Connection comm;
         std::string config_file;
     };
 
     std::vector<Server> m_servers;
-    std::vector<Client> m_clients;
+    std::map<int, Client> m_clients;
     std::vector<Runtime> m_runtimes;
     bool m_running;
     int runtimeNameCounter = 1;
+    int m_epoll;
+    // reused for the log events of every wakeup
+    lms::Response m_logBatch;
 
     void enableNonBlock(int sock);
+    void addToLoop(int fd);
+    void removeFromLoop(int fd);
+
+    void send(Connection &conn, const google::protobuf::Message &message);
+    bool flush(Connection &conn);
+
+    void acceptClients(const Server &server);
+    void handleClient(int fd, std::uint32_t events);
+    void closeClient(std::map<int, Client>::iterator it);
+    void handleRuntime(Runtime &runtime, int fd, std::uint32_t events);
+    void closeRuntime(pid_t pid);
+
+    /**
+     * @brief Forward the events in a runtime's log ring to all attached
+     * clients whose log level matches.
+     * @param maxEvents maximum number of events to take from the ring
+     * @return false if events are left in the ring
+     */
+    bool forwardLogEvents(Runtime &runtime, int maxEvents);
+
     void processClient(Client &client, const lms::Request &message);
     void runFramework(Client &client, const Request_Run &options);
     void broadcastResponse(const lms::Response &response);
     void buildListRuntimesResponse(lms::Response &response);
     void buildListClientsResponse(lms::Response &response);
+    void setLogLevel(Runtime &runtime, logging::Level level);
+    // stop channel snapshots if no client is left to receive them
+    void unsubscribeChannels(Runtime &runtime);
     Runtime* getRuntimeByName(const std::string &name);
     Runtime* getRuntimeByPid(pid_t id);
+    Runtime* getRuntimeByFd(int fd);
     bool isSomeoneAttached(pid_t id);
 };
 
-void setLogLevel(ProtobufSocket &sock, logging::Level level);
-
 void connectToMaster(int argc, char *argv[]);
+
+/**
+ * @brief Compute the static schedule of a config in this process, the
+ * master server is not needed.
+ *
+ * @return exit code
+ */
+int schedule(int argc, char *argv[]);
 }
 }
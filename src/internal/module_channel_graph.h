@@ -65,6 +65,22 @@ public:
         return false;
     }
 
+    /**
+     * @brief Find the access of a module to a channel.
+     * @return nullptr if the module does not access the channel
+     */
+    const Access *findAccess(const std::string &channel, const T &module) const {
+        auto it = m_data.find(channel);
+        if (it != m_data.end()) {
+            for (const auto &access : it->second) {
+                if (access.module == module) {
+                    return &access;
+                }
+            }
+        }
+        return nullptr;
+    }
+
     std::vector<Access> getChannelAccessors(const std::string &channel) const {
         auto it = m_data.find(channel);
         if(it != m_data.end()) {
@@ -86,8 +102,199 @@ public:
         return false;
     }
 
+    /**
+     * @brief Remove all channel accesses of a module.
+     */
+    void removeModule(const T &module) {
+        for (auto it = m_data.begin(); it != m_data.end();) {
+            auto &accesses = it->second;
+            for (auto access = accesses.begin(); access != accesses.end();) {
+                if (access->module == module) {
+                    access = accesses.erase(access);
+                } else {
+                    ++access;
+                }
+            }
+            if (accesses.empty()) {
+                it = m_data.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
     void clear() { m_data.clear(); }
 
+    /**
+     * @brief Execution order between two modules accessing the same channel.
+     *
+     * Higher priority runs first, otherwise writers run before readers.
+     *
+     * @return true if there is an order and from/to were assigned
+     */
+    static bool dependency(const Access &a, const Access &b, T &from, T &to) {
+        if (b.priority > a.priority) {
+            from = b.module;
+            to = a.module;
+            return true;
+        } else if (a.priority > b.priority) {
+            from = a.module;
+            to = b.module;
+            return true;
+        }
+
+        // check if it's reader vs writer
+        bool aWrite = a.permission == MCGPermission::WRITE;
+        bool bWrite = b.permission == MCGPermission::WRITE;
+
+        if (aWrite && !bWrite) {
+            from = a.module;
+            to = b.module;
+            return true;
+        } else if (!aWrite && bWrite) {
+            from = b.module;
+            to = a.module;
+            return true;
+        }
+
+        // both writers, see writeConflicts()
+        return false;
+    }
+
+    /**
+     * @brief Two writers of a channel without a defined execution order.
+     */
+    struct WriteConflict {
+        std::string channel;
+        T first;
+        T second;
+    };
+
+    /**
+     * @brief Find all pairs of modules that write the same channel with the
+     * same priority.
+     *
+     * No edge is generated between them, so they may run concurrently and
+     * the final channel content depends on timing.
+     */
+    std::vector<WriteConflict> writeConflicts() const {
+        std::vector<WriteConflict> result;
+        for (const auto &channel : m_data) {
+            for (auto it = channel.second.begin(); it != channel.second.end();
+                 ++it) {
+                for (auto jt = it + 1; jt != channel.second.end(); ++jt) {
+                    if (it->permission == MCGPermission::WRITE &&
+                        jt->permission == MCGPermission::WRITE &&
+                        it->priority == jt->priority) {
+                        result.push_back({channel.first, it->module, jt->module});
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Return the edges caused by a module's access to a channel.
+     *
+     * Used to update a DAG incrementally after readChannel() or
+     * writeChannel() returned true.
+     */
+    std::vector<std::pair<T, T>> dependencies(const std::string &channel,
+                                              const T &module) const {
+        std::vector<std::pair<T, T>> result;
+        auto it = m_data.find(channel);
+        if (it == m_data.end()) {
+            return result;
+        }
+
+        const Access *self = nullptr;
+        for (const auto &access : it->second) {
+            if (access.module == module) {
+                self = &access;
+            }
+        }
+        if (self == nullptr) {
+            return result;
+        }
+
+        for (const auto &access : it->second) {
+            T from, to;
+            if (access.module != module &&
+                dependency(*self, access, from, to)) {
+                result.push_back(std::make_pair(from, to));
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Find a channel that causes the edge from one module to another.
+     * @return channel name, empty if none
+     */
+    std::string channelBetween(const T &from, const T &to) const {
+        for (const auto &channel : m_data) {
+            const Access *fromAccess = nullptr, *toAccess = nullptr;
+            for (const auto &access : channel.second) {
+                if (access.module == from) {
+                    fromAccess = &access;
+                } else if (access.module == to) {
+                    toAccess = &access;
+                }
+            }
+            T a, b;
+            if (fromAccess && toAccess &&
+                dependency(*fromAccess, *toAccess, a, b) && a == from) {
+                return channel.first;
+            }
+        }
+        return std::string();
+    }
+
+    /**
+     * @brief Two accesses to a channel, at least one of them a write, that
+     * have no defined execution order.
+     */
+    struct UnorderedAccess {
+        std::string channel;
+        Access first;
+        Access second;
+    };
+
+    /**
+     * @brief Find all pairs of accesses to the same channel, at least one of
+     * them a write, without a path between the modules in the DAG.
+     *
+     * Such modules may run concurrently and race on the channel.
+     *
+     * @param dag DAG generated from this graph
+     * @param sequential a function of type bool (*)(T const&, T const&) that
+     * returns true if two modules never run at the same time
+     */
+    template <typename PredicateFn>
+    std::vector<UnorderedAccess> unorderedAccesses(const DAG<T> &dag,
+                                                   PredicateFn sequential) const {
+        std::vector<UnorderedAccess> result;
+        for (const auto &channel : m_data) {
+            for (auto it = channel.second.begin(); it != channel.second.end();
+                 ++it) {
+                for (auto jt = it + 1; jt != channel.second.end(); ++jt) {
+                    if (it->permission != MCGPermission::WRITE &&
+                        jt->permission != MCGPermission::WRITE) {
+                        continue;
+                    }
+                    if (sequential(it->module, jt->module) ||
+                        dag.hasPath(it->module, jt->module) ||
+                        dag.hasPath(jt->module, it->module)) {
+                        continue;
+                    }
+                    result.push_back({channel.first, *it, *jt});
+                }
+            }
+        }
+        return result;
+    }
+
     DAG<T> generateDAG() const {
         DAG<T> dag;
 
@@ -96,29 +303,10 @@ public:
             // Iterate over all module combination accessing this channel
             for (auto it = channel.second.begin(); it != channel.second.end();
                  ++it) {
-                const T &mw1 = it->module;
-                int prio1 = it->priority;
-
                 for (auto jt = it + 1; jt != channel.second.end(); ++jt) {
-                    const T &mw2 = jt->module;
-                    int prio2 = jt->priority;
-
-                    if (prio2 > prio1) {
-                        dag.edge(mw2, mw1);
-                    } else if (prio1 > prio2) {
-                        dag.edge(mw1, mw2);
-                    } else {
-                        // check if it's reader vs writer
-                        bool mw1Write = it->permission == MCGPermission::WRITE;
-                        bool mw2Write = jt->permission == MCGPermission::WRITE;
-
-                        if (mw1Write && !mw2Write) {
-                            dag.edge(mw1, mw2);
-                        } else if (!mw1Write && mw2Write) {
-                            dag.edge(mw2, mw1);
-                        }
-
-                        // TODO both writers -> throw exception
+                    T from, to;
+                    if (dependency(*it, *jt, from, to)) {
+                        dag.edge(from, to);
                     }
                 }
             }
@@ -0,0 +1,175 @@
+#ifndef LMS_INTERNAL_ONLINE_TOPO_ORDER_H
+#define LMS_INTERNAL_ONLINE_TOPO_ORDER_H
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include "dag.h"
+
+namespace lms {
+namespace internal {
+
+/**
+ * @brief Topological order of a DAG that is kept up to date while edges are
+ * inserted.
+ *
+ * Uses the algorithm of Pearce and Kelly: inserting an edge that agrees with
+ * the current order costs nothing, otherwise only the nodes between the two
+ * positions that are connected to the edge are reordered.
+ *
+ * http://www.doc.ic.ac.uk/~phjk/Publications/DynamicTopoSortAlg-JEA-07.pdf
+ *
+ * This implementation is not thread-safe.
+ */
+template <typename T> class OnlineTopoOrder {
+public:
+    /**
+     * @brief Start with the nodes and edges of a DAG.
+     * @param dag graph without cycles
+     * @param order topological order of all nodes in dag
+     */
+    template <typename ListType>
+    void reset(const DAG<T> &dag, const ListType &order) {
+        m_index.clear();
+        m_values.clear();
+        for (const T &node : order) {
+            m_index[node] = m_values.size();
+            m_values.push_back(node);
+        }
+        m_at = m_values;
+        m_position.resize(m_at.size());
+        for (size_t i = 0; i < m_at.size(); i++) {
+            m_position[i] = i;
+        }
+        m_successors.assign(m_at.size(), std::vector<size_t>());
+        m_predecessors.assign(m_at.size(), std::vector<size_t>());
+
+        for (const auto &pair : dag) {
+            auto to = m_index.find(pair.first);
+            for (const T &from : pair.second) {
+                auto it = m_index.find(from);
+                if (to != m_index.end() && it != m_index.end()) {
+                    m_successors[it->second].push_back(to->second);
+                    m_predecessors[to->second].push_back(it->second);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Insert an edge and update the order.
+     *
+     * The edge is not inserted if it would close a cycle.
+     *
+     * @param cycle nodes of the cycle starting with 'to' and ending with
+     * 'from' if the edge would close one
+     * @return false if the edge would close a cycle or a node is unknown
+     */
+    bool edge(const T &from, const T &to, std::vector<T> &cycle) {
+        auto fromIt = m_index.find(from);
+        auto toIt = m_index.find(to);
+        if (fromIt == m_index.end() || toIt == m_index.end()) {
+            return false;
+        }
+        const size_t x = fromIt->second, y = toIt->second;
+        if (x == y) {
+            // reflexive edges are ignored like in DAG
+            return true;
+        }
+        const size_t lower = m_position[y], upper = m_position[x];
+
+        if (lower < upper) {
+            // forward search from 'to' for nodes placed before 'from'
+            std::vector<size_t> forward, parent(m_at.size(), m_at.size());
+            std::vector<bool> visited(m_at.size(), false);
+            std::vector<size_t> stack{y};
+            visited[y] = true;
+            while (!stack.empty()) {
+                const size_t node = stack.back();
+                stack.pop_back();
+                forward.push_back(node);
+                for (size_t next : m_successors[node]) {
+                    if (next == x) {
+                        cycle.clear();
+                        for (size_t n = node; n != m_at.size(); n = parent[n]) {
+                            cycle.push_back(m_values[n]);
+                        }
+                        std::reverse(cycle.begin(), cycle.end());
+                        cycle.push_back(from);
+                        return false;
+                    }
+                    if (!visited[next] && m_position[next] < upper) {
+                        visited[next] = true;
+                        parent[next] = node;
+                        stack.push_back(next);
+                    }
+                }
+            }
+
+            // backward search from 'from' for nodes placed after 'to'
+            std::vector<size_t> backward;
+            stack.push_back(x);
+            visited[x] = true;
+            while (!stack.empty()) {
+                const size_t node = stack.back();
+                stack.pop_back();
+                backward.push_back(node);
+                for (size_t prev : m_predecessors[node]) {
+                    if (!visited[prev] && m_position[prev] > lower) {
+                        visited[prev] = true;
+                        stack.push_back(prev);
+                    }
+                }
+            }
+
+            // place all backward nodes before all forward nodes, reusing
+            // their positions
+            auto byPosition = [this](size_t a, size_t b) {
+                return m_position[a] < m_position[b];
+            };
+            std::sort(forward.begin(), forward.end(), byPosition);
+            std::sort(backward.begin(), backward.end(), byPosition);
+
+            std::vector<size_t> nodes(backward);
+            nodes.insert(nodes.end(), forward.begin(), forward.end());
+            std::vector<size_t> positions;
+            for (size_t node : nodes) {
+                positions.push_back(m_position[node]);
+            }
+            std::sort(positions.begin(), positions.end());
+            for (size_t i = 0; i < nodes.size(); i++) {
+                m_position[nodes[i]] = positions[i];
+                m_at[positions[i]] = m_values[nodes[i]];
+            }
+        }
+
+        m_successors[x].push_back(y);
+        m_predecessors[y].push_back(x);
+        return true;
+    }
+
+    bool contains(const T &node) const { return m_index.count(node) == 1; }
+
+    /**
+     * @brief Return all nodes in topological order.
+     */
+    const std::vector<T> &order() const { return m_at; }
+
+private:
+    // node index by value, indices never change
+    std::map<T, size_t> m_index;
+    // node value by index
+    std::vector<T> m_values;
+    // position of each node index in the order
+    std::vector<size_t> m_position;
+    // node value at each position
+    std::vector<T> m_at;
+    std::vector<std::vector<size_t>> m_successors;
+    std::vector<std::vector<size_t>> m_predecessors;
+};
+
+}  // namespace internal
+}  // namespace lms
+
+#endif  // LMS_INTERNAL_ONLINE_TOPO_ORDER_H
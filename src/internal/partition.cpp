@@ -0,0 +1,51 @@
+#include "partition.h"
+
+namespace lms {
+namespace internal {
+
+std::vector<std::vector<size_t>> assignWorkers(const std::vector<size_t> &widths,
+                                               size_t threads) {
+    std::vector<std::vector<size_t>> result(threads);
+
+    std::vector<size_t> partitions;
+    for (size_t i = 0; i < widths.size(); i++) {
+        if (widths[i] > 0) {
+            partitions.push_back(i);
+        }
+    }
+    if (partitions.empty() || threads == 0) {
+        return result;
+    }
+
+    if (threads <= partitions.size()) {
+        for (size_t i = 0; i < partitions.size(); i++) {
+            result[i % threads].push_back(partitions[i]);
+        }
+        return result;
+    }
+
+    std::vector<size_t> count(partitions.size(), 1);
+    for (size_t remaining = threads - partitions.size(); remaining > 0;
+         remaining--) {
+        size_t best = 0;
+        for (size_t i = 1; i < partitions.size(); i++) {
+            // count[i] / width[i] < count[best] / width[best]
+            if (count[i] * widths[partitions[best]] <
+                count[best] * widths[partitions[i]]) {
+                best = i;
+            }
+        }
+        count[best]++;
+    }
+
+    size_t thread = 0;
+    for (size_t i = 0; i < partitions.size(); i++) {
+        for (size_t j = 0; j < count[i]; j++) {
+            result[thread++].push_back(partitions[i]);
+        }
+    }
+    return result;
+}
+
+}  // namespace internal
+}  // namespace lms
@@ -0,0 +1,30 @@
+#ifndef LMS_INTERNAL_PARTITION_H
+#define LMS_INTERNAL_PARTITION_H
+
+#include <cstddef>
+#include <vector>
+
+namespace lms {
+namespace internal {
+
+/**
+ * @brief Distribute the worker threads of a pool over independent partitions
+ * of the module graph.
+ *
+ * Every partition with a width above zero gets at least one thread if there
+ * are enough threads, the remaining threads go one by one to the partition
+ * with the lowest number of threads relative to its width. If there are
+ * fewer threads than partitions, the partitions are shared round robin.
+ *
+ * @param widths maximum number of modules of each partition that can run in
+ * parallel, 0 if the partition needs no worker thread
+ * @param threads number of worker threads
+ * @return for each worker thread the indices of the partitions it executes
+ */
+std::vector<std::vector<size_t>> assignWorkers(const std::vector<size_t> &widths,
+                                               size_t threads);
+
+}  // namespace internal
+}  // namespace lms
+
+#endif  // LMS_INTERNAL_PARTITION_H
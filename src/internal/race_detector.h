@@ -0,0 +1,134 @@
+#ifndef LMS_INTERNAL_RACE_DETECTOR_H
+#define LMS_INTERNAL_RACE_DETECTOR_H
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "lms/datamanager.h"
+#include "module_channel_graph.h"
+
+namespace lms {
+namespace internal {
+
+/**
+ * @brief Checks at runtime that data channels are only accessed by the
+ * modules that requested them.
+ *
+ * The execution order only covers channels a module gained access to with
+ * readChannel() or writeChannel(). Handles that are passed to other modules
+ * or threads, or written through a read handle, bypass the order and race
+ * if modules run in parallel.
+ *
+ * Threads executing a module are marked with enter() and leave(). Each
+ * violation is recorded once and collected with takeViolations().
+ */
+template <typename T> class RaceDetector : public lms::AccessObserver {
+public:
+    struct Violation {
+        enum Kind {
+            /** module accessed a channel it did not request */
+            NOT_ACCESSOR,
+            /** module wrote a channel it only requested for reading */
+            READ_ONLY,
+            /** thread that is not executing a module accessed a channel */
+            OUTSIDE_MODULE
+        };
+        std::string channel;
+        // undefined for OUTSIDE_MODULE
+        T module;
+        Kind kind;
+    };
+
+    /**
+     * @param graph accesses of all modules
+     * @param graphMutex mutex that is locked while the graph is modified
+     */
+    RaceDetector(const ModuleChannelGraph<T> &graph, std::mutex &graphMutex)
+        : m_graph(graph), m_graphMutex(graphMutex), m_cycleRunning(false) {}
+
+    /**
+     * @brief Mark the calling thread as executing a module.
+     */
+    void enter(const T &module) {
+        current().detector = this;
+        current().module = module;
+    }
+
+    /**
+     * @brief The calling thread finished executing a module.
+     */
+    void leave() { current().detector = nullptr; }
+
+    /**
+     * @brief Accesses outside of modules are only reported while a cycle
+     * is running, init() and destroy() may access channels freely.
+     */
+    void cycleRunning(bool running) {
+        m_cycleRunning.store(running, std::memory_order_relaxed);
+    }
+
+    void access(const std::string &channel, bool write) override {
+        const Current &cur = current();
+        typename Violation::Kind kind;
+        if (cur.detector != this) {
+            if (!m_cycleRunning.load(std::memory_order_relaxed)) {
+                return;
+            }
+            kind = Violation::OUTSIDE_MODULE;
+        } else {
+            std::lock_guard<std::mutex> lock(m_graphMutex);
+            auto access = m_graph.findAccess(channel, cur.module);
+            if (access == nullptr) {
+                kind = Violation::NOT_ACCESSOR;
+            } else if (write && access->permission == MCGPermission::READ) {
+                kind = Violation::READ_ONLY;
+            } else {
+                return;
+            }
+        }
+
+        const T module = kind == Violation::OUTSIDE_MODULE ? T() : cur.module;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_reported.insert(std::make_tuple(channel, module, kind)).second) {
+            m_violations.push_back({channel, module, kind});
+        }
+    }
+
+    /**
+     * @brief Return the violations since the last call.
+     */
+    std::vector<Violation> takeViolations() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::vector<Violation> result;
+        result.swap(m_violations);
+        return result;
+    }
+
+private:
+    struct Current {
+        const RaceDetector *detector = nullptr;
+        T module = T();
+    };
+
+    static Current &current() {
+        static thread_local Current value;
+        return value;
+    }
+
+    const ModuleChannelGraph<T> &m_graph;
+    std::mutex &m_graphMutex;
+    std::atomic<bool> m_cycleRunning;
+
+    std::mutex m_mutex;
+    std::vector<Violation> m_violations;
+    std::set<std::tuple<std::string, T, int>> m_reported;
+};
+
+}  // namespace internal
+}  // namespace lms
+
+#endif  // LMS_INTERNAL_RACE_DETECTOR_H
@@ -0,0 +1,86 @@
+#include <map>
+
+#include "runtime_diff.h"
+
+namespace lms {
+namespace internal {
+
+namespace {
+
+template <typename Info>
+std::map<std::string, const Info *> byName(const std::vector<Info> &infos) {
+    std::map<std::string, const Info *> result;
+    for (const Info &info : infos) {
+        result[info.name] = &info;
+    }
+    return result;
+}
+
+bool sameInstance(const ModuleInfo &a, const ModuleInfo &b) {
+    return a.lib == b.lib && a.clazz == b.clazz &&
+           a.mainThread == b.mainThread && a.channelMapping == b.channelMapping;
+}
+
+bool sameInstance(const ServiceInfo &a, const ServiceInfo &b) {
+    return a.lib == b.lib && a.clazz == b.clazz && a.workers == b.workers;
+}
+
+template <typename Info>
+void diff(const std::vector<Info> &before, const std::vector<Info> &after,
+          std::set<std::string> &removed, std::set<std::string> &reloaded,
+          std::set<std::string> &reconfigured) {
+    const auto beforeByName = byName(before);
+    const auto afterByName = byName(after);
+
+    for (const auto &old : beforeByName) {
+        auto it = afterByName.find(old.first);
+        if (it == afterByName.end()) {
+            removed.insert(old.first);
+        } else if (!sameInstance(*old.second, *it->second)) {
+            reloaded.insert(old.first);
+        } else if (old.second->configs != it->second->configs ||
+                   old.second->log != it->second->log) {
+            reconfigured.insert(old.first);
+        }
+    }
+}
+
+}  // namespace
+
+RuntimeDiff diffRuntime(const RuntimeInfo &before, const RuntimeInfo &after) {
+    RuntimeDiff result;
+
+    diff(before.modules, after.modules, result.removedModules,
+         result.reloadedModules, result.reconfiguredModules);
+    diff(before.services, after.services, result.removedServices,
+         result.reloadedServices, result.reconfiguredServices);
+
+    const auto sharedBefore = byName(before.sharedChannels);
+    const auto sharedAfter = byName(after.sharedChannels);
+    for (const auto &channel : sharedAfter) {
+        auto it = sharedBefore.find(channel.first);
+        if (it == sharedBefore.end()) {
+            result.addedSharedChannels.insert(channel.first);
+        } else if (it->second->writer != channel.second->writer ||
+                   it->second->slots != channel.second->slots) {
+            result.changedSharedChannels.insert(channel.first);
+        }
+    }
+    for (const auto &channel : sharedBefore) {
+        if (sharedAfter.count(channel.first) == 0) {
+            result.removedSharedChannels.insert(channel.first);
+        }
+    }
+
+    const FlightRecorderInfo &a = before.flightRecorder;
+    const FlightRecorderInfo &b = after.flightRecorder;
+    result.flightRecorderChanged =
+        a.enabled != b.enabled || a.duration != b.duration ||
+        a.frames != b.frames || a.channels != b.channels ||
+        before.clock.cycle != after.clock.cycle;
+
+    return result;
+}
+
+}  // namespace internal
+}  // namespace lms
@@ -0,0 +1,62 @@
+#ifndef LMS_INTERNAL_RUNTIME_DIFF_H
+#define LMS_INTERNAL_RUNTIME_DIFF_H
+
+#include <set>
+#include <string>
+
+#include "xml_parser.h"
+
+namespace lms {
+namespace internal {
+
+/**
+ * @brief Differences between two RuntimeInfo objects, used to apply a
+ * changed XML config without touching unchanged services and modules.
+ *
+ * Services and modules that are only part of the new RuntimeInfo are not
+ * listed, they are loaded like on the first start.
+ */
+struct RuntimeDiff {
+    /** modules that are not part of the new config */
+    std::set<std::string> removedModules;
+
+    /**
+     * modules that need a new instance because lib, class, mainThread or a
+     * channel mapping changed
+     */
+    std::set<std::string> reloadedModules;
+
+    /** modules where only configs or the log level changed */
+    std::set<std::string> reconfiguredModules;
+
+    /** services that are not part of the new config */
+    std::set<std::string> removedServices;
+
+    /** services whose lib or class changed */
+    std::set<std::string> reloadedServices;
+
+    /** services where only configs or the log level changed */
+    std::set<std::string> reconfiguredServices;
+
+    /** shared channels that are only part of the new config */
+    std::set<std::string> addedSharedChannels;
+
+    /** shared channels whose writer flag or number of slots changed */
+    std::set<std::string> changedSharedChannels;
+
+    /** shared channels that are not part of the new config */
+    std::set<std::string> removedSharedChannels;
+
+    /** flight recorder settings or the cycle time changed */
+    bool flightRecorderChanged = false;
+};
+
+/**
+ * @brief Compute what changed from one RuntimeInfo to another.
+ */
+RuntimeDiff diffRuntime(const RuntimeInfo &before, const RuntimeInfo &after);
+
+}  // namespace internal
+}  // namespace lms
+
+#endif  // LMS_INTERNAL_RUNTIME_DIFF_H
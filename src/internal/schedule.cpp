@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <sstream>
+#include <tuple>
+
+#include "schedule.h"
+
+namespace lms {
+namespace internal {
+
+namespace {
+
+void hashBytes(std::uint64_t &hash, const std::string &bytes) {
+    // FNV-1a, must be stable across processes
+    for (char c : bytes) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+    }
+}
+
+}  // namespace
+
+std::uint64_t Schedule::hashAccesses(std::vector<Access> accesses) {
+    std::sort(accesses.begin(), accesses.end(),
+              [](const Access &a, const Access &b) {
+                  return std::tie(a.channel, a.module, a.write, a.priority) <
+                         std::tie(b.channel, b.module, b.write, b.priority);
+              });
+
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (const auto &access : accesses) {
+        std::ostringstream line;
+        line << access.channel << " " << access.module << " "
+             << (access.write ? "write" : "read") << " " << access.priority
+             << "\n";
+        hashBytes(hash, line.str());
+    }
+    return hash == 0 ? 1 : hash;
+}
+
+void Schedule::write(std::ostream &os) const {
+    os << "accesses " << accessHash << "\n";
+    for (const auto &module : order) {
+        os << "module " << module << "\n";
+    }
+    for (const auto &edge : edges) {
+        os << "edge " << edge.first << " " << edge.second << "\n";
+    }
+}
+
+bool Schedule::read(std::istream &is) {
+    order.clear();
+    edges.clear();
+    accessHash = 0;
+
+    std::string line;
+    while (std::getline(is, line)) {
+        std::istringstream fields(line);
+        std::string type;
+        if (!(fields >> type) || type[0] == '#') {
+            continue;
+        }
+
+        if (type == "accesses") {
+            if (!(fields >> accessHash)) {
+                return false;
+            }
+        } else if (type == "module") {
+            std::string module;
+            if (!(fields >> module)) {
+                return false;
+            }
+            order.push_back(module);
+        } else if (type == "edge") {
+            std::string from, to;
+            if (!(fields >> from >> to)) {
+                return false;
+            }
+            edges.push_back(std::make_pair(from, to));
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Schedule::print(std::ostream &os) const {
+    os << "Modules: " << order.size() << "\n";
+    os << "Execution order:";
+    for (const auto &module : order) {
+        os << " " << module;
+    }
+    os << "\n";
+
+    os << "Critical path (" << criticalPath.size() << " modules): ";
+    for (size_t i = 0; i < criticalPath.size(); i++) {
+        os << (i == 0 ? "" : " -> ") << criticalPath[i];
+    }
+    os << "\n";
+
+    os << "Max parallel width: " << width << "\n";
+    os << "Suggested threads: " << suggestedThreads << "\n";
+
+    if (conflicts.empty()) {
+        os << "Write/write conflicts: none\n";
+    } else {
+        os << "Write/write conflicts:\n";
+        for (const auto &conflict : conflicts) {
+            os << "  " << conflict.channel << ": " << conflict.first << ", "
+               << conflict.second << "\n";
+        }
+    }
+}
+
+}  // namespace internal
+}  // namespace lms
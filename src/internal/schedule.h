@@ -0,0 +1,99 @@
+#ifndef LMS_INTERNAL_SCHEDULE_H
+#define LMS_INTERNAL_SCHEDULE_H
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace lms {
+namespace internal {
+
+/**
+ * @brief Static execution schedule of the modules of a config.
+ *
+ * Computed by `lms schedule` from the channel accesses of the modules after
+ * init(). The order and edges can be saved and loaded by the runtime with
+ * <schedule src="..." /> to skip building the DAG on the first cycle.
+ *
+ * The saved schedule carries a hash of the channel accesses it was computed
+ * from. The runtime ignores the schedule if the accesses of its modules hash
+ * differently, e.g. because a channel mapping or priority changed.
+ */
+struct Schedule {
+    /**
+     * @brief Two modules that write the same channel without a defined
+     * execution order.
+     */
+    struct Conflict {
+        std::string channel;
+        std::string first;
+        std::string second;
+    };
+
+    /**
+     * @brief A module's access to a channel, see hashAccesses().
+     */
+    struct Access {
+        std::string channel;
+        std::string module;
+        bool write;
+        int priority;
+    };
+
+    /** all modules in execution order */
+    std::vector<std::string> order;
+
+    /** dependencies between modules without transitive edges */
+    std::vector<std::pair<std::string, std::string>> edges;
+
+    /** longest chain of modules that run one after another */
+    std::vector<std::string> criticalPath;
+
+    /** maximum number of modules that can run in parallel */
+    size_t width = 0;
+
+    /** thread pool size for this config on this machine */
+    int suggestedThreads = 1;
+
+    std::vector<Conflict> conflicts;
+
+    /** hashAccesses() of the channel accesses, 0 if unknown */
+    std::uint64_t accessHash = 0;
+
+    /**
+     * @brief Hash channel accesses independent of their order.
+     *
+     * Stable across processes and never 0.
+     */
+    static std::uint64_t hashAccesses(std::vector<Access> accesses);
+
+    /**
+     * @brief Write order and edges in a line based text format.
+     *
+     * Example:
+     * accesses 1234567890
+     * module imageImporter
+     * module laneDetection
+     * edge imageImporter laneDetection
+     */
+    void write(std::ostream &os) const;
+
+    /**
+     * @brief Read order and edges written by write().
+     * @return false if a line could not be parsed
+     */
+    bool read(std::istream &is);
+
+    /**
+     * @brief Print a human readable summary.
+     */
+    void print(std::ostream &os) const;
+};
+
+}  // namespace internal
+}  // namespace lms
+
+#endif  // LMS_INTERNAL_SCHEDULE_H
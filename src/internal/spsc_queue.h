@@ -0,0 +1,100 @@
+#ifndef LMS_INTERNAL_SPSC_QUEUE_H
+#define LMS_INTERNAL_SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace lms {
+namespace internal {
+
+/**
+ * @brief Bounded lock-free queue for exactly one producer thread and exactly
+ * one consumer thread.
+ *
+ * The slots are allocated once in the constructor. push() and pop() never
+ * block and never take a lock, so the consumer can poll the queue on a hot
+ * path without any cost if the queue is empty.
+ *
+ * Usage:
+ * ~~~~~{.cpp}
+ * SpscQueue<Command> queue(16);
+ *
+ * // producer thread
+ * if(! queue.push(std::move(cmd))) { ... queue is full ... }
+ *
+ * // consumer thread
+ * Command cmd;
+ * while(queue.pop(cmd)) { ... }
+ * ~~~~~
+ */
+template <typename T> class SpscQueue {
+public:
+    /**
+     * @param capacity maximum number of elements in the queue
+     */
+    explicit SpscQueue(size_t capacity)
+        : m_slots(capacity + 1), m_head(0), m_tail(0) {}
+
+    SpscQueue(const SpscQueue &) = delete;
+    SpscQueue &operator=(const SpscQueue &) = delete;
+
+    /**
+     * @brief Append an element. Must only be called from the producer thread.
+     * @return false if the queue is full, value is left untouched in that case
+     */
+    bool push(T &&value) {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        const size_t next = increment(tail);
+        if (next == m_head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        m_slots[tail] = std::move(value);
+        m_tail.store(next, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Remove the oldest element. Must only be called from the consumer
+     * thread.
+     * @return false if the queue is empty
+     */
+    bool pop(T &value) {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        value = std::move(m_slots[head]);
+        // release resources held by the moved-from slot on the consumer side
+        m_slots[head] = T();
+        m_head.store(increment(head), std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Check if the queue is empty. The result is only a hint if called
+     * from the producer thread.
+     */
+    bool empty() const {
+        return m_head.load(std::memory_order_acquire) ==
+               m_tail.load(std::memory_order_acquire);
+    }
+
+    size_t capacity() const { return m_slots.size() - 1; }
+
+private:
+    size_t increment(size_t index) const {
+        return index + 1 == m_slots.size() ? 0 : index + 1;
+    }
+
+    std::vector<T> m_slots;
+    // consumer and producer indices on separate cache lines
+    alignas(64) std::atomic<size_t> m_head;
+    alignas(64) std::atomic<size_t> m_tail;
+};
+
+} // namespace internal
+} // namespace lms
+
+#endif // LMS_INTERNAL_SPSC_QUEUE_H
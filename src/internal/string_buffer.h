@@ -0,0 +1,65 @@
+#ifndef LMS_INTERNAL_STRING_BUFFER_H
+#define LMS_INTERNAL_STRING_BUFFER_H
+
+#include <streambuf>
+#include <string>
+
+namespace lms {
+namespace internal {
+
+/**
+ * @brief Stream buffer that appends everything written to it to a
+ * std::string.
+ *
+ * In contrast to std::ostringstream the target string is owned by the caller
+ * and can be exchanged at any time. Clearing and reusing the same target keeps
+ * its capacity, so serializing into it does not allocate in steady state.
+ *
+ * Usage:
+ * ~~~~~{.cpp}
+ * std::string buffer;
+ * StringOutputBuffer sbuf;
+ * std::ostream os(&sbuf);
+ *
+ * buffer.clear();
+ * sbuf.target(&buffer);
+ * channel.serialize(os);
+ * ~~~~~
+ */
+class StringOutputBuffer : public std::streambuf {
+public:
+    StringOutputBuffer() : m_target(nullptr) {}
+
+    /**
+     * @brief Set the string that subsequent writes are appended to.
+     * @param target string to append to, must outlive its usage
+     */
+    void target(std::string *target) { m_target = target; }
+
+protected:
+    int_type overflow(int_type ch) override {
+        if (m_target == nullptr) {
+            return traits_type::eof();
+        }
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            m_target->push_back(traits_type::to_char_type(ch));
+        }
+        return traits_type::not_eof(ch);
+    }
+
+    std::streamsize xsputn(const char *s, std::streamsize n) override {
+        if (m_target == nullptr) {
+            return 0;
+        }
+        m_target->append(s, static_cast<size_t>(n));
+        return n;
+    }
+
+private:
+    std::string *m_target;
+};
+
+} // namespace internal
+} // namespace lms
+
+#endif // LMS_INTERNAL_STRING_BUFFER_H
@@ -1,53 +1,260 @@
-#include "watch_dog.h"
-#include "backtrace_formatter.h"
-#include <pthread.h>
+#include <algorithm>
+#include <ctime>
+#include <chrono>
+#include <execinfo.h>
+#include <fcntl.h>
 #include <signal.h>
+#include <unistd.h>
+
+#include "watch_dog.h"
 
 namespace lms {
 namespace internal {
 
-// TODO use mutex in beginModule/endModule/thread
+namespace {
+
+std::atomic<unsigned long> nextWatchDogId(0);
+
+// file of the backtrace the hung thread writes in its signal handler,
+// -1 after the handler took it
+std::atomic<int> hangFd(-1);
+std::atomic<bool> hangCaptured(false);
+
+}  // namespace
 
 WatchDog::WatchDog()
-    : logger("WatchDog"), m_hasModule(false), m_barked(false) {}
+    : logger("WatchDog"), m_id(nextWatchDogId++), m_maxExecTime(0),
+      m_hangs(0), m_captureStacks(false), m_nextIndex(0), m_idle(false),
+      m_notified(false), m_running(false) {}
+
+WatchDog::~WatchDog() {
+    stop();
+    std::lock_guard<std::mutex> lock(m_stackMutex);
+    if (m_captureStacks) {
+        SignalHandler::getInstance().removeListener(SIGUSR1, this);
+    }
+}
 
-void WatchDog::watch(Time maxExecTime) {
-    if (m_thread.joinable()) {
-        logger.error() << "WatchDog is initialized already";
+void WatchDog::watch(Time maxExecTime, bool captureStacks) {
+    if (maxExecTime <= Time::ZERO) {
+        stop();
+        m_maxExecTime = 0;
         return;
     }
 
-    if (maxExecTime > Time::ZERO) {
+    {
+        std::lock_guard<std::mutex> lock(m_stackMutex);
+        if (captureStacks && !m_captureStacks) {
+            // load the unwinder now, the signal handler must not allocate
+            void *buffer[1];
+            backtrace(buffer, 1);
+            SignalHandler::getInstance().addListener(SIGUSR1, this);
+        } else if (!captureStacks && m_captureStacks) {
+            SignalHandler::getInstance().removeListener(SIGUSR1, this);
+        }
+        m_captureStacks = captureStacks;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_maxExecTime = maxExecTime.micros();
+        m_notified = true;
+    }
+    m_wakeup.notify_one();
+
+    if (!m_thread.joinable()) {
         m_running = true;
-        m_thread = std::thread([this, maxExecTime]() {
-            while (m_running) {
-                if (m_hasModule && !m_barked &&
-                    m_moduleBegin.since() > maxExecTime) {
-                    m_barked = true;
-                    logger.error() << "Module hangs: " << m_currentModule;
-                    pthread_kill(m_executionThread, SIGUSR1);
+        m_thread = std::thread([this]() { run(); });
+    }
+}
+
+void WatchDog::stop() {
+    if (!m_thread.joinable()) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_running = false;
+    }
+    m_wakeup.notify_one();
+    m_thread.join();
+}
+
+WatchDog::Slot &WatchDog::threadSlot() {
+    struct Cached {
+        unsigned long id;
+        std::shared_ptr<Slot> slot;
+    };
+    static thread_local Cached cached{0, nullptr};
+
+    if (cached.slot && cached.id == m_id) {
+        return *cached.slot;
+    }
+
+    std::shared_ptr<Slot> slot = std::make_shared<Slot>();
+    slot->thread = pthread_self();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        slot->index = m_nextIndex++;
+        m_slots.push_back(slot);
+    }
+    cached.id = m_id;
+    cached.slot = slot;
+    return *slot;
+}
+
+void WatchDog::moduleName(const Module *module, const std::string &name) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_names[module] = name;
+}
+
+void WatchDog::beginModule(const Module *module) {
+    const std::int64_t maxExecTime = m_maxExecTime.load(std::memory_order_relaxed);
+    if (maxExecTime == 0) {
+        return;
+    }
+
+    Slot &slot = threadSlot();
+    slot.module = module;
+    slot.sequence++;
+    slot.deadline = Time::now().micros() + maxExecTime;
+
+    // the watcher has no deadline to wait for
+    if (m_idle) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_notified = true;
+        }
+        m_wakeup.notify_one();
+    }
+}
+
+void WatchDog::endModule() {
+    if (m_maxExecTime.load(std::memory_order_relaxed) == 0) {
+        return;
+    }
+    threadSlot().deadline = 0;
+}
+
+size_t WatchDog::hangs() const { return m_hangs; }
+
+void WatchDog::run() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (m_running) {
+        // set before reading the deadlines, beginModule() stores its
+        // deadline before reading the flag
+        m_idle = true;
+        m_notified = false;
+
+        const std::int64_t now = Time::now().micros();
+        std::int64_t next = 0;
+        for (auto &slot : m_slots) {
+            const std::int64_t deadline = slot->deadline;
+            if (deadline == 0) {
+                continue;
+            }
+            const std::uint64_t sequence = slot->sequence;
+            if (deadline <= now) {
+                if (slot->reported != sequence) {
+                    slot->reported = sequence;
+                    // read after the sequence, bark() notices a newer module
+                    auto name = m_names.find(slot->module);
+                    m_hung.push_back({slot, sequence, Time::fromMicros(now - deadline),
+                                      name == m_names.end() ? "unknown"
+                                                            : name->second});
                 }
-                lms::Time::fromMillis(100).sleep();
+            } else if (next == 0 || deadline < next) {
+                next = deadline;
+            }
+        }
+
+        // forget threads that finished
+        m_slots.erase(std::remove_if(m_slots.begin(), m_slots.end(),
+                                     [](const std::shared_ptr<Slot> &slot) {
+                                         return slot.use_count() == 1;
+                                     }),
+                      m_slots.end());
+
+        if (!m_hung.empty()) {
+            // capturing a backtrace takes a while, beginModule() of a new
+            // thread must not wait for it
+            lock.unlock();
+            for (const Hang &hang : m_hung) {
+                bark(hang);
             }
-        });
+            m_hung.clear();
+            lock.lock();
+            // deadlines may have passed in the meantime
+            continue;
+        }
+
+        if (next == 0) {
+            m_wakeup.wait(lock, [this]() { return m_notified || !m_running; });
+        } else {
+            m_idle = false;
+            m_wakeup.wait_for(lock, std::chrono::microseconds(next - now),
+                              [this]() { return m_notified || !m_running; });
+        }
     }
+    m_idle = false;
 }
 
-void WatchDog::beginModule(std::string const &module) {
-    m_executionThread = pthread_self();
-    m_moduleBegin = Time::now();
-    m_currentModule = module;
-    m_hasModule = true;
-    m_barked = false;
-}
+void WatchDog::bark(const Hang &hang) {
+    Slot &slot = *hang.slot;
+    const std::string &module = hang.module;
+    if (slot.sequence != hang.sequence) {
+        // finished in the meantime
+        return;
+    }
 
-void WatchDog::endModule() { m_hasModule = false; }
+    m_hangs++;
+    logger.error() << "Module hangs: " << module << " on thread " << slot.index
+                   << ", running for "
+                   << Time::fromMicros(m_maxExecTime) + hang.late;
 
-WatchDog::~WatchDog() {
-    m_running = false;
-    if (m_thread.joinable()) {
-        m_thread.join();
+    std::lock_guard<std::mutex> lock(m_stackMutex);
+    if (!m_captureStacks) {
+        return;
+    }
+
+    const std::string file = "/tmp/lms-hang-" + std::to_string(getpid()) + "-" +
+                             std::to_string(std::time(NULL)) + ".txt";
+    const int fd = open(file.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        logger.error() << "Could not open " << file;
+        return;
+    }
+
+    hangCaptured = false;
+    hangFd = fd;
+    pthread_kill(slot.thread, SIGUSR1);
+    for (int i = 0; i < 100 && !hangCaptured; i++) {
+        Time::fromMillis(1).sleep();
+    }
+    if (hangFd.exchange(-1) == -1) {
+        // the handler took the file, it must finish before closing it
+        while (!hangCaptured) {
+            Time::fromMillis(1).sleep();
+        }
+        logger.error() << "Backtrace of " << module << " written to " << file;
+    } else {
+        logger.error() << "Could not capture the backtrace of " << module;
+    }
+    close(fd);
+}
+
+void WatchDog::signal(int signal) {
+    if (signal != SIGUSR1) {
+        return;
+    }
+    // runs in the hung thread, only async-signal-safe calls
+    const int fd = hangFd.exchange(-1);
+    if (fd < 0) {
+        return;
     }
+    void *buffer[64];
+    const int size = backtrace(buffer, 64);
+    backtrace_symbols_fd(buffer, size, fd);
+    hangCaptured = true;
 }
 
 } // namespace internal
@@ -1,33 +1,128 @@
 #ifndef LMS_INTERNAL_WATCH_DOG_H
 #define LMS_INTERNAL_WATCH_DOG_H
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <pthread.h>
+
 #include "lms/time.h"
 #include "lms/logger.h"
-#include <thread>
+#include "signalhandler.h"
 
 namespace lms {
+
+class Module;
+
 namespace internal {
 
-class WatchDog {
+/**
+ * @brief Reports modules whose cycle() takes longer than a maximum time.
+ *
+ * Every thread that executes modules gets its own slot, registered on its
+ * first beginModule(). beginModule() and endModule() only store atomics,
+ * the name of a hung module is looked up when the hang is reported.
+ *
+ * The watcher thread sleeps until the earliest deadline of all running
+ * modules instead of polling, so a hang is reported right after the
+ * maximum time. If stack capture is enabled the hung thread is interrupted
+ * with SIGUSR1 and writes its backtrace to /tmp/lms-hang-<pid>-<time>.txt.
+ */
+class WatchDog : public SignalHandler::Listener {
 public:
     WatchDog();
     ~WatchDog();
 
-    void watch(lms::Time maxExecTime);
-    void beginModule(std::string const &module);
+    /**
+     * @brief Start watching or change the settings, Time::ZERO stops the
+     * watcher.
+     * @param maxExecTime maximum duration of a module's cycle()
+     * @param captureStacks write the backtrace of hung threads
+     */
+    void watch(lms::Time maxExecTime, bool captureStacks = false);
+
+    /**
+     * @brief Set the name that is reported for a module. The module is never
+     * dereferenced, a new module at the same address must be named again.
+     */
+    void moduleName(const Module *module, const std::string &name);
+
+    /**
+     * @brief The calling thread starts executing the given module.
+     */
+    void beginModule(const Module *module);
+
+    /**
+     * @brief The calling thread finished its module.
+     */
     void endModule();
 
+    /**
+     * @brief Number of hangs that were reported.
+     */
+    size_t hangs() const;
+
+    void signal(int signal) override;
+
 private:
+    struct Slot {
+        // Time::micros() of the deadline, 0 if no module is running
+        std::atomic<std::int64_t> deadline;
+        // incremented by each beginModule()
+        std::atomic<std::uint64_t> sequence;
+        // last sequence that was reported, only used by the watcher
+        std::uint64_t reported;
+        // module of the current sequence, stored before it is incremented
+        std::atomic<const Module *> module;
+        pthread_t thread;
+        size_t index;
+        Slot() : deadline(0), sequence(0), reported(0), module(nullptr) {}
+    };
+
+    // hung module found by the watcher, reported without holding m_mutex
+    struct Hang {
+        std::shared_ptr<Slot> slot;
+        std::uint64_t sequence;
+        lms::Time late;
+        std::string module;
+    };
+
+    Slot &threadSlot();
+    void run();
+    void bark(const Hang &hang);
+    void stop();
+
     logging::Logger logger;
+    const unsigned long m_id;
 
-    lms::Time m_moduleBegin;
-    std::string m_currentModule;
-    bool m_hasModule;
-    bool m_barked;
+    // maximum execution time in micros, 0 if disabled
+    std::atomic<std::int64_t> m_maxExecTime;
+    std::atomic<size_t> m_hangs;
 
-    std::thread m_thread;
+    // protects m_captureStacks and the SIGUSR1 listener, held while a
+    // backtrace is captured
+    std::mutex m_stackMutex;
+    bool m_captureStacks;
+
+    // protects m_slots, m_names and the watcher's sleep
+    std::mutex m_mutex;
+    std::map<const Module *, std::string> m_names;
+    std::condition_variable m_wakeup;
+    std::vector<std::shared_ptr<Slot>> m_slots;
+    size_t m_nextIndex;
+    // watcher waits without a deadline, beginModule() must wake it up
+    std::atomic<bool> m_idle;
+    bool m_notified;
     bool m_running;
-    pthread_t m_executionThread;
+    std::thread m_thread;
+    // only used by the watcher
+    std::vector<Hang> m_hung;
 };
 
 } // namespace internal
@@ -0,0 +1,20 @@
+#include "work_notifier.h"
+
+namespace lms {
+namespace internal {
+
+bool waitPolicyFromName(const std::string &name, WaitPolicy &policy) {
+    if (name == "block") {
+        policy = WaitPolicy::BLOCK;
+    } else if (name == "spin") {
+        policy = WaitPolicy::SPIN_THEN_BLOCK;
+    } else if (name == "busySpin") {
+        policy = WaitPolicy::BUSY_SPIN;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+}  // namespace internal
+}  // namespace lms
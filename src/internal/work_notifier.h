@@ -0,0 +1,119 @@
+#ifndef LMS_INTERNAL_WORK_NOTIFIER_H
+#define LMS_INTERNAL_WORK_NOTIFIER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+
+#include "lms/time.h"
+
+namespace lms {
+namespace internal {
+
+/**
+ * @brief How idle threads wait for new work.
+ */
+enum class WaitPolicy {
+    /** sleep on a condition variable, no CPU usage while idle */
+    BLOCK,
+    /** spin for a short time, then sleep */
+    SPIN_THEN_BLOCK,
+    /** never sleep, lowest wakeup latency but keeps every idle thread busy */
+    BUSY_SPIN
+};
+
+/**
+ * @brief Parse "block", "spin" or "busySpin".
+ * @return false if the name is unknown
+ */
+bool waitPolicyFromName(const std::string &name, WaitPolicy &policy);
+
+/**
+ * @brief Condition variable replacement for threads that wait for a condition
+ * protected by a mutex, with a configurable WaitPolicy.
+ *
+ * Every notify() increments a counter. Spinning threads watch the counter
+ * without holding the mutex, so they are woken up without a system call.
+ * The condition variable is only signaled if a thread actually sleeps on it.
+ *
+ * All methods must be called with the mutex locked.
+ */
+class WorkNotifier {
+public:
+    WorkNotifier()
+        : m_version(0), m_blocked(0), m_policy(WaitPolicy::BLOCK),
+          m_spinTime(lms::Time::fromMicros(50)) {}
+
+    void policy(WaitPolicy policy) { m_policy = policy; }
+    WaitPolicy policy() const { return m_policy; }
+
+    /**
+     * @brief Maximum time to spin with SPIN_THEN_BLOCK.
+     */
+    void spinTime(lms::Time time) { m_spinTime = time; }
+    lms::Time spinTime() const { return m_spinTime; }
+
+    /**
+     * @brief Wake up all waiting threads.
+     */
+    void notify() {
+        m_version.fetch_add(1, std::memory_order_release);
+        if (m_blocked > 0) {
+            m_cv.notify_all();
+        }
+    }
+
+    /**
+     * @brief Wait until ready() returns true.
+     * @param lock locked lock of the mutex that protects the condition
+     * @param ready predicate that is called with the lock held
+     */
+    template <typename Predicate>
+    void wait(std::unique_lock<std::mutex> &lock, Predicate ready) {
+        while (!ready()) {
+            if (m_policy != WaitPolicy::BLOCK) {
+                const unsigned version = m_version.load(std::memory_order_relaxed);
+                const bool forever = m_policy == WaitPolicy::BUSY_SPIN;
+                const lms::Time deadline = lms::Time::now() + m_spinTime;
+                lock.unlock();
+                const bool notified = spin(version, forever, deadline);
+                lock.lock();
+                if (notified) {
+                    continue;
+                }
+            }
+            m_blocked++;
+            m_cv.wait(lock, ready);
+            m_blocked--;
+        }
+    }
+
+private:
+    std::condition_variable m_cv;
+    std::atomic<unsigned> m_version;
+    // threads sleeping on m_cv
+    int m_blocked;
+    WaitPolicy m_policy;
+    lms::Time m_spinTime;
+
+    bool spin(unsigned version, bool forever, lms::Time deadline) const {
+        for (unsigned i = 1;; i++) {
+            if (m_version.load(std::memory_order_acquire) != version) {
+                return true;
+            }
+#if defined(__i386__) || defined(__x86_64__)
+            __builtin_ia32_pause();
+#endif
+            // reading the clock is more expensive than checking the counter
+            if (!forever && i % 64 == 0 && lms::Time::now() > deadline) {
+                return false;
+            }
+        }
+    }
+};
+
+}  // namespace internal
+}  // namespace lms
+
+#endif  // LMS_INTERNAL_WORK_NOTIFIER_H
@@ -153,6 +153,7 @@ bool XmlParser::parseClock(pugi::xml_node node, ClockInfo &info) {
     pugi::xml_attribute unitAttr = node.attribute("unit");
     pugi::xml_attribute valueAttr = node.attribute("value");
     pugi::xml_attribute watchDog = node.attribute("watchDog");
+    pugi::xml_attribute watchDogStacks = node.attribute("watchDogStacks");
 
     info.slowWarnings = true;
 
@@ -209,6 +210,10 @@ bool XmlParser::parseClock(pugi::xml_node node, ClockInfo &info) {
         }
     }
 
+    if (watchDogStacks) {
+        info.watchDogStacks = watchDogStacks.as_bool();
+    }
+
     return true;
 }
 
@@ -227,6 +232,7 @@ bool XmlParser::parseModule(pugi::xml_node node, ModuleInfo &info) {
     pugi::xml_attribute libAttr = node.attribute("lib");
     pugi::xml_attribute classAttr = node.attribute("class");
     pugi::xml_attribute mainThreadAttr = node.attribute("mainThread");
+    pugi::xml_attribute initAfterAttr = node.attribute("initAfter");
     pugi::xml_attribute logLevelAttr = node.attribute("log");
 
     if(! nameAttr) return errorMissingAttr(node, nameAttr);
@@ -237,6 +243,9 @@ bool XmlParser::parseModule(pugi::xml_node node, ModuleInfo &info) {
     info.lib = libAttr.as_string();
     info.clazz = classAttr.as_string();
     info.mainThread = mainThreadAttr.as_bool();
+    if (initAfterAttr) {
+        info.initAfter = split(initAfterAttr.value(), ',');
+    }
 
     logging::Level defaultLevel = logging::Level::ALL;
     if (logLevelAttr) {
@@ -305,7 +314,9 @@ bool XmlParser::parseService(pugi::xml_node node, ServiceInfo &info) {
     pugi::xml_attribute nameAttr = node.attribute("name");
     pugi::xml_attribute libAttr = node.attribute("lib");
     pugi::xml_attribute classAttr = node.attribute("class");
+    pugi::xml_attribute initAfterAttr = node.attribute("initAfter");
     pugi::xml_attribute logLevelAttr = node.attribute("log");
+    pugi::xml_attribute workersAttr = node.attribute("workers");
 
     if(! nameAttr) return errorMissingAttr(node, nameAttr);
     if(! libAttr) return errorMissingAttr(node, libAttr);
@@ -314,6 +325,12 @@ bool XmlParser::parseService(pugi::xml_node node, ServiceInfo &info) {
     info.name = nameAttr.as_string();
     info.lib = libAttr.as_string();
     info.clazz = classAttr.as_string();
+    if (initAfterAttr) {
+        info.initAfter = split(initAfterAttr.value(), ',');
+    }
+    if (workersAttr) {
+        info.workers = workersAttr.as_uint();
+    }
 
     logging::Level defaultLevel = logging::Level::ALL;
     if (logLevelAttr) {
@@ -358,6 +375,139 @@ bool XmlParser::parseLibrary(pugi::xml_node node, LibraryInfo &info) {
     return true;
 }
 
+bool XmlParser::parseFlightRecorder(pugi::xml_node node,
+                                    FlightRecorderInfo &info) {
+    pugi::xml_attribute secondsAttr = node.attribute("seconds");
+    pugi::xml_attribute framesAttr = node.attribute("frames");
+
+    if (!secondsAttr && !framesAttr) {
+        return errorMissingAttr(node, secondsAttr);
+    }
+
+    if (secondsAttr) {
+        info.duration = Time::fromMicros(
+            static_cast<Time::TimeType>(secondsAttr.as_double() * 1000000));
+    }
+    if (framesAttr) {
+        info.frames = framesAttr.as_uint();
+    }
+
+    for (pugi::xml_node channelNode : node.children("channel")) {
+        info.channels.push_back(trim(channelNode.child_value()));
+    }
+
+    info.enabled = true;
+    return true;
+}
+
+bool XmlParser::parseSharedChannel(pugi::xml_node node,
+                                   SharedChannelInfo &info) {
+    pugi::xml_attribute nameAttr = node.attribute("name");
+    pugi::xml_attribute modeAttr = node.attribute("mode");
+    pugi::xml_attribute slotsAttr = node.attribute("slots");
+
+    if (!nameAttr) {
+        return errorMissingAttr(node, nameAttr);
+    }
+    if (!modeAttr) {
+        return errorMissingAttr(node, modeAttr);
+    }
+
+    info.name = nameAttr.as_string();
+    // the name becomes part of the shm_open() name, which must not contain
+    // any further slashes
+    if (info.name.empty() || info.name.find('/') != std::string::npos) {
+        return errorInvalidAttr(node, nameAttr, "non-empty name without /");
+    }
+    std::string mode = modeAttr.as_string();
+    if (mode == "write") {
+        info.writer = true;
+    } else if (mode == "read") {
+        info.writer = false;
+    } else {
+        return errorInvalidAttr(node, modeAttr, "read/write");
+    }
+
+    if (slotsAttr) {
+        info.slots = slotsAttr.as_uint();
+        if (info.slots < 2) {
+            return errorInvalidAttr(node, slotsAttr, "at least 2");
+        }
+    }
+
+    return true;
+}
+
+bool XmlParser::parseExecution(pugi::xml_node node, ExecutionInfo &info) {
+    pugi::xml_attribute threadsAttr = node.attribute("threads");
+    pugi::xml_attribute elasticAttr = node.attribute("elastic");
+    pugi::xml_attribute initThreadsAttr = node.attribute("initThreads");
+    pugi::xml_attribute policyAttr = node.attribute("waitPolicy");
+    pugi::xml_attribute spinAttr = node.attribute("spinMicros");
+    pugi::xml_attribute raceAttr = node.attribute("raceDetection");
+    pugi::xml_attribute partitionsAttr = node.attribute("partitions");
+
+    if (threadsAttr) {
+        info.multithreading = true;
+        if (std::string("auto") == threadsAttr.value()) {
+            info.threads = 0;
+        } else {
+            info.threads = threadsAttr.as_int();
+            if (info.threads < 1) {
+                return errorInvalidAttr(node, threadsAttr, "auto or at least 1");
+            }
+        }
+    }
+
+    if (elasticAttr) {
+        info.elastic = elasticAttr.as_bool();
+    }
+
+    if (initThreadsAttr) {
+        if (std::string("auto") == initThreadsAttr.value()) {
+            info.initThreads = 0;
+        } else {
+            info.initThreads = initThreadsAttr.as_int();
+            if (info.initThreads < 1) {
+                return errorInvalidAttr(node, initThreadsAttr, "auto or at least 1");
+            }
+        }
+    }
+
+    if (policyAttr) {
+        if (!waitPolicyFromName(policyAttr.value(), info.waitPolicy)) {
+            return errorInvalidAttr(node, policyAttr, "block/spin/busySpin");
+        }
+    }
+
+    if (spinAttr) {
+        info.spinTime = Time::fromMicros(spinAttr.as_llong());
+    }
+
+    if (raceAttr) {
+        info.raceDetection = raceAttr.as_bool();
+    }
+
+    if (partitionsAttr) {
+        info.partitions = partitionsAttr.as_bool();
+    }
+
+    for (pugi::xml_node child : node.children("detach")) {
+        pugi::xml_attribute moduleAttr = child.attribute("module");
+        if (!moduleAttr) {
+            errorMissingAttr(child, moduleAttr);
+            continue;
+        }
+        DetachedPartitionInfo detached;
+        detached.module = moduleAttr.value();
+        if (parseClock(child, detached.clock)) {
+            info.detached.push_back(detached);
+        }
+    }
+
+    return true;
+}
+
 bool XmlParser::parseFile(std::istream &is, const std::string &file) {
     PutOnStack<std::string> put(m_filestack, file);
     m_files.push_back(file);
@@ -391,6 +541,25 @@ bool XmlParser::parseFile(std::istream &is, const std::string &file) {
             if(parseLibrary(node, library)) {
                 runtime.libraries.push_back(library);
             }
+        } else if(std::string("flightRecorder") == node.name()) {
+            parseFlightRecorder(node, runtime.flightRecorder);
+        } else if(std::string("sharedChannel") == node.name()) {
+            SharedChannelInfo channel;
+            if(parseSharedChannel(node, channel)) {
+                runtime.sharedChannels.push_back(channel);
+            }
+        } else if(std::string("execution") == node.name()) {
+            parseExecution(node, runtime.execution);
+        } else if(std::string("hotReload") == node.name()) {
+            pugi::xml_attribute enabledAttr = node.attribute("enabled");
+            runtime.hotReload = !enabledAttr || enabledAttr.as_bool();
+        } else if(std::string("schedule") == node.name()) {
+            pugi::xml_attribute srcAttr = node.attribute("src");
+            if(! srcAttr) {
+                errorMissingAttr(node, srcAttr);
+            } else {
+                runtime.schedule = dirname(m_filestack.top()) + "/" + srcAttr.value();
+            }
         } else {
             errorUnknownNode(node);
         }
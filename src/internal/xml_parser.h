@@ -11,6 +11,7 @@
 #include "lms/config.h"
 #include "lms/logging/level.h"
 #include "lms/time.h"
+#include "work_notifier.h"
 
 namespace lms {
 namespace internal {
@@ -20,6 +21,8 @@ struct ModuleInfo {
     std::string lib;
     std::string clazz;
     bool mainThread = false;
+    // modules that must be initialized before this one
+    std::vector<std::string> initAfter;
     std::map<std::string, std::pair<std::string, int>> channelMapping;
     std::map<std::string, lms::Config> configs;
     lms::logging::Level log;
@@ -38,8 +41,12 @@ struct ServiceInfo {
     std::string name;
     std::string lib;
     std::string clazz;
+    // services that must be initialized before this one
+    std::vector<std::string> initAfter;
     std::map<std::string, lms::Config> configs;
     lms::logging::Level log;
+    // threads that run the service's asynchronous operations
+    size_t workers = 1;
 };
 
 struct ClockInfo {
@@ -48,6 +55,8 @@ struct ClockInfo {
     bool sleepCompensate = false;
     lms::Time watchDog;
     bool watchDogEnabled = false;
+    // write the backtrace of hung threads
+    bool watchDogStacks = false;
     bool slowWarnings = false;
 };
 
@@ -55,8 +64,50 @@ struct LibraryInfo {
     std::string lib;
 };
 
+struct FlightRecorderInfo {
+    bool enabled = false;
+    lms::Time duration;
+    size_t frames = 0;
+    std::vector<std::string> channels;
+};
+
+struct SharedChannelInfo {
+    std::string name;
+    bool writer = false;
+    std::uint32_t slots = 4;
+};
+
+struct DetachedPartitionInfo {
+    // any module of the partition
+    std::string module;
+    ClockInfo clock;
+};
+
+struct ExecutionInfo {
+    bool multithreading = false;
+    // 0 selects the number of hardware threads
+    int threads = 0;
+    bool elastic = true;
+    // threads for init() and destroy(), 0 selects the number of hardware
+    // threads. Parallel init is opt-in, see Module::init().
+    int initThreads = 1;
+    WaitPolicy waitPolicy = WaitPolicy::BLOCK;
+    lms::Time spinTime = lms::Time::fromMicros(50);
+    bool raceDetection = false;
+    // dedicated worker threads for independent parts of the module graph
+    bool partitions = false;
+    std::vector<DetachedPartitionInfo> detached;
+};
+
 struct RuntimeInfo {
     ClockInfo clock;
+    ExecutionInfo execution;
+    FlightRecorderInfo flightRecorder;
+    std::vector<SharedChannelInfo> sharedChannels;
+    // reload modules when their lib changes, <hotReload enabled="true" />
+    bool hotReload = false;
+    // module order saved by `lms schedule`, <schedule src="lms.schedule" />
+    std::string schedule;
     std::vector<ModuleInfo> modules;
     std::vector<ServiceInfo> services;
     std::vector<LibraryInfo> libraries;
@@ -152,6 +203,52 @@ public:
 
     bool parseLibrary(pugi::xml_node node, LibraryInfo &info);
 
+    /**
+     * @brief Parse the given XML node as <flightRecorder>
+     *
+     * Example:
+     * <flightRecorder seconds="10">
+     *   <channel>IMAGE</channel>
+     *   <channel>CAR_STATE</channel>
+     * </flightRecorder>
+     *
+     * Instead of seconds the number of recorded cycles can be given by the
+     * frames attribute.
+     */
+    bool parseFlightRecorder(pugi::xml_node node, FlightRecorderInfo &info);
+
+    /**
+     * @brief Parse the given XML node as <sharedChannel>
+     *
+     * Example:
+     * <sharedChannel name="IMAGE" mode="write" slots="4" />
+     *
+     * mode is either "read" or "write", slots is optional.
+     */
+    bool parseSharedChannel(pugi::xml_node node, SharedChannelInfo &info);
+
+    /**
+     * @brief Parse <execution> tag.
+     *
+     * Example:
+     * <execution threads="4" waitPolicy="spin" spinMicros="50" elastic="true" />
+     *
+     * threads="auto" uses the number of hardware threads. Services and
+     * modules are initialized sequentially unless initThreads is set to a
+     * number or "auto", which requires their init() to be thread-safe.
+     * destroy() always runs sequentially in reverse init order. raceDetection="true" reports modules that may access a
+     * channel concurrently.
+     *
+     * partitions="true" splits the module graph into parts without channels
+     * between them and gives each part its own worker threads. A part can
+     * run detached from the main cycle on its own thread with its own clock:
+     *
+     * <execution threads="4" partitions="true">
+     *   <detach module="lidar_importer" value="10" unit="hz" sleep="true" />
+     * </execution>
+     */
+    bool parseExecution(pugi::xml_node node, ExecutionInfo &info);
+
     bool parseFile(std::istream &is, const std::string &file);
     bool parseFile(const std::string &file);
 
@@ -52,6 +52,13 @@ void Context::processMessage(const Event &message) {
     }
 }
 
+void Context::flush() {
+    std::lock_guard<std::mutex> lock(dfunc()->loggingMutex);
+    for (size_t i = 0; i < dfunc()->m_sinks.size(); i++) {
+        dfunc()->m_sinks[i]->flush();
+    }
+}
+
 void Context::resetProfiling() {
     std::lock_guard<std::mutex> lock(dfunc()->profilerMutex);
     dfunc()->profiler.reset();
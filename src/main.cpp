@@ -28,6 +28,11 @@ int main(int argc, char *argv[]) {
         exit(0);
     }
 
+    // runs locally, without the master server
+    if(argc >= 2 && strcmp("schedule", argv[1]) == 0) {
+        return lms::internal::schedule(argc, argv);
+    }
+
     try {
         lms::internal::connectToMaster(argc, argv);
     } catch (lms::LmsException &ex) {
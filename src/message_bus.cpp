@@ -0,0 +1,47 @@
+#include "lms/message_bus.h"
+
+namespace lms {
+
+constexpr int TopicBase::UNASSIGNED;
+constexpr size_t MessageBus::DEFAULT_CAPACITY;
+
+MessageBus::MessageBus() : logger("MessageBus"), m_usersChanged(false) {}
+
+void MessageBus::swap(int domain) {
+    // only taken by topics that are resolved at the same time
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto &pair : m_topics) {
+        TopicBase &topic = *pair.second;
+        if (topic.domain != domain) {
+            continue;
+        }
+        size_t dropped = topic.swap();
+        if (dropped > 0) {
+            logger.warn("swap") << "Topic " << topic.name << " dropped "
+                                << dropped << " messages, capacity is "
+                                << topic.capacity;
+        }
+    }
+}
+
+std::map<std::string, std::set<const void *>> MessageBus::users() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::map<std::string, std::set<const void *>> result;
+    for (const auto &pair : m_topics) {
+        result[pair.first] = pair.second->users;
+    }
+    return result;
+}
+
+void MessageBus::assignDomains(
+    const std::function<int(const std::set<const void *> &)> &domainOf) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_usersChanged = false;
+    for (auto &pair : m_topics) {
+        pair.second->domain = domainOf(pair.second->users);
+    }
+}
+
+bool MessageBus::usersChanged() const { return m_usersChanged.load(); }
+
+}  // namespace lms
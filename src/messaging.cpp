@@ -1,13 +1,47 @@
+#include <algorithm>
+#include <atomic>
+
 #include "lms/messaging.h"
 
 namespace lms {
 
-Messaging::Messaging() {}
+namespace {
+
+std::atomic<unsigned long> nextMessagingId(0);
+
+}  // namespace
+
+Messaging::Messaging() : id(nextMessagingId++) {}
+
+Messaging::SendBuffer &Messaging::threadBuffer() {
+    typedef std::pair<unsigned long, std::shared_ptr<SendBuffer>> Entry;
+    // usually one entry per thread, detached partitions add one each
+    static thread_local std::vector<Entry> cache;
+
+    for (const Entry &entry : cache) {
+        if (entry.first == id) {
+            return *entry.second;
+        }
+    }
+
+    // forget buffers of destroyed instances
+    cache.erase(std::remove_if(cache.begin(), cache.end(),
+                               [](const Entry &entry) {
+                                   return entry.second.use_count() == 1;
+                               }),
+                cache.end());
+
+    std::shared_ptr<SendBuffer> buffer = std::make_shared<SendBuffer>();
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        sendBuffers.push_back(buffer);
+    }
+    cache.push_back(Entry(id, buffer));
+    return *buffer;
+}
 
 void Messaging::send(const std::string &command, const std::string &content) {
-    // do not allow concurrent access to the send queue
-    std::lock_guard<std::mutex> lock(mtx);
-    sendQueue[command].push_back(content);
+    threadBuffer().push_back(std::make_pair(command, content));
 }
 
 const std::list<std::string> &
@@ -24,8 +58,22 @@ Messaging::receive(const std::string &command) const {
 }
 
 void Messaging::resetQueue() {
-    receiveQueue = std::move(sendQueue);
-    sendQueue.clear();
+    receiveQueue.clear();
+
+    std::lock_guard<std::mutex> lock(mtx);
+    for (const auto &buffer : sendBuffers) {
+        for (auto &message : *buffer) {
+            receiveQueue[message.first].push_back(std::move(message.second));
+        }
+        buffer->clear();
+    }
+
+    // drop buffers of finished threads
+    sendBuffers.erase(std::remove_if(sendBuffers.begin(), sendBuffers.end(),
+                                     [](const std::shared_ptr<SendBuffer> &buffer) {
+                                         return buffer.use_count() == 1;
+                                     }),
+                      sendBuffers.end());
 }
 
 } // namespace lms
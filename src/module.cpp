@@ -9,6 +9,10 @@ namespace lms {
 struct Module::Private {
     lms::internal::Framework *m_fw;
     lms::internal::ModuleInfo m_info;
+    std::map<std::string, std::unique_ptr<ConfigBinding>> m_bindings;
+    // requested channels by unmapped name, the first request of each one
+    // adds the access to the module graph
+    std::map<std::string, std::shared_ptr<DataChannelInternal>> m_channels;
 };
 
 Module::Module() : logger(""), dptr(new Private) {}
@@ -29,6 +33,12 @@ void Module::configsChanged() {}
 bool Module::initBase(const internal::ModuleInfo &info, internal::Framework *fw) {
     dfunc()->m_info = info;
     dfunc()->m_fw = fw;
+    // channel mappings may have changed
+    dfunc()->m_channels.clear();
+
+    for (auto &binding : dfunc()->m_bindings) {
+        binding.second->update(dfunc()->m_info.configs[binding.first]);
+    }
 
     logger.name = info.name;
     logger.threshold = info.log;
@@ -46,6 +56,14 @@ lms_EXPORT const Config &Module::config(const std::string &name) {
     return dfunc()->m_info.configs[name];
 }
 
+lms_EXPORT ConfigBinding &Module::configBinding(const std::string &name) {
+    std::unique_ptr<ConfigBinding> &binding = dfunc()->m_bindings[name];
+    if (!binding) {
+        binding.reset(new ConfigBinding(dfunc()->m_info.configs[name]));
+    }
+    return *binding;
+}
+
 lms_EXPORT bool Module::hasConfig(const std::string &name) {
     return dfunc()->m_info.configs.find(name) != dfunc()->m_info.configs.end();
 }
@@ -85,11 +103,22 @@ std::string Module::mapChannel(const std::string &channelName) {
     return dfunc()->m_info.mapChannel(channelName).first;
 }
 
+std::shared_ptr<DataChannelInternal>
+Module::requestedChannel(const std::string &channelName) const {
+    auto it = dfunc()->m_channels.find(channelName);
+    return it == dfunc()->m_channels.end() ? nullptr : it->second;
+}
+
+void Module::rememberChannel(const std::string &channelName,
+                             const std::shared_ptr<DataChannelInternal> &channel) {
+    dfunc()->m_channels[channelName] = channel;
+}
+
 void Module::gainReadAccess(const std::string &channelName) {
     auto mapped = dfunc()->m_info.mapChannel(channelName);
     if(dfunc()->m_fw->executionManager().getModuleChannelGraph().readChannel(mapped.first, this,
                                                             mapped.second)) {
-        dfunc()->m_fw->executionManager().invalidate();
+        dfunc()->m_fw->executionManager().channelAccessAdded(mapped.first, this);
     }
 }
 
@@ -97,23 +126,32 @@ void Module::gainWriteAccess(const std::string &channelName) {
     auto mapped = dfunc()->m_info.mapChannel(channelName);
     if(dfunc()->m_fw->executionManager().getModuleChannelGraph().writeChannel(mapped.first, this,
                                                              mapped.second)) {
-        dfunc()->m_fw->executionManager().invalidate();
+        dfunc()->m_fw->executionManager().channelAccessAdded(mapped.first, this);
     }
 }
 
 bool Module::isChannelInUse(const std::string &channelName) const {
+    std::lock_guard<std::mutex> lock(dfunc()->m_fw->channelMutex());
     auto mapped = dfunc()->m_info.mapChannel(channelName);
     return dfunc()->m_fw->executionManager().getModuleChannelGraph().hasReaders(mapped.first);
 }
 
 Messaging* Module::messaging() const {
-    LMS_EXCEPTION("Messaging is currently not implemented"); // TODO
+    return &dfunc()->m_fw->executionManager().messaging(this);
+}
+
+MessageBus *Module::messageBus() const {
+    return &dfunc()->m_fw->executionManager().messageBus();
 }
 
 DataManager &Module::datamanager() {
     return dfunc()->m_fw->dataManager();
 }
 
+std::mutex &Module::channelMutex() {
+    return dfunc()->m_fw->channelMutex();
+}
+
 bool Module::pauseRuntime(std::string const &name) {
     logger.error() << "Not implemented";
     return false;
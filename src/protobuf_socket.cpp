@@ -2,71 +2,239 @@
 
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <poll.h>
 #include <unistd.h>
-
-#include <memory>
+#include <climits>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
 
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/io/zero_copy_stream_impl.h>
 
 namespace lms {
 
-ProtobufSocket::ProtobufSocket(int fd) : fd(fd) {}
+namespace {
+
+// messages are appended to the last chunk until it reaches this size
+constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+// number of cleared chunks that are kept for reuse
+constexpr size_t MAX_SPARE_CHUNKS = 4;
+
+constexpr size_t HEADER_SIZE = 4;
+
+}  // namespace
+
+ProtobufSocket::ProtobufSocket(int fd)
+    : fd(fd), m_inOffset(0), m_outOffset(0), m_pending(0) {}
 
 ProtobufSocket::~ProtobufSocket() { }
 
 ProtobufSocket::Error ProtobufSocket::writeMessage(const google::protobuf::Message &message) {
-    int siz = message.ByteSize() + 4;
-    std::unique_ptr<char[]> pkt(new char [siz]);
-    google::protobuf::io::ArrayOutputStream aos(pkt.get(),siz);
-    google::protobuf::io::CodedOutputStream coded_output(&aos);
-    coded_output.WriteLittleEndian32(message.ByteSize());
-    message.SerializeToCodedStream(&coded_output);
+    enqueue(message);
+    return writePending();
+}
 
-    return ::send(fd, pkt.get(),siz,0) != -1 ? OK : ERROR;
+ProtobufSocket::Error ProtobufSocket::writePending() {
+    while(m_pending > 0) {
+        Error err = flush();
+        if(err != OK) {
+            return err;
+        }
+        if(m_pending > 0) {
+            err = waitWritable();
+            if(err != OK) {
+                return err;
+            }
+        }
+    }
+    return OK;
 }
 
 ProtobufSocket::Error ProtobufSocket::readMessage(google::protobuf::Message &message) {
-    char buffer[4];
-    int bytesRead = recv(fd, buffer, 4, MSG_PEEK);
-    if(bytesRead == -1) {
-        // error
-        return ERROR;
-    } else if(bytesRead == 0) {
-        // closed
-        return CLOSED;
+    Error err = OK;
+    while(! nextMessage(message, err)) {
+        if(err != OK) {
+            return err;
+        }
+        err = receive();
+        if(err != OK) {
+            return err;
+        }
     }
+    return OK;
+}
 
-    // parse message length
-    google::protobuf::uint32 messageSize;
-    {
-    google::protobuf::io::ArrayInputStream ais(buffer, 4);
-    google::protobuf::io::CodedInputStream coded_input(&ais);
-    coded_input.ReadLittleEndian32(&messageSize);
+void ProtobufSocket::enqueue(const google::protobuf::Message &message) {
+    const int messageSize = message.ByteSize();
+    std::uint8_t *data = reserve(HEADER_SIZE + messageSize);
+    google::protobuf::io::CodedOutputStream::WriteLittleEndian32ToArray(messageSize, data);
+    // ByteSize() cached the sizes
+    message.SerializeWithCachedSizesToArray(data + HEADER_SIZE);
+}
+
+void ProtobufSocket::enqueue(const char *data, size_t size) {
+    std::uint8_t *frame = reserve(HEADER_SIZE + size);
+    google::protobuf::io::CodedOutputStream::WriteLittleEndian32ToArray(size, frame);
+    memcpy(frame + HEADER_SIZE, data, size);
+}
+
+void ProtobufSocket::enqueue(const SharedFrame &frame) {
+    m_out.emplace_back();
+    m_out.back().shared = frame;
+    m_pending += frame->size();
+}
+
+ProtobufSocket::SharedFrame ProtobufSocket::makeFrame(const char *data, size_t size) {
+    std::shared_ptr<std::string> frame = std::make_shared<std::string>(HEADER_SIZE + size, '\0');
+    google::protobuf::io::CodedOutputStream::WriteLittleEndian32ToArray(
+        size, reinterpret_cast<std::uint8_t *>(&(*frame)[0]));
+    memcpy(&(*frame)[HEADER_SIZE], data, size);
+    return frame;
+}
+
+std::uint8_t *ProtobufSocket::reserve(size_t frameSize) {
+    if(m_out.empty() || m_out.back().shared ||
+            m_out.back().data.size() + frameSize > CHUNK_SIZE) {
+        m_out.emplace_back();
+        if(! m_spare.empty()) {
+            m_out.back().data.swap(m_spare.back());
+            m_spare.pop_back();
+        }
     }
 
-    // parse message
-    {
-    std::unique_ptr<char[]> messageBuffer(new char[4 + messageSize]);
-    bytesRead = recv(fd, messageBuffer.get(), 4+messageSize, MSG_WAITALL);
-    if(bytesRead == -1) {
-        // error
-        return ERROR;
-    } else if(bytesRead == 0) {
-        return CLOSED;
+    std::string &chunk = m_out.back().data;
+    const size_t offset = chunk.size();
+    chunk.resize(offset + frameSize);
+    m_pending += frameSize;
+    return reinterpret_cast<std::uint8_t *>(&chunk[offset]);
+}
+
+ProtobufSocket::Error ProtobufSocket::flush() {
+    while(m_pending > 0) {
+        m_iov.clear();
+        size_t offset = m_outOffset;
+        for(const Chunk &out : m_out) {
+            if(m_iov.size() == IOV_MAX) {
+                break;
+            }
+            const std::string &chunk = out.bytes();
+            iovec iov;
+            iov.iov_base = const_cast<char *>(chunk.data()) + offset;
+            iov.iov_len = chunk.size() - offset;
+            m_iov.push_back(iov);
+            offset = 0;
+        }
+
+        msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = m_iov.data();
+        msg.msg_iovlen = m_iov.size();
+        ssize_t sent = ::sendmsg(fd, &msg, MSG_NOSIGNAL);
+        if(sent == -1) {
+            if(errno == EINTR) {
+                continue;
+            }
+            if(errno == EAGAIN || errno == EWOULDBLOCK) {
+                return OK;
+            }
+            return ERROR;
+        }
+
+        m_pending -= sent;
+        size_t remaining = sent;
+        while(remaining > 0) {
+            Chunk &front = m_out.front();
+            const size_t frontSize = front.bytes().size() - m_outOffset;
+            if(remaining < frontSize) {
+                m_outOffset += remaining;
+                break;
+            }
+            remaining -= frontSize;
+            m_outOffset = 0;
+            if(! front.shared && m_spare.size() < MAX_SPARE_CHUNKS) {
+                front.data.clear();
+                m_spare.push_back(std::move(front.data));
+            }
+            m_out.pop_front();
+        }
     }
-    google::protobuf::io::ArrayInputStream ais(messageBuffer.get(),messageSize+4);
-    google::protobuf::io::CodedInputStream coded_input(&ais);
-    std::uint32_t messageSize2;
-    coded_input.ReadLittleEndian32(&messageSize2);
-    google::protobuf::io::CodedInputStream::Limit msgLimit = coded_input.PushLimit(messageSize);
-    message.ParseFromCodedStream(&coded_input);
-    coded_input.PopLimit(msgLimit);
+    return OK;
+}
+
+size_t ProtobufSocket::pending() const {
+    return m_pending;
+}
+
+ProtobufSocket::Error ProtobufSocket::receive(size_t maxBytes) {
+    // drop parsed bytes, the buffer keeps its capacity
+    if(m_inOffset > 0) {
+        m_in.erase(0, m_inOffset);
+        m_inOffset = 0;
     }
 
+    size_t total = 0;
+    int flags = 0;
+    while(total < maxBytes) {
+        const size_t offset = m_in.size();
+        const size_t readSize = std::min(maxBytes - total, CHUNK_SIZE);
+        m_in.resize(offset + readSize);
+        ssize_t bytesRead = ::recv(fd, &m_in[offset], readSize, flags);
+        m_in.resize(offset + (bytesRead > 0 ? bytesRead : 0));
+
+        if(bytesRead > 0) {
+            total += bytesRead;
+            if(static_cast<size_t>(bytesRead) < readSize) {
+                break;
+            }
+            // only the first call may block
+            flags = MSG_DONTWAIT;
+        } else if(bytesRead == 0) {
+            return total > 0 ? OK : CLOSED;
+        } else if(errno == EINTR) {
+            continue;
+        } else if(errno == EAGAIN || errno == EWOULDBLOCK) {
+            break;
+        } else {
+            return ERROR;
+        }
+    }
     return OK;
 }
 
+bool ProtobufSocket::nextMessage(google::protobuf::Message &message, Error &error) {
+    const char *data;
+    size_t size;
+    if(! nextFrame(data, size)) {
+        return false;
+    }
+    if(! message.ParseFromArray(data, size)) {
+        error = ERROR;
+        return false;
+    }
+    return true;
+}
+
+bool ProtobufSocket::nextFrame(const char *&data, size_t &size) {
+    const size_t available = m_in.size() - m_inOffset;
+    if(available < HEADER_SIZE) {
+        return false;
+    }
+
+    const std::uint8_t *frame =
+        reinterpret_cast<const std::uint8_t *>(m_in.data()) + m_inOffset;
+    google::protobuf::uint32 messageSize;
+    google::protobuf::io::CodedInputStream::ReadLittleEndian32FromArray(frame, &messageSize);
+    if(available < HEADER_SIZE + messageSize) {
+        return false;
+    }
+
+    data = m_in.data() + m_inOffset + HEADER_SIZE;
+    size = messageSize;
+    m_inOffset += HEADER_SIZE + messageSize;
+    return true;
+}
+
 int ProtobufSocket::getFD() const {
     return fd;
 }
@@ -75,4 +243,16 @@ void ProtobufSocket::close() {
     ::close(fd);
 }
 
+ProtobufSocket::Error ProtobufSocket::waitWritable() {
+    pollfd pfd;
+    pfd.fd = fd;
+    pfd.events = POLLOUT;
+    while(::poll(&pfd, 1, -1) == -1) {
+        if(errno != EINTR) {
+            return ERROR;
+        }
+    }
+    return (pfd.revents & (POLLERR | POLLNVAL)) ? ERROR : OK;
+}
+
 }  // namespace lms
@@ -1,16 +1,31 @@
+#include <condition_variable>
+#include <deque>
+#include <thread>
+#include <vector>
+
 #include <lms/service.h>
 #include "internal/xml_parser.h"
 
 namespace lms {
 
 struct Service::Private {
-    std::mutex mutex;
+    SharedMutex mutex;
     lms::internal::ServiceInfo info;
+
+    // worker threads, started on the first queued operation
+    std::mutex workerMutex;
+    std::condition_variable workerCondition;
+    std::deque<std::pair<std::function<void()>, bool>> tasks;
+    std::vector<std::thread> workers;
+    bool stopped = false;
 };
 
 Service::Service() : logger(""), dptr(new Private) {}
 
-Service::~Service() { delete dptr; }
+Service::~Service() {
+    stopWorkers();
+    delete dptr;
+}
 
 bool Service::init() { return true; }
 
@@ -30,8 +45,63 @@ const Config &Service::config(const std::string &name) const {
 
 std::string Service::getName() const { return dfunc()->info.name; }
 
-std::mutex& Service::getMutex() {
+SharedMutex& Service::getMutex() {
     return dfunc()->mutex;
 }
 
+void Service::enqueue(std::function<void()> task, bool serialized) {
+    Private &d = *dfunc();
+    {
+        std::lock_guard<std::mutex> lock(d.workerMutex);
+        if (!d.stopped && d.info.workers > 0) {
+            d.tasks.push_back(std::make_pair(std::move(task), serialized));
+            while (d.workers.size() < d.info.workers) {
+                d.workers.emplace_back([&d]() {
+                    while (true) {
+                        std::unique_lock<std::mutex> lock(d.workerMutex);
+                        d.workerCondition.wait(lock, [&d]() {
+                            return d.stopped || !d.tasks.empty();
+                        });
+                        if (d.tasks.empty()) {
+                            break;
+                        }
+                        auto next = std::move(d.tasks.front());
+                        d.tasks.pop_front();
+                        lock.unlock();
+
+                        if (next.second) {
+                            std::lock_guard<SharedMutex> serviceLock(d.mutex);
+                            next.first();
+                        } else {
+                            next.first();
+                        }
+                    }
+                });
+            }
+            d.workerCondition.notify_one();
+            return;
+        }
+    }
+
+    if (serialized) {
+        std::lock_guard<SharedMutex> serviceLock(d.mutex);
+        task();
+    } else {
+        task();
+    }
+}
+
+void Service::stopWorkers() {
+    Private &d = *dfunc();
+    {
+        std::lock_guard<std::mutex> lock(d.workerMutex);
+        d.stopped = true;
+    }
+    d.workerCondition.notify_all();
+    for (std::thread &worker : d.workers) {
+        worker.join();
+    }
+    d.workers.clear();
+}
+
 } // namespace lms
@@ -0,0 +1,107 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+#include "lms/shared_memory.h"
+#include "lms/exception.h"
+
+namespace lms {
+
+namespace {
+
+constexpr size_t CACHE_LINE = 64;
+
+size_t alignUp(size_t size) {
+    return (size + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+}
+
+std::string segmentName(const std::string &channel) {
+    return "/lms." + channel;
+}
+
+std::uint64_t hashTypeName(const std::string &typeName) {
+    // FNV-1a, must be stable across processes
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (char c : typeName) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+    }
+    // 0 is reserved for unclaimed segments
+    return hash == 0 ? 1 : hash;
+}
+
+} // namespace
+
+SharedMemorySegment::SharedMemorySegment(const std::string &channel,
+                                         std::uint32_t slots, size_t size,
+                                         const std::string &typeName)
+    : m_slots(slots < 2 ? 2 : slots),
+      m_slotSize(alignUp(sizeof(SharedChannelSlot)) + alignUp(size)),
+      m_mappedSize(alignUp(sizeof(SharedChannelHeader)) + m_slots * m_slotSize),
+      m_header(nullptr), m_base(nullptr) {
+    std::string name = segmentName(channel);
+    int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT, 0660);
+    if (fd == -1) {
+        LMS_EXCEPTION("Could not open shared memory " + name + ": " +
+                      std::strerror(errno));
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) == -1 ||
+        (st.st_size == 0 && ::ftruncate(fd, m_mappedSize) == -1)) {
+        ::close(fd);
+        LMS_EXCEPTION("Could not resize shared memory " + name + ": " +
+                      std::strerror(errno));
+    }
+    if (st.st_size != 0 && static_cast<size_t>(st.st_size) != m_mappedSize) {
+        ::close(fd);
+        LMS_EXCEPTION("Shared memory " + name +
+                      " was created with another size or number of slots");
+    }
+
+    void *addr = ::mmap(nullptr, m_mappedSize, PROT_READ | PROT_WRITE,
+                        MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        LMS_EXCEPTION("Could not map shared memory " + name + ": " +
+                      std::strerror(errno));
+    }
+
+    m_base = static_cast<char *>(addr);
+    m_header = reinterpret_cast<SharedChannelHeader *>(m_base);
+
+    // the first runtime claims the segment for its type
+    std::uint64_t expected = 0;
+    std::uint64_t hash = hashTypeName(typeName);
+    if (!m_header->typeHash.compare_exchange_strong(expected, hash) &&
+        expected != hash) {
+        ::munmap(m_base, m_mappedSize);
+        LMS_EXCEPTION("Shared memory " + name +
+                      " was created with another type than " + typeName);
+    }
+}
+
+SharedMemorySegment::~SharedMemorySegment() {
+    if (m_base != nullptr) {
+        ::munmap(m_base, m_mappedSize);
+    }
+}
+
+SharedChannelSlot *SharedMemorySegment::slot(std::uint32_t index) const {
+    return reinterpret_cast<SharedChannelSlot *>(
+        m_base + alignUp(sizeof(SharedChannelHeader)) + index * m_slotSize);
+}
+
+void *SharedMemorySegment::data(std::uint32_t index) const {
+    return reinterpret_cast<char *>(slot(index)) +
+           alignUp(sizeof(SharedChannelSlot));
+}
+
+void SharedMemorySegment::unlink(const std::string &channel) {
+    ::shm_unlink(segmentName(channel).c_str());
+}
+
+} // namespace lms
@@ -0,0 +1,64 @@
+#include <cerrno>
+#include <system_error>
+
+#include "lms/shared_mutex.h"
+
+namespace lms {
+
+namespace {
+
+void check(int result, const char *what) {
+    if (result != 0) {
+        throw std::system_error(result, std::system_category(), what);
+    }
+}
+
+}  // namespace
+
+SharedMutex::SharedMutex() {
+    pthread_rwlockattr_t attr;
+    check(pthread_rwlockattr_init(&attr), "pthread_rwlockattr_init");
+#ifdef __GLIBC__
+    // glibc prefers readers by default, a steady stream of them would
+    // starve exclusive owners
+    pthread_rwlockattr_setkind_np(&attr,
+                                  PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+#endif
+    int result = pthread_rwlock_init(&m_lock, &attr);
+    pthread_rwlockattr_destroy(&attr);
+    check(result, "pthread_rwlock_init");
+}
+
+SharedMutex::~SharedMutex() { pthread_rwlock_destroy(&m_lock); }
+
+void SharedMutex::lock() {
+    check(pthread_rwlock_wrlock(&m_lock), "pthread_rwlock_wrlock");
+}
+
+bool SharedMutex::try_lock() {
+    int result = pthread_rwlock_trywrlock(&m_lock);
+    if (result == EBUSY) {
+        return false;
+    }
+    check(result, "pthread_rwlock_trywrlock");
+    return true;
+}
+
+void SharedMutex::unlock() { pthread_rwlock_unlock(&m_lock); }
+
+void SharedMutex::lock_shared() {
+    check(pthread_rwlock_rdlock(&m_lock), "pthread_rwlock_rdlock");
+}
+
+bool SharedMutex::try_lock_shared() {
+    int result = pthread_rwlock_tryrdlock(&m_lock);
+    if (result == EBUSY) {
+        return false;
+    }
+    check(result, "pthread_rwlock_tryrdlock");
+    return true;
+}
+
+void SharedMutex::unlock_shared() { pthread_rwlock_unlock(&m_lock); }
+
+}  // namespace lms
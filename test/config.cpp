@@ -39,6 +39,16 @@ TEST_F(ConfigTest, empty) {
     ASSERT_TRUE(emptyConfig.empty());
 }
 
+TEST_F(ConfigTest, equals) {
+    lms::Config copy(config);
+    ASSERT_TRUE(copy == config);
+    ASSERT_FALSE(copy != config);
+    ASSERT_FALSE(emptyConfig == config);
+
+    copy.set<int>("width", 301);
+    ASSERT_TRUE(copy != config);
+}
+
 TEST_F(ConfigTest, hasKey) {
     ASSERT_TRUE(config.hasKey("text"));
     ASSERT_TRUE(config.hasKey("ids"));
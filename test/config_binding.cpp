@@ -0,0 +1,96 @@
+#include <iostream>
+#include <sstream>
+
+#include "lms/config_binding.h"
+#include "lms/time.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+lms::Config makeConfig(int width) {
+    lms::Config config;
+    std::istringstream iss("width = " + std::to_string(width) + "\n"
+                           "weights = 0.5, 1.5, 2.5, 3.5, 4.5, 5.5, 6.5, 7.5, \\\n"
+                           "8.5, 9.5, 10.5, 11.5, 12.5, 13.5, 14.5, 15.5\n"
+                           "name = camera\n");
+    config.load(iss);
+    return config;
+}
+
+}  // namespace
+
+TEST(ConfigBinding, get) {
+    lms::ConfigBinding binding(makeConfig(300));
+
+    const int &width = binding.get<int>("width");
+    const std::string &name = binding.get<std::string>("name");
+    const bool &missing = binding.get<bool>("missing", true);
+    const std::vector<float> &weights = binding.getArray<float>("weights");
+
+    EXPECT_EQ(300, width);
+    EXPECT_EQ("camera", name);
+    EXPECT_TRUE(missing);
+    ASSERT_EQ(16u, weights.size());
+    EXPECT_FLOAT_EQ(15.5f, weights[15]);
+
+    // references see the new values
+    binding.update(makeConfig(640));
+    EXPECT_EQ(640, width);
+    EXPECT_EQ(16u, weights.size());
+
+    binding.update(lms::Config());
+    EXPECT_EQ(0, width);
+    EXPECT_TRUE(weights.empty());
+}
+
+TEST(ConfigBinding, sameKeyAndType) {
+    lms::ConfigBinding binding(makeConfig(300));
+
+    // e.g. configBinding().get() called in cycle() binds only once
+    const int &width = binding.get<int>("width");
+    EXPECT_EQ(&width, &binding.get<int>("width", 42));
+    EXPECT_EQ(&binding.getArray<float>("weights"),
+              &binding.getArray<float>("weights"));
+
+    // other types are bound separately
+    const std::string &widthString = binding.get<std::string>("width");
+    const std::vector<int> &widthArray = binding.getArray<int>("width");
+    EXPECT_NE(static_cast<const void *>(&width),
+              static_cast<const void *>(&widthString));
+    EXPECT_EQ("300", widthString);
+    ASSERT_EQ(1u, widthArray.size());
+
+    binding.update(makeConfig(640));
+    EXPECT_EQ(640, width);
+    EXPECT_EQ("640", widthString);
+    EXPECT_EQ(640, widthArray[0]);
+}
+
+TEST(ConfigBinding, benchmark) {
+    const lms::Config config = makeConfig(300);
+    lms::ConfigBinding binding(config);
+    const int &width = binding.get<int>("width");
+    const std::vector<float> &weights = binding.getArray<float>("weights");
+
+    const int iterations = 20000;
+    float sum = 0;
+
+    lms::Time start = lms::Time::now();
+    for (int i = 0; i < iterations; i++) {
+        sum += config.get<int>("width");
+        sum += config.getArray<float>("weights")[i % 16];
+    }
+    const lms::Time parsed = lms::Time::now() - start;
+
+    start = lms::Time::now();
+    for (int i = 0; i < iterations; i++) {
+        sum += width;
+        sum += weights[i % 16];
+    }
+    const lms::Time bound = lms::Time::now() - start;
+
+    std::cout << "Config::get + getArray: " << parsed.micros() * 1000 / iterations
+              << " ns, ConfigBinding: " << bound.micros() * 1000 / iterations
+              << " ns per iteration" << std::endl;
+    EXPECT_GT(sum, 0);
+}
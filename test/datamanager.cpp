@@ -2,6 +2,7 @@
 #include "lms/datamanager.h"
 #include "lms/inheritance.h"
 #include <iostream>
+#include <unistd.h>
 
 struct ChannelType : public lms::Inheritance {
     std::string key;
@@ -168,3 +169,98 @@ TEST(DataManager, publishAndHasNewData) {
     ASSERT_TRUE(chRead1.hasNewData());
     ASSERT_TRUE(chRead2.hasNewData());
 }
+
+struct SharedChannelType {
+    int a;
+    double b;
+};
+
+TEST(DataManager, sharedChannel) {
+    const std::string name = "TEST_SHARED_" + std::to_string(::getpid());
+    lms::SharedMemorySegment::unlink(name);
+
+    // two data managers simulate two runtimes
+    lms::DataManager writer;
+    lms::DataManager reader;
+    writer.shareChannel(name, true, 3);
+    reader.shareChannel(name, false, 3);
+
+    auto chWrite = writer.writeChannel<SharedChannelType>(name);
+    auto chRead = reader.readChannel<SharedChannelType>(name);
+
+    ASSERT_FALSE(chRead.hasNewData());
+
+    chWrite->a = 1;
+    chWrite->b = 2.5;
+    // not visible before publish
+    EXPECT_EQ(0, chRead->a);
+
+    chWrite.publish();
+    ASSERT_TRUE(chRead.hasNewData());
+    const SharedChannelType *value = chRead.get();
+    EXPECT_EQ(1, value->a);
+    EXPECT_EQ(2.5, value->b);
+    EXPECT_TRUE(chRead.consistent());
+
+    // the write slot starts with the last published value
+    EXPECT_EQ(1, chWrite->a);
+
+    // reader's slot is overwritten after slots - 1 publishes
+    chWrite->a = 2;
+    chWrite.publish();
+    EXPECT_TRUE(chRead.consistent());
+    chWrite->a = 3;
+    chWrite.publish();
+    EXPECT_FALSE(chRead.consistent());
+
+    EXPECT_EQ(3, chRead->a);
+    EXPECT_TRUE(chRead.consistent());
+
+    // every handle checks its own last read
+    auto chOther = reader.readChannel<SharedChannelType>(name);
+    chWrite->a = 4;
+    chWrite.publish();
+    EXPECT_EQ(4, chOther->a);
+    chWrite->a = 5;
+    chWrite.publish();
+    EXPECT_FALSE(chRead.consistent());
+    EXPECT_TRUE(chOther.consistent());
+
+    lms::SharedMemorySegment::unlink(name);
+}
+
+TEST(DataManager, sharedChannelTypeMismatch) {
+    const std::string name = "TEST_SHARED_TYPE_" + std::to_string(::getpid());
+    lms::SharedMemorySegment::unlink(name);
+
+    lms::DataManager writer;
+    lms::DataManager reader;
+    writer.shareChannel(name, true);
+    reader.shareChannel(name, false);
+
+    writer.writeChannel<int>(name);
+    EXPECT_THROW(reader.readChannel<float>(name), lms::LmsException);
+
+    lms::SharedMemorySegment::unlink(name);
+}
+
+TEST(DataManager, resetForgetsSharedChannels) {
+    const std::string name = "TEST_SHARED_RESET_" + std::to_string(::getpid());
+    lms::SharedMemorySegment::unlink(name);
+
+    lms::DataManager writer;
+    lms::DataManager reader;
+    writer.shareChannel(name, true);
+    reader.shareChannel(name, false);
+    writer.reset();
+
+    // the channel is local again and never reaches the reader
+    auto chWrite = writer.writeChannel<SharedChannelType>(name);
+    auto chRead = reader.readChannel<SharedChannelType>(name);
+    chWrite->a = 1;
+    chWrite.publish();
+    EXPECT_FALSE(chRead.hasNewData());
+    EXPECT_EQ(0, chRead->a);
+
+    lms::SharedMemorySegment::unlink(name);
+}
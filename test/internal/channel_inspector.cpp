@@ -0,0 +1,90 @@
+#include <poll.h>
+
+#include "gtest/gtest.h"
+#include "internal/channel_inspector.h"
+
+using lms::internal::ChannelInspector;
+
+namespace {
+
+struct InspectedType : public lms::Serializable {
+    int value = 0;
+
+    void lmsSerialize(std::ostream &os, Type) const override { os << value; }
+    void lmsDeserialize(std::istream &is, Type) override { is >> value; }
+};
+
+bool readable(int fd) {
+    pollfd pfd;
+    pfd.fd = fd;
+    pfd.events = POLLIN;
+    return poll(&pfd, 1, 0) == 1;
+}
+
+}  // namespace
+
+TEST(ChannelInspector, sample) {
+    lms::DataManager dm;
+    dm.writeChannel<InspectedType>("serial")->value = 42;
+    dm.writeChannel<int>("plain");
+
+    ChannelInspector inspector;
+    EXPECT_FALSE(inspector.enabled());
+    inspector.subscribe({"serial", "plain"}, lms::Time::ZERO);
+    ASSERT_TRUE(inspector.enabled());
+
+    EXPECT_FALSE(readable(inspector.eventFd()));
+    inspector.sample(dm, 7);
+    EXPECT_TRUE(readable(inspector.eventFd()));
+
+    std::unique_ptr<ChannelInspector::Snapshot> snapshot;
+    ASSERT_TRUE(inspector.takeSnapshot(snapshot));
+    EXPECT_EQ(7, snapshot->cycle);
+    ASSERT_EQ(2u, snapshot->channels.size());
+    EXPECT_EQ("serial", snapshot->channels[0].name);
+    EXPECT_TRUE(snapshot->channels[0].serializable);
+    EXPECT_EQ("42", snapshot->channels[0].data);
+    EXPECT_EQ("plain", snapshot->channels[1].name);
+    EXPECT_FALSE(snapshot->channels[1].serializable);
+
+    // the eventfd is reset once all snapshots were taken
+    std::unique_ptr<ChannelInspector::Snapshot> none;
+    EXPECT_FALSE(inspector.takeSnapshot(none));
+    EXPECT_FALSE(readable(inspector.eventFd()));
+    inspector.release(std::move(snapshot));
+
+    inspector.subscribe({}, lms::Time::ZERO);
+    EXPECT_FALSE(inspector.enabled());
+}
+
+TEST(ChannelInspector, skipsSamples) {
+    lms::DataManager dm;
+    dm.writeChannel<InspectedType>("serial");
+
+    ChannelInspector inspector;
+    inspector.subscribe({"serial"}, lms::Time::ZERO);
+
+    // the sender holds all snapshots, further samples are skipped
+    for(size_t i = 0; i < ChannelInspector::SNAPSHOTS + 2; i++) {
+        inspector.sample(dm, i);
+    }
+    std::vector<std::unique_ptr<ChannelInspector::Snapshot>> taken;
+    std::unique_ptr<ChannelInspector::Snapshot> snapshot;
+    while(inspector.takeSnapshot(snapshot)) {
+        taken.push_back(std::move(snapshot));
+    }
+    ASSERT_EQ(ChannelInspector::SNAPSHOTS, taken.size());
+    EXPECT_EQ(0, taken[0]->cycle);
+
+    for(auto &s : taken) {
+        inspector.release(std::move(s));
+    }
+
+    // at most one sample per interval
+    inspector.subscribe({"serial"}, lms::Time::fromMillis(60000));
+    inspector.sample(dm, 100);
+    inspector.sample(dm, 101);
+    ASSERT_TRUE(inspector.takeSnapshot(snapshot));
+    EXPECT_EQ(100, snapshot->cycle);
+    EXPECT_FALSE(inspector.takeSnapshot(snapshot));
+}
@@ -1,5 +1,32 @@
+#include <iostream>
+#include <random>
+
 #include "gtest/gtest.h"
 #include "internal/dag.h"
+#include "lms/time.h"
+
+namespace {
+
+/**
+ * @brief Random DAG with edges from lower to higher node numbers.
+ */
+lms::internal::DAG<int> randomDAG(int nodes, int edges, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> dist(0, nodes - 1);
+    lms::internal::DAG<int> g;
+    for (int i = 0; i < nodes; i++) {
+        g.node(i);
+    }
+    for (int i = 0; i < edges; i++) {
+        int a = dist(rng), b = dist(rng);
+        if (a != b) {
+            g.edge(std::min(a, b), std::max(a, b));
+        }
+    }
+    return g;
+}
+
+}  // namespace
 
 TEST(DAG, edge) {
     lms::internal::DAG<int> g;
@@ -102,6 +129,26 @@ TEST(DAG, hasCycle) {
 
     g.edge(3, 1);
     ASSERT_TRUE(g.hasCycle());
+
+    // node 3 depends on a removed node and never gets free
+    lms::internal::DAG<int> h;
+    h.edge(1, 2);
+    h.edge(2, 3);
+    h.removeNode(2);
+    ASSERT_TRUE(h.hasCycle());
+}
+
+TEST(DAG, findCycle) {
+    lms::internal::DAG<int> g;
+    g.edge(0, 1);
+    g.edge(1, 2);
+    g.edge(2, 3);
+    std::vector<int> cycle;
+    ASSERT_FALSE(g.findCycle(cycle));
+
+    g.edge(3, 1);
+    ASSERT_TRUE(g.findCycle(cycle));
+    EXPECT_EQ(std::vector<int>({1, 2, 3}), cycle);
 }
 
 TEST(DAG, empty) {
@@ -139,6 +186,77 @@ TEST(DAG, topoSort) {
 
     g.edge(0, 1);
     ASSERT_FALSE(g.topoSort(result));
+
+    // free nodes are taken in ascending order
+    lms::internal::DAG<int> h;
+    h.edge(5, 0);
+    h.node(3);
+    h.node(1);
+    result.clear();
+    ASSERT_TRUE(h.topoSort(result));
+    EXPECT_EQ(std::vector<int>({1, 3, 5, 0}), result);
+}
+
+TEST(DAG, width) {
+    lms::internal::DAG<int> g;
+    EXPECT_EQ(0u, g.width());
+
+    // 1 -> 2 -> 3 and 1 -> 4 -> 3, 5 alone
+    g.edge(1, 2);
+    g.edge(2, 3);
+    g.edge(1, 4);
+    g.edge(4, 3);
+    g.node(5);
+    EXPECT_EQ(3u, g.width());
+
+    // 2 and 6 are independent although they are on different levels
+    g.edge(1, 6);
+    g.edge(6, 7);
+    g.edge(7, 3);
+    EXPECT_EQ(4u, g.width());
+    EXPECT_EQ(2u, g.width([](int n) { return n == 2 || n == 7; }));
+    EXPECT_EQ(1u, g.width([](int n) { return n == 1 || n == 3; }));
+
+    g.edge(3, 1);
+    EXPECT_EQ(0u, g.width());
+}
+
+TEST(DAG, criticalPath) {
+    lms::internal::DAG<int> g;
+    std::vector<int> path;
+    ASSERT_TRUE(g.criticalPath(path));
+    EXPECT_TRUE(path.empty());
+
+    // 1 -> 2 -> 3 and 1 -> 4 -> 5 -> 3, 6 alone
+    g.edge(1, 2);
+    g.edge(2, 3);
+    g.edge(1, 4);
+    g.edge(4, 5);
+    g.edge(5, 3);
+    g.node(6);
+    ASSERT_TRUE(g.criticalPath(path));
+    EXPECT_EQ(std::vector<int>({1, 4, 5, 3}), path);
+
+    g.edge(3, 1);
+    path.clear();
+    EXPECT_FALSE(g.criticalPath(path));
+}
+
+TEST(DAG, components) {
+    lms::internal::DAG<int> g;
+    EXPECT_TRUE(g.components().empty());
+
+    // 1 -> 4 <- 2, 3 -> 5, 6 alone
+    g.edge(1, 4);
+    g.edge(2, 4);
+    g.edge(3, 5);
+    g.node(6);
+
+    using Components = std::vector<std::vector<int>>;
+    EXPECT_EQ(Components({{1, 2, 4}, {3, 5}, {6}}), g.components());
+
+    g.edge(5, 2);
+    EXPECT_EQ(Components({{1, 2, 3, 4, 5}, {6}}), g.components());
 }
 
 TEST(DAG, countNodes) {
@@ -188,3 +306,46 @@ TEST(DAG, removeTransitiveEdges) {
     ASSERT_TRUE(g.hasEdge(1, 2));
     ASSERT_TRUE(g.hasEdge(2, 3));
 }
+
+TEST(DAG, removeTransitiveEdgesRandom) {
+    lms::internal::DAG<int> g = randomDAG(100, 600, 42);
+    lms::internal::DAG<int> reduced(g);
+    reduced.removeTransitiveEdges();
+
+    for (int from = 0; from < 100; from++) {
+        for (int to = 0; to < 100; to++) {
+            // same reachability
+            ASSERT_EQ(g.hasPath(from, to), reduced.hasPath(from, to));
+
+            // no remaining edge is transitive
+            if (reduced.hasEdge(from, to)) {
+                lms::internal::DAG<int> without(reduced);
+                without.removeEdge(from, to);
+                ASSERT_FALSE(without.hasPath(from, to));
+            }
+        }
+    }
+}
+
+TEST(DAG, benchmark) {
+    const lms::internal::DAG<int> g = randomDAG(1000, 5000, 7);
+
+    lms::Time start = lms::Time::now();
+    std::vector<int> order;
+    ASSERT_TRUE(g.topoSort(order));
+    const lms::Time topoSort = lms::Time::now() - start;
+
+    start = lms::Time::now();
+    ASSERT_FALSE(g.hasCycle());
+    const lms::Time hasCycle = lms::Time::now() - start;
+
+    lms::internal::DAG<int> reduced(g);
+    start = lms::Time::now();
+    reduced.removeTransitiveEdges();
+    const lms::Time transitive = lms::Time::now() - start;
+
+    std::cout << "1000 nodes: topoSort " << topoSort << ", hasCycle "
+              << hasCycle << ", removeTransitiveEdges " << transitive
+              << std::endl;
+    EXPECT_EQ(1000u, order.size());
+}
@@ -0,0 +1,169 @@
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "gtest/gtest.h"
+#include "internal/flight_recorder.h"
+
+using lms::internal::FlightRecorder;
+
+namespace {
+
+struct RecordedType : public lms::Serializable {
+    int value = 0;
+
+    void lmsSerialize(std::ostream &os, Type) const override {
+        os << value << ";";
+    }
+    void lmsDeserialize(std::istream &is, Type) override { is >> value; }
+};
+
+std::string tempDir() {
+    char path[] = "/tmp/lms-flight-recorder-XXXXXX";
+    return mkdtemp(path);
+}
+
+std::string readFile(const std::string &path) {
+    std::ifstream is(path, std::ios::binary);
+    std::stringstream ss;
+    ss << is.rdbuf();
+    return ss.str();
+}
+
+bool exists(const std::string &path) {
+    struct stat info;
+    return ::stat(path.c_str(), &info) == 0;
+}
+
+}  // namespace
+
+TEST(FlightRecorder, wraparound) {
+    lms::DataManager dm;
+    auto channel = dm.writeChannel<RecordedType>("channel");
+
+    FlightRecorder recorder;
+    recorder.configure({"channel"}, 3);
+
+    const std::string dir = tempDir();
+    for (int i = 1; i <= 2; i++) {
+        channel->value = i;
+        recorder.record(dm);
+    }
+    ASSERT_TRUE(recorder.dump(dir + "/partial", lms::MetaFile()));
+    EXPECT_EQ("1;2;", readFile(dir + "/partial/channel"));
+
+    // the oldest frames are overwritten, the dump starts at the oldest kept
+    for (int i = 3; i <= 7; i++) {
+        channel->value = i;
+        recorder.record(dm);
+    }
+    ASSERT_TRUE(recorder.dump(dir + "/full", lms::MetaFile()));
+    EXPECT_EQ("5;6;7;", readFile(dir + "/full/channel"));
+}
+
+TEST(FlightRecorder, dumpLayout) {
+    lms::DataManager dm;
+    auto a = dm.writeChannel<RecordedType>("a");
+    auto b = dm.writeChannel<RecordedType>("b");
+
+    FlightRecorder recorder;
+    EXPECT_FALSE(recorder.dumpAsync(tempDir() + "/disabled", lms::MetaFile()));
+    recorder.configure({"a", "b"}, 2);
+    a->value = 1;
+    b->value = 2;
+    recorder.record(dm);
+
+    lms::MetaFile meta;
+    meta.add_channels()->set_name("a");
+    meta.add_channels()->set_name("b");
+
+    // same layout as a recording: one file per channel and __meta, the
+    // directory only appears when it is complete
+    const std::string path = tempDir() + "/dump";
+    ASSERT_TRUE(recorder.dumpAsync(path, meta));
+    for (int i = 0; i < 1000 && !exists(path); i++) {
+        lms::Time::fromMillis(1).sleep();
+    }
+    ASSERT_TRUE(exists(path));
+    EXPECT_FALSE(exists(path + ".part"));
+    EXPECT_EQ("1;", readFile(path + "/a"));
+    EXPECT_EQ("2;", readFile(path + "/b"));
+
+    lms::MetaFile written;
+    std::ifstream metaFile(path + "/__meta", std::ios::binary);
+    ASSERT_TRUE(written.ParseFromIstream(&metaFile));
+    ASSERT_EQ(2, written.channels_size());
+    EXPECT_EQ("b", written.channels(1).name());
+
+    // an existing dump is not overwritten
+    EXPECT_FALSE(recorder.dump(path, meta));
+}
+
+TEST(FlightRecorder, excludesDetachedWriter) {
+    lms::DataManager dm;
+    auto attached = dm.writeChannel<RecordedType>("attached");
+    auto detached = dm.writeChannel<RecordedType>("detached");
+
+    FlightRecorder recorder;
+    recorder.configure({"attached", "detached"}, 4);
+    ASSERT_TRUE(recorder.enabled());
+
+    // plays a detached partition that writes its channel while the cycle
+    // thread records
+    std::atomic<bool> running(true);
+    std::thread writer([&detached, &running]() {
+        while (running) {
+            detached->value++;
+        }
+    });
+
+    const auto excluded = [](const std::string &channel) {
+        return channel == "detached";
+    };
+    for (int i = 1; i <= 3; i++) {
+        attached->value = i;
+        recorder.record(dm, excluded);
+    }
+    running = false;
+    writer.join();
+
+    const std::string path = tempDir() + "/dump";
+    ASSERT_TRUE(recorder.dump(path, lms::MetaFile()));
+    EXPECT_EQ("1;2;3;", readFile(path + "/attached"));
+    EXPECT_EQ("", readFile(path + "/detached"));
+}
+
+TEST(FlightRecorder, crashDump) {
+    lms::DataManager dm;
+    auto channel = dm.writeChannel<RecordedType>("channel");
+
+    FlightRecorder recorder;
+    recorder.configure({"channel"}, 2);
+    channel->value = 1;
+    recorder.record(dm);
+    EXPECT_FALSE(recorder.crashDump());
+
+    const std::string path = tempDir() + "/crash";
+    lms::MetaFile meta;
+    meta.add_channels()->set_name("channel");
+    recorder.prepareCrashDump(path, meta);
+
+    channel->value = 2;
+    recorder.record(dm);
+    ASSERT_TRUE(recorder.crashDump());
+    EXPECT_EQ("1;2;", readFile(path + "/channel"));
+
+    lms::MetaFile written;
+    std::ifstream metaFile(path + "/__meta", std::ios::binary);
+    ASSERT_TRUE(written.ParseFromIstream(&metaFile));
+    ASSERT_EQ(1, written.channels_size());
+    EXPECT_EQ("channel", written.channels(0).name());
+
+    // configure() discards the prepared dump
+    recorder.configure({"channel"}, 2);
+    EXPECT_FALSE(recorder.crashDump());
+}
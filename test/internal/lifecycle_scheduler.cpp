@@ -0,0 +1,71 @@
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "internal/lifecycle_scheduler.h"
+
+using lms::internal::LifeCycleScheduler;
+
+TEST(LifeCycleScheduler, dependencies) {
+    std::mutex mutex;
+    std::vector<std::string> order;
+    LifeCycleScheduler scheduler;
+    for (std::string name : {"a", "b", "c", "d"}) {
+        scheduler.add(name, [&mutex, &order, name]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(name);
+            return true;
+        });
+    }
+    scheduler.dependency("c", "a");
+    scheduler.dependency("c", "b");
+    scheduler.dependency("d", "c");
+    scheduler.dependency("d", "unknown");
+
+    ASSERT_TRUE(scheduler.run(4));
+    ASSERT_EQ(4u, order.size());
+    EXPECT_EQ("c", order[2]);
+    EXPECT_EQ("d", order[3]);
+}
+
+TEST(LifeCycleScheduler, mainThread) {
+    const std::thread::id caller = std::this_thread::get_id();
+    std::atomic<int> onCaller(0);
+    LifeCycleScheduler scheduler;
+    for (std::string name : {"a", "b", "c", "d", "e"}) {
+        scheduler.add(name, [&]() {
+            if (std::this_thread::get_id() == caller) {
+                onCaller++;
+            }
+            return true;
+        }, true);
+    }
+    ASSERT_TRUE(scheduler.run(3));
+    EXPECT_EQ(5, onCaller);
+}
+
+TEST(LifeCycleScheduler, failure) {
+    std::atomic<int> calls(0);
+    LifeCycleScheduler scheduler;
+    scheduler.add("a", [&]() { calls++; return false; });
+    scheduler.add("b", [&]() { calls++; return true; });
+    scheduler.dependency("b", "a");
+
+    EXPECT_FALSE(scheduler.run(2));
+    EXPECT_EQ(1, calls);
+}
+
+TEST(LifeCycleScheduler, cycle) {
+    std::atomic<int> calls(0);
+    LifeCycleScheduler scheduler;
+    scheduler.add("a", [&]() { calls++; return true; });
+    scheduler.add("b", [&]() { calls++; return true; });
+    scheduler.dependency("b", "a");
+    scheduler.dependency("a", "b");
+
+    EXPECT_TRUE(scheduler.hasCycle());
+    EXPECT_FALSE(scheduler.run(2));
+    EXPECT_EQ(0, calls);
+}
@@ -0,0 +1,154 @@
+#include <sys/wait.h>
+#include <poll.h>
+#include <unistd.h>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "internal/log_ring.h"
+
+using lms::internal::LogRing;
+using lms::logging::Level;
+
+TEST(LogRing, pushAndPop) {
+    LogRing ring(1024);
+    ASSERT_TRUE(ring.valid());
+
+    LogRing::Record record;
+    EXPECT_FALSE(ring.pop(record));
+
+    EXPECT_TRUE(ring.push(Level::INFO, 42, "tag", "text"));
+    EXPECT_TRUE(ring.push(Level::ERROR, 43, "", ""));
+
+    ASSERT_TRUE(ring.pop(record));
+    EXPECT_EQ(Level::INFO, record.level);
+    EXPECT_EQ(42, record.timestamp);
+    EXPECT_EQ("tag", record.tag);
+    EXPECT_EQ("text", record.text);
+
+    ASSERT_TRUE(ring.pop(record));
+    EXPECT_EQ(Level::ERROR, record.level);
+    EXPECT_EQ("", record.tag);
+    EXPECT_EQ("", record.text);
+    EXPECT_FALSE(ring.pop(record));
+}
+
+TEST(LogRing, wrapAroundAndDrop) {
+    LogRing ring(256);
+    LogRing::Record record;
+
+    // record sizes that are no divisor of the capacity wrap at every offset
+    for(int i = 0; i < 100; i++) {
+        const std::string text(i % 50, 'a' + i % 26);
+        ASSERT_TRUE(ring.push(Level::DEBUG, i, "wrap", text));
+        ASSERT_TRUE(ring.pop(record));
+        EXPECT_EQ(i, record.timestamp);
+        EXPECT_EQ(text, record.text);
+    }
+
+    // fill the ring, further records are dropped instead of blocking
+    int pushed = 0;
+    while(ring.push(Level::DEBUG, pushed, "full", "0123456789")) {
+        pushed++;
+    }
+    EXPECT_GT(pushed, 0);
+    EXPECT_FALSE(ring.push(Level::DEBUG, 0, "full", "0123456789"));
+    EXPECT_EQ(2u, ring.takeDropped());
+    EXPECT_EQ(0u, ring.takeDropped());
+
+    for(int i = 0; i < pushed; i++) {
+        ASSERT_TRUE(ring.pop(record));
+        EXPECT_EQ(i, record.timestamp);
+    }
+    EXPECT_FALSE(ring.pop(record));
+
+    // larger than the whole ring
+    EXPECT_FALSE(ring.push(Level::DEBUG, 0, "huge", std::string(1000, 'x')));
+    EXPECT_EQ(1u, ring.takeDropped());
+}
+
+TEST(LogRing, wakeup) {
+    LogRing ring(1024);
+    pollfd pfd;
+    pfd.fd = ring.eventFd();
+    pfd.events = POLLIN;
+
+    // no wakeup while the consumer is not sleeping
+    ring.push(Level::INFO, 0, "a", "a");
+    EXPECT_EQ(0, poll(&pfd, 1, 0));
+
+    // events are waiting, the consumer must not sleep
+    EXPECT_FALSE(ring.sleep());
+    LogRing::Record record;
+    ASSERT_TRUE(ring.pop(record));
+    EXPECT_TRUE(ring.sleep());
+
+    ring.push(Level::INFO, 0, "b", "b");
+    ASSERT_EQ(1, poll(&pfd, 1, 0));
+    ring.clearWakeup();
+    EXPECT_EQ(0, poll(&pfd, 1, 0));
+
+    // only the first event after sleep() wakes up the consumer
+    ring.push(Level::INFO, 0, "c", "c");
+    EXPECT_EQ(0, poll(&pfd, 1, 0));
+}
+
+TEST(LogRing, multipleProducers) {
+    LogRing ring(4096);
+    constexpr int THREADS = 4;
+    constexpr int COUNT = 2000;
+
+    std::vector<std::thread> producers;
+    for(int t = 0; t < THREADS; t++) {
+        producers.emplace_back([&ring, t]() {
+            for(int i = 0; i < COUNT; i++) {
+                while(! ring.push(Level::INFO, i, std::to_string(t), std::to_string(i))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // events of every producer arrive complete and in order
+    std::vector<int> next(THREADS, 0);
+    LogRing::Record record;
+    for(int received = 0; received < THREADS * COUNT;) {
+        if(! ring.pop(record)) {
+            std::this_thread::yield();
+            continue;
+        }
+        const int t = std::stoi(record.tag);
+        ASSERT_EQ(next[t], record.timestamp);
+        ASSERT_EQ(std::to_string(next[t]), record.text);
+        next[t]++;
+        received++;
+    }
+    for(auto &producer : producers) {
+        producer.join();
+    }
+    EXPECT_FALSE(ring.pop(record));
+}
+
+TEST(LogRing, forkedProducer) {
+    LogRing ring(1024);
+    ASSERT_TRUE(ring.sleep());
+
+    pid_t pid = fork();
+    ASSERT_NE(-1, pid);
+    if(pid == 0) {
+        ring.push(Level::WARN, 7, "child", "hello");
+        _exit(0);
+    }
+
+    pollfd pfd;
+    pfd.fd = ring.eventFd();
+    pfd.events = POLLIN;
+    ASSERT_EQ(1, poll(&pfd, 1, 10000));
+    ring.clearWakeup();
+
+    LogRing::Record record;
+    ASSERT_TRUE(ring.pop(record));
+    EXPECT_EQ("child", record.tag);
+    EXPECT_EQ("hello", record.text);
+    waitpid(pid, nullptr, 0);
+}
@@ -0,0 +1,111 @@
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "internal/master.h"
+#include "lms/protobuf_socket.h"
+#include "messages.pb.h"
+
+namespace {
+
+int connectUnix(const std::string &path) {
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+    if(connect(fd, (sockaddr *)&addr, sizeof(addr)) == -1) {
+        close(fd);
+        return -1;
+    }
+
+    // fail instead of hanging forever
+    timeval timeout;
+    timeout.tv_sec = 30;
+    timeout.tv_usec = 0;
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    return fd;
+}
+
+void runRequest(lms::ProtobufSocket &sock) {
+    lms::Request req;
+    // the runtime fails to load the config and stops right away
+    req.mutable_run()->set_config_file("/nonexistent/lms-load-test.xml");
+    req.mutable_run()->set_log_level(lms::Response::LogEvent::ALL);
+    sock.writeMessage(req);
+}
+
+}  // namespace
+
+/**
+ * @brief Load test: many clients each start a runtime and wait until it
+ * stopped, while one attached client never reads from its socket.
+ */
+TEST(MasterServer, manyRuntimesAndClients) {
+    const std::string path = "/tmp/lms-test-master-" + std::to_string(getpid()) + ".sock";
+    constexpr int CLIENTS = 32;
+
+    lms::internal::MasterServer master;
+    ASSERT_EQ(0, master.useUnix(path));
+    std::thread server([&master]() { master.start(); });
+
+    // slow client, starts a runtime but never reads
+    int slowFd = connectUnix(path);
+    ASSERT_NE(-1, slowFd);
+    lms::ProtobufSocket slow(slowFd);
+    runRequest(slow);
+
+    std::vector<int> stopped(CLIENTS, 0);
+    std::vector<std::thread> clients;
+    for(int i = 0; i < CLIENTS; i++) {
+        clients.emplace_back([&path, &stopped, i]() {
+            int fd = connectUnix(path);
+            if(fd == -1) {
+                return;
+            }
+            lms::ProtobufSocket sock(fd);
+            runRequest(sock);
+
+            lms::Response response;
+            while(sock.readMessage(response) == lms::ProtobufSocket::OK) {
+                if(response.has_log_event() && response.log_event().close_after()) {
+                    stopped[i] = 1;
+                    break;
+                }
+            }
+            sock.close();
+        });
+    }
+    for(auto &client : clients) {
+        client.join();
+    }
+
+    for(int i = 0; i < CLIENTS; i++) {
+        EXPECT_EQ(1, stopped[i]) << "client " << i;
+    }
+
+    // master still answers
+    int fd = connectUnix(path);
+    ASSERT_NE(-1, fd);
+    lms::ProtobufSocket sock(fd);
+    lms::Request req;
+    req.mutable_info();
+    ASSERT_EQ(lms::ProtobufSocket::OK, sock.writeMessage(req));
+    lms::Response response;
+    ASSERT_EQ(lms::ProtobufSocket::OK, sock.readMessage(response));
+    EXPECT_TRUE(response.has_info());
+
+    req.Clear();
+    req.mutable_shutdown();
+    sock.writeMessage(req);
+    server.join();
+
+    sock.close();
+    slow.close();
+    unlink(path.c_str());
+}
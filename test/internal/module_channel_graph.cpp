@@ -76,3 +76,89 @@ TEST(ModuleChannelGraph, generateDAG_readPriorities) {
 
     ASSERT_EQ(V({2, 3, 1, 4}), sortedList);
 }
+
+TEST(ModuleChannelGraph, removeModule) {
+    lms::internal::ModuleChannelGraph<int> mcg;
+
+    mcg.writeChannel("A", 1);
+    mcg.readChannel("A", 2);
+    mcg.writeChannel("B", 2);
+
+    mcg.removeModule(2);
+
+    ASSERT_TRUE(mcg.isReaderOrWriter("A", 1));
+    ASSERT_FALSE(mcg.isReaderOrWriter("A", 2));
+    ASSERT_FALSE(mcg.hasReaders("A"));
+    ASSERT_TRUE(mcg.getChannelAccessors("B").empty());
+
+    // a new instance may access the same channels again
+    ASSERT_TRUE(mcg.readChannel("A", 2));
+}
+
+TEST(ModuleChannelGraph, dependencies) {
+    lms::internal::ModuleChannelGraph<int> mcg;
+
+    mcg.writeChannel("A", 1);
+    mcg.readChannel("A", 2);
+    mcg.readChannel("B", 2);
+    mcg.writeChannel("A", 3, 5);
+
+    using Edges = std::vector<std::pair<int, int>>;
+    EXPECT_EQ(Edges({{1, 2}, {3, 2}}), mcg.dependencies("A", 2));
+    EXPECT_EQ(Edges({{3, 1}, {3, 2}}), mcg.dependencies("A", 3));
+    EXPECT_TRUE(mcg.dependencies("B", 2).empty());
+    EXPECT_TRUE(mcg.dependencies("C", 2).empty());
+
+    EXPECT_EQ("A", mcg.channelBetween(1, 2));
+    EXPECT_EQ("", mcg.channelBetween(2, 1));
+}
+
+TEST(ModuleChannelGraph, writeConflicts) {
+    lms::internal::ModuleChannelGraph<int> mcg;
+
+    mcg.writeChannel("A", 1);
+    mcg.writeChannel("A", 2);
+    mcg.readChannel("A", 3);
+    // different priorities define an order
+    mcg.writeChannel("B", 1, 1);
+    mcg.writeChannel("B", 2);
+
+    auto conflicts = mcg.writeConflicts();
+    ASSERT_EQ(1u, conflicts.size());
+    EXPECT_EQ("A", conflicts[0].channel);
+    EXPECT_EQ(1, conflicts[0].first);
+    EXPECT_EQ(2, conflicts[0].second);
+}
+
+TEST(ModuleChannelGraph, unorderedAccesses) {
+    lms::internal::ModuleChannelGraph<int> mcg;
+
+    mcg.writeChannel("A", 1);
+    mcg.writeChannel("A", 2);
+    mcg.readChannel("A", 3);
+    // readers never race
+    mcg.readChannel("B", 3);
+    mcg.readChannel("B", 4);
+
+    auto dag = mcg.generateDAG();
+    auto unordered = mcg.unorderedAccesses(
+        dag, [](int, int) { return false; });
+    ASSERT_EQ(1u, unordered.size());
+    EXPECT_EQ("A", unordered[0].channel);
+    EXPECT_EQ(1, unordered[0].first.module);
+    EXPECT_EQ(2, unordered[0].second.module);
+
+    // ordered via another channel
+    mcg.writeChannel("C", 1);
+    mcg.readChannel("C", 2);
+    dag = mcg.generateDAG();
+    EXPECT_TRUE(mcg.unorderedAccesses(dag, [](int, int) { return false; }).empty());
+
+    mcg.writeChannel("D", 3);
+    mcg.writeChannel("D", 4);
+    dag = mcg.generateDAG();
+    EXPECT_EQ(1u, mcg.unorderedAccesses(dag, [](int, int) { return false; }).size());
+    EXPECT_TRUE(mcg.unorderedAccesses(dag, [](int a, int b) {
+        return a + b == 7;
+    }).empty());
+}
@@ -0,0 +1,81 @@
+#include <random>
+
+#include "gtest/gtest.h"
+#include "internal/online_topo_order.h"
+
+using lms::internal::DAG;
+using lms::internal::OnlineTopoOrder;
+
+namespace {
+
+bool isTopological(const DAG<int> &dag, const std::vector<int> &order) {
+    std::map<int, size_t> position;
+    for (size_t i = 0; i < order.size(); i++) {
+        position[order[i]] = i;
+    }
+    for (const auto &pair : dag) {
+        for (int from : pair.second) {
+            if (position[from] >= position[pair.first]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+TEST(OnlineTopoOrder, edge) {
+    DAG<int> dag;
+    for (int i = 0; i < 4; i++) {
+        dag.node(i);
+    }
+    std::vector<int> order;
+    dag.topoSort(order);
+
+    OnlineTopoOrder<int> online;
+    online.reset(dag, order);
+    EXPECT_EQ(std::vector<int>({0, 1, 2, 3}), online.order());
+
+    std::vector<int> cycle;
+    ASSERT_TRUE(online.edge(3, 1, cycle));
+    dag.edge(3, 1);
+    ASSERT_TRUE(online.edge(2, 3, cycle));
+    dag.edge(2, 3);
+    EXPECT_TRUE(isTopological(dag, online.order()));
+
+    // 1 -> 2 closes 2 -> 3 -> 1
+    ASSERT_FALSE(online.edge(1, 2, cycle));
+    EXPECT_EQ(std::vector<int>({2, 3, 1}), cycle);
+    EXPECT_TRUE(isTopological(dag, online.order()));
+
+    EXPECT_FALSE(online.edge(1, 7, cycle));
+}
+
+TEST(OnlineTopoOrder, random) {
+    const int nodes = 60;
+    DAG<int> dag;
+    for (int i = 0; i < nodes; i++) {
+        dag.node(i);
+    }
+    std::vector<int> order;
+    dag.topoSort(order);
+    OnlineTopoOrder<int> online;
+    online.reset(dag, order);
+
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<int> dist(0, nodes - 1);
+    for (int i = 0; i < 400; i++) {
+        int from = dist(rng), to = dist(rng);
+        std::vector<int> cycle;
+        const bool closesCycle = from != to && dag.hasPath(to, from);
+        ASSERT_EQ(!closesCycle, online.edge(from, to, cycle));
+        if (closesCycle) {
+            ASSERT_EQ(to, cycle.front());
+            ASSERT_EQ(from, cycle.back());
+        } else {
+            dag.edge(from, to);
+        }
+        ASSERT_TRUE(isTopological(dag, online.order()));
+    }
+}
@@ -0,0 +1,20 @@
+#include "gtest/gtest.h"
+#include "internal/partition.h"
+
+using lms::internal::assignWorkers;
+
+TEST(Partition, assignWorkers) {
+    using Assignment = std::vector<std::vector<size_t>>;
+
+    // partition 1 only contains main thread modules
+    std::vector<size_t> widths = {3, 0, 1};
+    EXPECT_EQ(Assignment({{0, 2}}), assignWorkers(widths, 1));
+    EXPECT_EQ(Assignment({{0}, {2}}), assignWorkers(widths, 2));
+    EXPECT_EQ(Assignment({{0}, {0}, {0}, {2}}), assignWorkers(widths, 4));
+    // threads beyond the width are distributed as well
+    EXPECT_EQ(Assignment({{0}, {0}, {0}, {0}, {2}, {2}}),
+              assignWorkers(widths, 6));
+
+    EXPECT_EQ(Assignment({{}, {}}), assignWorkers({0, 0}, 2));
+    EXPECT_EQ(Assignment({{0, 2}, {1}}), assignWorkers({1, 1, 1}, 2));
+}
@@ -0,0 +1,58 @@
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "internal/race_detector.h"
+
+using lms::internal::ModuleChannelGraph;
+using lms::internal::RaceDetector;
+
+TEST(RaceDetector, violations) {
+    ModuleChannelGraph<int> mcg;
+    mcg.writeChannel("A", 1);
+    mcg.readChannel("A", 2);
+    std::mutex mutex;
+    RaceDetector<int> detector(mcg, mutex);
+    typedef RaceDetector<int>::Violation Violation;
+
+    lms::DataManager dm;
+    auto write = dm.writeChannel<int>("A");
+    dm.observeAccesses(&detector);
+    auto read = dm.readChannel<int>("A");
+    auto other = dm.writeChannel<int>("B");
+
+    // init() and other code outside of a cycle is not checked
+    *write = 1;
+    EXPECT_TRUE(detector.takeViolations().empty());
+
+    detector.cycleRunning(true);
+    detector.enter(1);
+    *write = 2;
+    detector.leave();
+
+    detector.enter(2);
+    EXPECT_EQ(2, *read);
+    *write = 3;
+    *other = 4;
+    // reported once
+    *write = 5;
+    detector.leave();
+
+    std::thread([&read]() { *read; }).join();
+
+    auto violations = detector.takeViolations();
+    ASSERT_EQ(3u, violations.size());
+    EXPECT_EQ("A", violations[0].channel);
+    EXPECT_EQ(2, violations[0].module);
+    EXPECT_EQ(Violation::READ_ONLY, violations[0].kind);
+    EXPECT_EQ("B", violations[1].channel);
+    EXPECT_EQ(Violation::NOT_ACCESSOR, violations[1].kind);
+    EXPECT_EQ("A", violations[2].channel);
+    EXPECT_EQ(Violation::OUTSIDE_MODULE, violations[2].kind);
+    EXPECT_TRUE(detector.takeViolations().empty());
+
+    dm.observeAccesses(nullptr);
+    detector.enter(2);
+    *other = 6;
+    detector.leave();
+    EXPECT_TRUE(detector.takeViolations().empty());
+}
@@ -0,0 +1,90 @@
+#include "gtest/gtest.h"
+#include "internal/runtime_diff.h"
+
+using lms::internal::ModuleInfo;
+using lms::internal::RuntimeInfo;
+
+namespace {
+
+ModuleInfo module(const std::string &name, const std::string &lib) {
+    ModuleInfo info;
+    info.name = name;
+    info.lib = lib;
+    info.clazz = "Test";
+    return info;
+}
+
+}  // namespace
+
+TEST(RuntimeDiff, modules) {
+    RuntimeInfo before;
+    before.modules.push_back(module("same", "a"));
+    before.modules.push_back(module("removed", "a"));
+    before.modules.push_back(module("lib", "a"));
+    before.modules.push_back(module("mapping", "a"));
+    before.modules.push_back(module("config", "a"));
+
+    RuntimeInfo after;
+    after.modules.push_back(module("same", "a"));
+    after.modules.push_back(module("lib", "b"));
+    after.modules.push_back(module("mapping", "a"));
+    after.modules.back().channelMapping["IN"] = std::make_pair("OUT", 0);
+    after.modules.push_back(module("config", "a"));
+    after.modules.back().configs["default"].set<int>("width", 3);
+    after.modules.push_back(module("added", "a"));
+
+    lms::internal::RuntimeDiff diff = lms::internal::diffRuntime(before, after);
+    EXPECT_EQ(std::set<std::string>({"removed"}), diff.removedModules);
+    EXPECT_EQ(std::set<std::string>({"lib", "mapping"}), diff.reloadedModules);
+    EXPECT_EQ(std::set<std::string>({"config"}), diff.reconfiguredModules);
+    EXPECT_FALSE(diff.flightRecorderChanged);
+
+    diff = lms::internal::diffRuntime(after, after);
+    EXPECT_TRUE(diff.removedModules.empty());
+    EXPECT_TRUE(diff.reloadedModules.empty());
+    EXPECT_TRUE(diff.reconfiguredModules.empty());
+}
+
+TEST(RuntimeDiff, sharedChannels) {
+    lms::internal::SharedChannelInfo channel;
+    RuntimeInfo before;
+    channel.name = "same";
+    before.sharedChannels.push_back(channel);
+    channel.name = "slots";
+    before.sharedChannels.push_back(channel);
+    channel.name = "removed";
+    before.sharedChannels.push_back(channel);
+
+    RuntimeInfo after;
+    channel.name = "same";
+    after.sharedChannels.push_back(channel);
+    channel.name = "slots";
+    channel.slots = 8;
+    after.sharedChannels.push_back(channel);
+    channel.name = "added";
+    after.sharedChannels.push_back(channel);
+
+    lms::internal::RuntimeDiff diff = lms::internal::diffRuntime(before, after);
+    EXPECT_EQ(std::set<std::string>({"added"}), diff.addedSharedChannels);
+    EXPECT_EQ(std::set<std::string>({"slots"}), diff.changedSharedChannels);
+    EXPECT_EQ(std::set<std::string>({"removed"}), diff.removedSharedChannels);
+
+    // a reload without changes shares nothing again
+    diff = lms::internal::diffRuntime(after, after);
+    EXPECT_TRUE(diff.addedSharedChannels.empty());
+    EXPECT_TRUE(diff.changedSharedChannels.empty());
+    EXPECT_TRUE(diff.removedSharedChannels.empty());
+}
+
+TEST(RuntimeDiff, flightRecorder) {
+    RuntimeInfo before;
+    RuntimeInfo after;
+    after.flightRecorder.enabled = true;
+    EXPECT_TRUE(lms::internal::diffRuntime(before, after).flightRecorderChanged);
+
+    before.flightRecorder.enabled = true;
+    EXPECT_FALSE(lms::internal::diffRuntime(before, after).flightRecorderChanged);
+
+    after.clock.cycle = lms::Time::fromMillis(10);
+    EXPECT_TRUE(lms::internal::diffRuntime(before, after).flightRecorderChanged);
+}
@@ -0,0 +1,62 @@
+#include <sstream>
+
+#include "gtest/gtest.h"
+#include "internal/schedule.h"
+
+using lms::internal::Schedule;
+
+TEST(Schedule, writeRead) {
+    Schedule schedule;
+    schedule.order = {"importer", "detection", "renderer"};
+    schedule.edges = {{"importer", "detection"}, {"importer", "renderer"}};
+    schedule.accessHash = 42;
+    // not saved
+    schedule.width = 2;
+
+    std::stringstream file;
+    schedule.write(file);
+
+    Schedule loaded;
+    ASSERT_TRUE(loaded.read(file));
+    EXPECT_EQ(schedule.order, loaded.order);
+    EXPECT_EQ(schedule.edges, loaded.edges);
+    EXPECT_EQ(42u, loaded.accessHash);
+    EXPECT_EQ(0u, loaded.width);
+}
+
+TEST(Schedule, readInvalid) {
+    std::istringstream comments("# lms schedule\n\nmodule a\n");
+    Schedule schedule;
+    ASSERT_TRUE(schedule.read(comments));
+    EXPECT_EQ(std::vector<std::string>({"a"}), schedule.order);
+
+    std::istringstream missingTarget("module a\nedge a\n");
+    EXPECT_FALSE(schedule.read(missingTarget));
+
+    std::istringstream unknown("node a\n");
+    EXPECT_FALSE(schedule.read(unknown));
+}
+
+TEST(Schedule, hashAccesses) {
+    std::vector<Schedule::Access> accesses = {
+        {"IMAGE", "importer", true, 0}, {"IMAGE", "detection", false, 0}};
+    const std::uint64_t hash = Schedule::hashAccesses(accesses);
+    EXPECT_NE(0u, hash);
+
+    // independent of the order
+    std::swap(accesses[0], accesses[1]);
+    EXPECT_EQ(hash, Schedule::hashAccesses(accesses));
+
+    // a priority from a channel mapping
+    accesses[0].priority = 1;
+    EXPECT_NE(hash, Schedule::hashAccesses(accesses));
+    accesses[0].priority = 0;
+
+    // a mapped channel name
+    accesses[0].channel = "RAW_IMAGE";
+    EXPECT_NE(hash, Schedule::hashAccesses(accesses));
+    accesses[0].channel = "IMAGE";
+
+    accesses[0].write = true;
+    EXPECT_NE(hash, Schedule::hashAccesses(accesses));
+}
@@ -0,0 +1,49 @@
+#include <thread>
+#include "gtest/gtest.h"
+#include "internal/spsc_queue.h"
+
+TEST(SpscQueue, pushPop) {
+    lms::internal::SpscQueue<int> q(2);
+    EXPECT_TRUE(q.empty());
+    EXPECT_TRUE(q.push(1));
+    EXPECT_TRUE(q.push(2));
+    EXPECT_FALSE(q.push(3));
+
+    int value;
+    ASSERT_TRUE(q.pop(value));
+    EXPECT_EQ(1, value);
+    EXPECT_TRUE(q.push(3));
+    ASSERT_TRUE(q.pop(value));
+    EXPECT_EQ(2, value);
+    ASSERT_TRUE(q.pop(value));
+    EXPECT_EQ(3, value);
+    EXPECT_FALSE(q.pop(value));
+    EXPECT_TRUE(q.empty());
+}
+
+TEST(SpscQueue, threads) {
+    lms::internal::SpscQueue<int> q(8);
+    const int count = 10000;
+
+    std::thread producer([&q]() {
+        for(int i = 0; i < count; i++) {
+            int value = i;
+            while(! q.push(std::move(value))) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    int expected = 0;
+    int value;
+    while(expected < count) {
+        if(q.pop(value)) {
+            ASSERT_EQ(expected, value);
+            expected++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    EXPECT_TRUE(q.empty());
+}
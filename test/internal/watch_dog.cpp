@@ -0,0 +1,141 @@
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <dirent.h>
+#include <unistd.h>
+
+#include "internal/watch_dog.h"
+#include "lms/module.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+struct TestModule : public lms::Module {
+    bool cycle() override { return true; }
+};
+
+// backtrace files written by watch dogs of this process
+std::vector<std::string> hangFiles() {
+    const std::string prefix = "lms-hang-" + std::to_string(getpid()) + "-";
+    std::vector<std::string> files;
+    DIR *dir = opendir("/tmp");
+    if (dir == nullptr) {
+        return files;
+    }
+    while (dirent *entry = readdir(dir)) {
+        if (std::string(entry->d_name).compare(0, prefix.size(), prefix) == 0) {
+            files.push_back(std::string("/tmp/") + entry->d_name);
+        }
+    }
+    closedir(dir);
+    return files;
+}
+
+bool backtraceWritten() {
+    const std::vector<std::string> files = hangFiles();
+    return !files.empty() &&
+           std::ifstream(files[0], std::ios::ate).tellg() > 0;
+}
+
+}  // namespace
+
+TEST(WatchDog, disabled) {
+    lms::internal::WatchDog dog;
+    TestModule slow;
+    dog.beginModule(&slow);
+    lms::Time::fromMillis(10).sleep();
+    dog.endModule();
+    EXPECT_EQ(0u, dog.hangs());
+}
+
+TEST(WatchDog, fastModules) {
+    lms::internal::WatchDog dog;
+    dog.watch(lms::Time::fromMillis(50));
+    TestModule fast;
+    for (int i = 0; i < 100; i++) {
+        dog.beginModule(&fast);
+        dog.endModule();
+    }
+    lms::Time::fromMillis(60).sleep();
+    EXPECT_EQ(0u, dog.hangs());
+}
+
+TEST(WatchDog, hangOnEveryThread) {
+    lms::internal::WatchDog dog;
+    dog.watch(lms::Time::fromMillis(5));
+
+    TestModule modules[3];
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 3; t++) {
+        dog.moduleName(&modules[t], "module" + std::to_string(t));
+        threads.emplace_back([&dog, &modules, t]() {
+            dog.beginModule(&modules[t]);
+            // every thread is reported once per module run
+            lms::Time::fromMillis(40).sleep();
+            dog.endModule();
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(3u, dog.hangs());
+
+    dog.beginModule(&modules[0]);
+    lms::Time::fromMillis(40).sleep();
+    dog.endModule();
+    EXPECT_EQ(4u, dog.hangs());
+
+    // stopped
+    dog.watch(lms::Time::ZERO);
+    dog.beginModule(&modules[1]);
+    lms::Time::fromMillis(20).sleep();
+    dog.endModule();
+    EXPECT_EQ(4u, dog.hangs());
+}
+
+TEST(WatchDog, captureStack) {
+    for (const auto &file : hangFiles()) {
+        std::remove(file.c_str());
+    }
+
+    lms::internal::WatchDog dog;
+    dog.watch(lms::Time::fromMillis(5), true);
+
+    TestModule stuck;
+    TestModule other;
+    dog.moduleName(&stuck, "stuck");
+    dog.moduleName(&other, "other");
+    std::thread hung([&dog, &stuck]() {
+        dog.beginModule(&stuck);
+        // the signal handler interrupts the sleep and writes the backtrace
+        for (int i = 0; i < 1000 && !backtraceWritten(); i++) {
+            lms::Time::fromMillis(1).sleep();
+        }
+        dog.endModule();
+    });
+
+    // a thread that starts while the backtrace is captured must not block
+    std::thread registering([&dog, &other]() {
+        while (dog.hangs() == 0) {
+            lms::Time::fromMillis(1).sleep();
+        }
+        dog.beginModule(&other);
+        dog.endModule();
+    });
+    registering.join();
+    hung.join();
+    dog.watch(lms::Time::ZERO);
+
+    EXPECT_EQ(1u, dog.hangs());
+    const std::vector<std::string> files = hangFiles();
+    ASSERT_EQ(1u, files.size());
+    std::ifstream is(files[0]);
+    std::stringstream ss;
+    ss << is.rdbuf();
+    // one line per frame
+    EXPECT_NE(std::string::npos, ss.str().find('\n'));
+    std::remove(files[0].c_str());
+}
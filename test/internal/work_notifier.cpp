@@ -0,0 +1,99 @@
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "internal/work_notifier.h"
+
+using lms::internal::WaitPolicy;
+using lms::internal::WorkNotifier;
+
+namespace {
+
+/**
+ * @brief Pass a token around a ring of threads, every hop is one notify()
+ * followed by a wakeup of the next thread.
+ * @return average time per hop
+ */
+lms::Time tokenRing(WaitPolicy policy, int threads, int hops) {
+    std::mutex mutex;
+    WorkNotifier notifier;
+    notifier.policy(policy);
+    int turn = 0;
+
+    auto worker = [&](int id) {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            notifier.wait(lock, [&] { return turn >= hops || turn % threads == id; });
+            if (turn >= hops) {
+                return;
+            }
+            turn++;
+            notifier.notify();
+        }
+    };
+
+    const lms::Time start = lms::Time::now();
+    std::vector<std::thread> pool;
+    for (int i = 0; i < threads; i++) {
+        pool.emplace_back(worker, i);
+    }
+    for (auto &thread : pool) {
+        thread.join();
+    }
+    return (lms::Time::now() - start) / hops;
+}
+
+}  // namespace
+
+TEST(WorkNotifier, waitPolicyFromName) {
+    WaitPolicy policy;
+    ASSERT_TRUE(lms::internal::waitPolicyFromName("block", policy));
+    EXPECT_EQ(WaitPolicy::BLOCK, policy);
+    ASSERT_TRUE(lms::internal::waitPolicyFromName("spin", policy));
+    EXPECT_EQ(WaitPolicy::SPIN_THEN_BLOCK, policy);
+    ASSERT_TRUE(lms::internal::waitPolicyFromName("busySpin", policy));
+    EXPECT_EQ(WaitPolicy::BUSY_SPIN, policy);
+    EXPECT_FALSE(lms::internal::waitPolicyFromName("sleep", policy));
+}
+
+TEST(WorkNotifier, wakeup) {
+    for (WaitPolicy policy : {WaitPolicy::BLOCK, WaitPolicy::SPIN_THEN_BLOCK}) {
+        std::mutex mutex;
+        WorkNotifier notifier;
+        notifier.policy(policy);
+        notifier.spinTime(lms::Time::fromMicros(10));
+        bool ready = false;
+
+        std::thread waiter([&] {
+            std::unique_lock<std::mutex> lock(mutex);
+            notifier.wait(lock, [&] { return ready; });
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ready = true;
+            notifier.notify();
+        }
+        waiter.join();
+    }
+}
+
+TEST(WorkNotifier, dispatchLatency) {
+    const int hops = 1000;
+    std::cout << "block: " << tokenRing(WaitPolicy::BLOCK, 2, hops)
+              << " per hop" << std::endl;
+
+    // spinning threads need a core each, otherwise they only steal time from
+    // the thread that holds the token
+    if (std::thread::hardware_concurrency() < 2) {
+        std::cout << "spin policies skipped, less than 2 hardware threads"
+                  << std::endl;
+        return;
+    }
+    std::cout << "spin: " << tokenRing(WaitPolicy::SPIN_THEN_BLOCK, 2, hops)
+              << " per hop" << std::endl;
+    std::cout << "busySpin: " << tokenRing(WaitPolicy::BUSY_SPIN, 2, hops)
+              << " per hop" << std::endl;
+}
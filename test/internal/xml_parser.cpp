@@ -66,7 +66,7 @@ TEST(xml_parser, parseModuleConfig) {
 TEST(xml_parser, parseService) {
     std::istringstream xml(std::string(
         "<lms>"
-        "<service name=\"test\" lib=\"test_service\" class=\"TestService\" log=\"warn\">"
+        "<service name=\"test\" lib=\"test_service\" class=\"TestService\" log=\"warn\" workers=\"2\">"
         "</service>"
         "</lms>"));
     lms::internal::RuntimeInfo info;
@@ -80,12 +80,13 @@ TEST(xml_parser, parseService) {
     EXPECT_EQ("test_service", info.services[0].lib);
     EXPECT_EQ("TestService", info.services[0].clazz);
     EXPECT_EQ(lms::logging::Level::WARN, info.services[0].log);
+    EXPECT_EQ(2u, info.services[0].workers);
 }
 
 TEST(xml_parser, parseModule) {
     std::istringstream xml(std::string(
         "<lms>"
-        "<module name=\"my_mod\" lib=\"my_module\" class=\"MyModule\" log=\"info\">"
+        "<module name=\"my_mod\" lib=\"my_module\" class=\"MyModule\" log=\"info\" initAfter=\"cam,net\">"
         "<channelHint name=\"A\" mapTo=\"B\" />"
         "<channelHint name=\"C\" mapTo=\"D\" priority=\"3\" />"
         "<channelHint name=\"E\" priority=\"7\" />"
@@ -103,6 +104,7 @@ TEST(xml_parser, parseModule) {
     EXPECT_EQ("my_module", info.modules[0].lib);
     EXPECT_EQ("MyModule", info.modules[0].clazz);
     EXPECT_EQ(lms::logging::Level::INFO, info.modules[0].log);
+    EXPECT_EQ(std::vector<std::string>({"cam", "net"}), info.modules[0].initAfter);
 
     ASSERT_EQ(3u, info.modules[0].channelMapping.size());
     EXPECT_EQ("B", info.modules[0].channelMapping["A"].first);
@@ -112,3 +114,130 @@ TEST(xml_parser, parseModule) {
     EXPECT_EQ("E", info.modules[0].channelMapping["E"].first);
     EXPECT_EQ(7, info.modules[0].channelMapping["E"].second);
 }
+
+TEST(xml_parser, parseFlightRecorder) {
+    std::istringstream xml(std::string(
+        "<lms>"
+        "<flightRecorder seconds=\"2.5\">"
+        "<channel>IMAGE</channel>"
+        "<channel> CAR_STATE </channel>"
+        "</flightRecorder>"
+        "</lms>"
+    ));
+    lms::internal::RuntimeInfo info;
+    lms::internal::XmlParser parser(info);
+    parser.parseFile(xml, "");
+
+    ASSERT_EQ(0u, parser.errors().size());
+
+    EXPECT_TRUE(info.flightRecorder.enabled);
+    EXPECT_EQ(lms::Time::fromMillis(2500), info.flightRecorder.duration);
+    EXPECT_EQ(0u, info.flightRecorder.frames);
+    EXPECT_EQ(std::vector<std::string>({"IMAGE", "CAR_STATE"}),
+              info.flightRecorder.channels);
+}
+
+TEST(xml_parser, parseSharedChannel) {
+    std::istringstream xml(std::string(
+        "<lms>"
+        "<sharedChannel name=\"IMAGE\" mode=\"write\" />"
+        "<sharedChannel name=\"TRAJECTORY\" mode=\"read\" slots=\"8\" />"
+        "<sharedChannel name=\"INVALID\" mode=\"both\" />"
+        "<sharedChannel name=\"CAMERA/IMAGE\" mode=\"read\" />"
+        "</lms>"
+    ));
+    lms::internal::RuntimeInfo info;
+    lms::internal::XmlParser parser(info);
+    parser.parseFile(xml, "");
+
+    EXPECT_EQ(2u, parser.errors().size());
+
+    ASSERT_EQ(2u, info.sharedChannels.size());
+    EXPECT_EQ("IMAGE", info.sharedChannels[0].name);
+    EXPECT_TRUE(info.sharedChannels[0].writer);
+    EXPECT_EQ(4u, info.sharedChannels[0].slots);
+    EXPECT_EQ("TRAJECTORY", info.sharedChannels[1].name);
+    EXPECT_FALSE(info.sharedChannels[1].writer);
+    EXPECT_EQ(8u, info.sharedChannels[1].slots);
+}
+
+TEST(xml_parser, parseExecution) {
+    std::istringstream xml(std::string(
+        "<lms>"
+        "<execution threads=\"4\" waitPolicy=\"spin\" spinMicros=\"20\" elastic=\"false\""
+        " raceDetection=\"true\" />"
+        "</lms>"
+    ));
+    lms::internal::RuntimeInfo info;
+    lms::internal::XmlParser parser(info);
+    parser.parseFile(xml, "");
+
+    EXPECT_TRUE(parser.errors().empty());
+    EXPECT_TRUE(info.execution.multithreading);
+    EXPECT_EQ(4, info.execution.threads);
+    EXPECT_FALSE(info.execution.elastic);
+    EXPECT_EQ(lms::internal::WaitPolicy::SPIN_THEN_BLOCK, info.execution.waitPolicy);
+    EXPECT_EQ(lms::Time::fromMicros(20), info.execution.spinTime);
+    EXPECT_TRUE(info.execution.raceDetection);
+
+    std::istringstream invalid(std::string(
+        "<lms><execution threads=\"auto\" waitPolicy=\"sleep\" /></lms>"
+    ));
+    lms::internal::RuntimeInfo info2;
+    lms::internal::XmlParser parser2(info2);
+    parser2.parseFile(invalid, "");
+
+    EXPECT_EQ(1u, parser2.errors().size());
+    EXPECT_TRUE(info2.execution.multithreading);
+    EXPECT_EQ(0, info2.execution.threads);
+    EXPECT_EQ(lms::internal::WaitPolicy::BLOCK, info2.execution.waitPolicy);
+}
+
+TEST(xml_parser, parseSchedule) {
+    std::istringstream xml(std::string(
+        "<lms><schedule src=\"lms.schedule\" /></lms>"
+    ));
+    lms::internal::RuntimeInfo info;
+    lms::internal::XmlParser parser(info);
+    parser.parseFile(xml, "/configs/lms.xml");
+
+    EXPECT_TRUE(parser.errors().empty());
+    EXPECT_EQ("/configs/lms.schedule", info.schedule);
+}
+
+TEST(xml_parser, parseExecutionPartitions) {
+    std::istringstream xml(std::string(
+        "<lms>"
+        "<execution partitions=\"true\">"
+        "<detach module=\"lidar\" value=\"10\" unit=\"hz\" sleep=\"true\" />"
+        "<detach value=\"10\" unit=\"hz\" />"
+        "</execution>"
+        "</lms>"
+    ));
+    lms::internal::RuntimeInfo info;
+    lms::internal::XmlParser parser(info);
+    parser.parseFile(xml, "");
+
+    EXPECT_EQ(1u, parser.errors().size());
+    EXPECT_TRUE(info.execution.partitions);
+    ASSERT_EQ(1u, info.execution.detached.size());
+    EXPECT_EQ("lidar", info.execution.detached[0].module);
+    EXPECT_EQ(lms::Time::fromMillis(100), info.execution.detached[0].clock.cycle);
+    EXPECT_TRUE(info.execution.detached[0].clock.sleep);
+}
+
+TEST(xml_parser, parseClockWatchDog) {
+    std::istringstream xml(std::string(
+        "<lms>"
+        "<clock value=\"10\" unit=\"ms\" watchDog=\"5\" watchDogStacks=\"true\" />"
+        "</lms>"
+    ));
+    lms::internal::RuntimeInfo info;
+    lms::internal::XmlParser parser(info);
+    parser.parseFile(xml, "");
+
+    EXPECT_TRUE(parser.errors().empty());
+    EXPECT_TRUE(info.clock.watchDogEnabled);
+    EXPECT_EQ(lms::Time::fromMillis(5), info.clock.watchDog);
+    EXPECT_TRUE(info.clock.watchDogStacks);
+}
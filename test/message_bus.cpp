@@ -0,0 +1,137 @@
+#include <thread>
+#include <vector>
+
+#include "lms/message_bus.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+void assignMainCycle(lms::MessageBus &bus) {
+    bus.assignDomains([](const std::set<const void *> &) { return 0; });
+}
+
+}  // namespace
+
+TEST(MessageBus, nextCycle) {
+    lms::MessageBus bus;
+    lms::Publisher<int> pub = bus.publisher<int>("numbers");
+    lms::Subscription<int> sub = bus.subscribe<int>("numbers");
+    EXPECT_TRUE(bus.usersChanged());
+    assignMainCycle(bus);
+    EXPECT_FALSE(bus.usersChanged());
+
+    EXPECT_TRUE(pub.publish(1));
+    EXPECT_TRUE(pub.publish(2));
+    EXPECT_TRUE(sub.empty());
+
+    bus.swap();
+    ASSERT_EQ(2u, sub.size());
+    EXPECT_EQ(1, sub[0]);
+    EXPECT_EQ(2, sub[1]);
+    EXPECT_EQ(std::vector<int>({1, 2}), std::vector<int>(sub.begin(), sub.end()));
+
+    bus.swap();
+    EXPECT_TRUE(sub.empty());
+}
+
+TEST(MessageBus, capacity) {
+    lms::MessageBus bus;
+    lms::Publisher<std::string> pub = bus.publisher<std::string>("names", nullptr, 2);
+    lms::Subscription<std::string> sub = bus.subscribe<std::string>("names");
+    assignMainCycle(bus);
+
+    EXPECT_TRUE(pub.publish("a"));
+    EXPECT_TRUE(pub.publish("b"));
+    EXPECT_FALSE(pub.publish("c"));
+    bus.swap();
+    EXPECT_EQ(2u, sub.size());
+
+    // applied by the next swap
+    lms::Publisher<std::string> larger = bus.publisher<std::string>("names", nullptr, 3);
+    bus.swap();
+    EXPECT_TRUE(larger.publish("a"));
+    EXPECT_TRUE(larger.publish("b"));
+    EXPECT_TRUE(pub.publish("c"));
+    bus.swap();
+    EXPECT_EQ(3u, sub.size());
+}
+
+TEST(MessageBus, claim) {
+    lms::MessageBus bus;
+    auto pub = bus.publisher<std::vector<int>>("vectors");
+    auto sub = bus.subscribe<std::vector<int>>("vectors");
+    assignMainCycle(bus);
+
+    std::vector<int> *msg = pub.claim();
+    ASSERT_NE(nullptr, msg);
+    msg->assign({1, 2, 3});
+    bus.swap();
+    ASSERT_EQ(1u, sub.size());
+    EXPECT_EQ(std::vector<int>({1, 2, 3}), sub[0]);
+
+    // slots are reused every other cycle
+    bus.swap();
+    EXPECT_EQ(msg, pub.claim());
+}
+
+TEST(MessageBus, typeMismatch) {
+    lms::MessageBus bus;
+    bus.publisher<int>("numbers");
+    EXPECT_THROW(bus.subscribe<float>("numbers"), std::exception);
+}
+
+TEST(MessageBus, domains) {
+    lms::MessageBus bus;
+    int a, b;
+    auto main = bus.publisher<int>("main", &a);
+    auto detached = bus.publisher<int>("detached", &b);
+    auto mainSub = bus.subscribe<int>("main", &a);
+    auto detachedSub = bus.subscribe<int>("detached", &b);
+
+    // not swapped before a domain is assigned
+    main.publish(1);
+    bus.swap();
+    EXPECT_TRUE(mainSub.empty());
+
+    bus.assignDomains([&b](const std::set<const void *> &users) {
+        return users.count(&b) ? 1 : 0;
+    });
+    EXPECT_EQ(2u, bus.users().size());
+    EXPECT_EQ(std::set<const void *>({&b}), bus.users()["detached"]);
+
+    detached.publish(2);
+    bus.swap(0);
+    EXPECT_TRUE(detachedSub.empty());
+    bus.swap(1);
+    EXPECT_EQ(1u, detachedSub.size());
+
+    bus.subscribe<int>("main", &b);
+    EXPECT_TRUE(bus.usersChanged());
+}
+
+TEST(MessageBus, concurrentPublish) {
+    lms::MessageBus bus;
+    auto pub = bus.publisher<int>("numbers", nullptr, 400);
+    auto sub = bus.subscribe<int>("numbers");
+    assignMainCycle(bus);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([pub, t]() mutable {
+            for (int i = 0; i < 100; i++) {
+                pub.publish(t * 100 + i);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    bus.swap();
+
+    std::vector<int> received(sub.begin(), sub.end());
+    std::sort(received.begin(), received.end());
+    ASSERT_EQ(400u, received.size());
+    for (int i = 0; i < 400; i++) {
+        EXPECT_EQ(i, received[i]);
+    }
+}
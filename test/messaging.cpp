@@ -0,0 +1,107 @@
+#include <iostream>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "lms/messaging.h"
+#include "lms/time.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+const int SENDERS = 8;
+const int MESSAGES = 20000;
+
+/* send() before per-thread buffers, for comparison */
+struct LockedMessaging {
+    std::mutex mtx;
+    std::map<std::string, std::list<std::string>> sendQueue;
+
+    void send(const std::string &command, const std::string &content) {
+        std::lock_guard<std::mutex> lock(mtx);
+        sendQueue[command].push_back(content);
+    }
+};
+
+template <typename M> lms::Time sendConcurrently(M &messaging) {
+    const std::string content(32, 'x');
+    lms::Time start = lms::Time::now();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < SENDERS; t++) {
+        threads.emplace_back([&messaging, &content]() {
+            for (int i = 0; i < MESSAGES; i++) {
+                messaging.send("COMMAND", content);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    return lms::Time::now() - start;
+}
+
+}  // namespace
+
+TEST(Messaging, nextCycle) {
+    lms::Messaging messaging;
+    messaging.send("A", "1");
+    messaging.send("B");
+    messaging.send("A", "2");
+    EXPECT_TRUE(messaging.receive("A").empty());
+
+    messaging.resetQueue();
+    EXPECT_EQ(std::list<std::string>({"1", "2"}), messaging.receive("A"));
+    EXPECT_EQ(std::list<std::string>({""}), messaging.receive("B"));
+    EXPECT_TRUE(messaging.receive("C").empty());
+
+    messaging.resetQueue();
+    EXPECT_TRUE(messaging.receive("A").empty());
+}
+
+TEST(Messaging, senderOrder) {
+    lms::Messaging messaging;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&messaging, t]() {
+            for (int i = 0; i < 100; i++) {
+                messaging.send("T" + std::to_string(t), std::to_string(i));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    messaging.resetQueue();
+
+    for (int t = 0; t < 4; t++) {
+        const auto &messages = messaging.receive("T" + std::to_string(t));
+        ASSERT_EQ(100u, messages.size());
+        int i = 0;
+        for (const auto &message : messages) {
+            EXPECT_EQ(std::to_string(i++), message);
+        }
+    }
+
+    // buffers of finished threads were dropped
+    messaging.resetQueue();
+    EXPECT_TRUE(messaging.receive("T0").empty());
+}
+
+TEST(Messaging, benchmark) {
+    LockedMessaging locked;
+    const lms::Time lockedTime = sendConcurrently(locked);
+
+    lms::Messaging messaging;
+    const lms::Time bufferedTime = sendConcurrently(messaging);
+    messaging.resetQueue();
+    EXPECT_EQ(size_t(SENDERS * MESSAGES), messaging.receive("COMMAND").size());
+
+    std::cout << SENDERS << " senders, locked send: "
+              << lockedTime.micros() * 1000 / (SENDERS * MESSAGES)
+              << " ns, per-thread buffers: "
+              << bufferedTime.micros() * 1000 / (SENDERS * MESSAGES)
+              << " ns per message" << std::endl;
+}
@@ -0,0 +1,161 @@
+#include <sys/socket.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "lms/protobuf_socket.h"
+#include "messages.pb.h"
+
+namespace {
+
+lms::Response logEvent(const std::string &text) {
+    lms::Response response;
+    response.mutable_log_event()->set_tag("test");
+    response.mutable_log_event()->set_text(text);
+    return response;
+}
+
+class ProtobufSocketTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, fds));
+    }
+
+    void TearDown() override {
+        close(fds[0]);
+        close(fds[1]);
+    }
+
+    int fds[2];
+};
+
+}  // namespace
+
+TEST_F(ProtobufSocketTest, writeAndRead) {
+    lms::ProtobufSocket writer(fds[0]);
+    lms::ProtobufSocket reader(fds[1]);
+
+    ASSERT_EQ(lms::ProtobufSocket::OK, writer.writeMessage(logEvent("a")));
+    ASSERT_EQ(lms::ProtobufSocket::OK, writer.writeMessage(logEvent("b")));
+
+    lms::Response response;
+    ASSERT_EQ(lms::ProtobufSocket::OK, reader.readMessage(response));
+    EXPECT_EQ("a", response.log_event().text());
+    ASSERT_EQ(lms::ProtobufSocket::OK, reader.readMessage(response));
+    EXPECT_EQ("b", response.log_event().text());
+}
+
+TEST_F(ProtobufSocketTest, partialFrame) {
+    // serialize a frame with a second socket pair and deliver it byte-wise
+    int raw[2];
+    ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, raw));
+    lms::ProtobufSocket(raw[0]).writeMessage(logEvent("partial"));
+    char frame[256];
+    ssize_t frameSize = read(raw[1], frame, sizeof(frame));
+    close(raw[0]);
+    close(raw[1]);
+    ASSERT_GT(frameSize, 4);
+
+    fcntl(fds[1], F_SETFL, fcntl(fds[1], F_GETFL) | O_NONBLOCK);
+    lms::ProtobufSocket reader(fds[1]);
+    lms::Response response;
+    lms::ProtobufSocket::Error error = lms::ProtobufSocket::OK;
+
+    // nothing to read on a non-blocking socket
+    EXPECT_EQ(lms::ProtobufSocket::OK, reader.receive());
+    EXPECT_FALSE(reader.nextMessage(response, error));
+
+    for(ssize_t i = 0; i < frameSize - 1; i++) {
+        ASSERT_EQ(1, write(fds[0], frame + i, 1));
+        ASSERT_EQ(lms::ProtobufSocket::OK, reader.receive());
+        EXPECT_FALSE(reader.nextMessage(response, error));
+    }
+    ASSERT_EQ(1, write(fds[0], frame + frameSize - 1, 1));
+    ASSERT_EQ(lms::ProtobufSocket::OK, reader.receive());
+    ASSERT_TRUE(reader.nextMessage(response, error));
+    EXPECT_EQ("partial", response.log_event().text());
+    EXPECT_FALSE(reader.nextMessage(response, error));
+    EXPECT_EQ(lms::ProtobufSocket::OK, error);
+}
+
+TEST_F(ProtobufSocketTest, invalidMessage) {
+    lms::ProtobufSocket writer(fds[0]);
+    lms::ProtobufSocket reader(fds[1]);
+
+    // field 1 with the reserved wire type 7
+    const char invalid[] = {0x0f};
+    writer.enqueue(invalid, sizeof(invalid));
+    ASSERT_EQ(lms::ProtobufSocket::OK, writer.flush());
+
+    lms::Response response;
+    lms::ProtobufSocket::Error error = lms::ProtobufSocket::OK;
+    ASSERT_EQ(lms::ProtobufSocket::OK, reader.receive());
+    EXPECT_FALSE(reader.nextMessage(response, error));
+    EXPECT_EQ(lms::ProtobufSocket::ERROR, error);
+
+    writer.enqueue(invalid, sizeof(invalid));
+    ASSERT_EQ(lms::ProtobufSocket::OK, writer.flush());
+    EXPECT_EQ(lms::ProtobufSocket::ERROR, reader.readMessage(response));
+}
+
+TEST_F(ProtobufSocketTest, batchedNonBlockingWrite) {
+    fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL) | O_NONBLOCK);
+    lms::ProtobufSocket writer(fds[0]);
+    lms::ProtobufSocket reader(fds[1]);
+
+    // more than fits into the socket buffer at once
+    const int count = 20000;
+    const std::string text(100, 'x');
+    for(int i = 0; i < count; i++) {
+        writer.enqueue(logEvent(text + std::to_string(i)));
+    }
+    ASSERT_EQ(lms::ProtobufSocket::OK, writer.flush());
+    EXPECT_GT(writer.pending(), 0u);
+
+    std::thread consumer([&reader, &text]() {
+        lms::Response response;
+        for(int i = 0; i < count; i++) {
+            ASSERT_EQ(lms::ProtobufSocket::OK, reader.readMessage(response));
+            ASSERT_EQ(text + std::to_string(i), response.log_event().text());
+        }
+    });
+
+    while(writer.pending() > 0) {
+        ASSERT_EQ(lms::ProtobufSocket::OK, writer.flush());
+        std::this_thread::yield();
+    }
+    consumer.join();
+}
+
+TEST_F(ProtobufSocketTest, sharedFrame) {
+    lms::ProtobufSocket writer(fds[0]);
+    lms::ProtobufSocket reader(fds[1]);
+
+    std::string data;
+    logEvent("shared").SerializeToString(&data);
+    lms::ProtobufSocket::SharedFrame frame =
+        lms::ProtobufSocket::makeFrame(data.data(), data.size());
+
+    // shared frames keep their position between copied messages
+    writer.enqueue(logEvent("a"));
+    writer.enqueue(frame);
+    writer.enqueue(frame);
+    ASSERT_EQ(lms::ProtobufSocket::OK, writer.writeMessage(logEvent("b")));
+    EXPECT_EQ(0u, writer.pending());
+
+    lms::Response response;
+    for(const char *text : {"a", "shared", "shared", "b"}) {
+        ASSERT_EQ(lms::ProtobufSocket::OK, reader.readMessage(response));
+        EXPECT_EQ(text, response.log_event().text());
+    }
+}
+
+TEST_F(ProtobufSocketTest, closed) {
+    lms::ProtobufSocket reader(fds[1]);
+    close(fds[0]);
+    fds[0] = -1;
+
+    lms::Response response;
+    EXPECT_EQ(lms::ProtobufSocket::CLOSED, reader.readMessage(response));
+}
@@ -0,0 +1,210 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "lms/service.h"
+#include "lms/service_handle.h"
+#include "lms/time.h"
+#include "internal/xml_parser.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+class CounterService : public lms::Service {
+public:
+    CounterService() : m_count(0), m_running(0), m_maxRunning(0) {}
+
+    std::future<int> increment() {
+        return serialized([this]() { return track([this]() { return ++m_count; }); });
+    }
+
+    std::future<int> read() {
+        return threadSafe([this]() {
+            return track([this]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                return m_count.load();
+            });
+        });
+    }
+
+    std::future<int> fail() {
+        return serialized([]() -> int { throw std::runtime_error("fail"); });
+    }
+
+    int maxRunning() const { return m_maxRunning; }
+
+private:
+    template <typename F> int track(F f) {
+        int running = ++m_running;
+        int max = m_maxRunning;
+        while (running > max && !m_maxRunning.compare_exchange_weak(max, running)) {
+        }
+        int result = f();
+        m_running--;
+        return result;
+    }
+
+    std::atomic<int> m_count;
+    std::atomic<int> m_running;
+    std::atomic<int> m_maxRunning;
+};
+
+class CalibrationService : public lms::Service {
+public:
+    double scale() const {
+        // simulates a lookup that takes a while
+        std::this_thread::sleep_for(std::chrono::microseconds(500));
+        return m_scale;
+    }
+
+    void scale(double value) { m_scale = value; }
+
+private:
+    double m_scale = 1.0;
+};
+
+template <typename Handle>
+lms::Time accessConcurrently(std::shared_ptr<CalibrationService> service,
+                             int modules, int accesses) {
+    lms::Time start = lms::Time::now();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < modules; t++) {
+        threads.emplace_back([service, accesses]() {
+            for (int i = 0; i < accesses; i++) {
+                Handle handle(service);
+                handle->scale();
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    return lms::Time::now() - start;
+}
+
+void setWorkers(lms::Service &service, size_t workers) {
+    lms::internal::ServiceInfo info;
+    info.name = "counter";
+    info.log = lms::logging::Level::ALL;
+    info.workers = workers;
+    service.initBase(info);
+}
+
+}  // namespace
+
+TEST(Service, serialized) {
+    CounterService service;
+    setWorkers(service, 4);
+
+    std::vector<std::future<int>> results;
+    for (int i = 0; i < 100; i++) {
+        results.push_back(service.increment());
+    }
+    for (auto &result : results) {
+        result.get();
+    }
+    EXPECT_EQ(100, service.read().get());
+    EXPECT_EQ(1, service.maxRunning());
+    service.stopWorkers();
+}
+
+TEST(Service, threadSafe) {
+    CounterService service;
+    setWorkers(service, 4);
+
+    std::vector<std::future<int>> results;
+    for (int i = 0; i < 4; i++) {
+        results.push_back(service.read());
+    }
+    for (auto &result : results) {
+        EXPECT_EQ(0, result.get());
+    }
+    EXPECT_GT(service.maxRunning(), 1);
+    service.stopWorkers();
+}
+
+TEST(Service, serializedWithHandle) {
+    std::shared_ptr<CounterService> service = std::make_shared<CounterService>();
+    setWorkers(*service, 1);
+
+    std::future<int> result;
+    {
+        lms::ServiceHandle<CounterService> handle(service);
+        result = service->increment();
+        EXPECT_EQ(std::future_status::timeout,
+                  result.wait_for(std::chrono::milliseconds(20)));
+    }
+    EXPECT_EQ(1, result.get());
+
+    lms::AsyncServiceHandle<CounterService> async(service);
+    ASSERT_TRUE(async);
+    EXPECT_EQ(2, async->increment().get());
+    service->stopWorkers();
+}
+
+TEST(Service, withoutWorkers) {
+    CounterService service;
+    setWorkers(service, 0);
+
+    std::future<int> result = service.increment();
+    EXPECT_EQ(std::future_status::ready, result.wait_for(std::chrono::seconds(0)));
+    EXPECT_EQ(1, result.get());
+    EXPECT_THROW(service.fail().get(), std::runtime_error);
+
+    // runs on the calling thread after stopWorkers()
+    setWorkers(service, 1);
+    service.stopWorkers();
+    EXPECT_EQ(2, service.increment().get());
+}
+
+TEST(SharedServiceHandle, concurrentReaders) {
+    std::shared_ptr<CalibrationService> service = std::make_shared<CalibrationService>();
+    {
+        lms::SharedServiceHandle<CalibrationService> first(service);
+        lms::SharedServiceHandle<CalibrationService> second(service);
+        EXPECT_TRUE(first && second);
+        EXPECT_FALSE(service->getMutex().try_lock());
+
+        lms::SharedServiceHandle<CalibrationService> moved(std::move(first));
+        EXPECT_FALSE(first);
+        EXPECT_DOUBLE_EQ(1.0, moved->scale());
+    }
+    EXPECT_TRUE(service->getMutex().try_lock());
+    EXPECT_FALSE(service->getMutex().try_lock_shared());
+    service->getMutex().unlock();
+
+    {
+        // exclusive handles wait for shared ones
+        lms::SharedServiceHandle<CalibrationService> reader(service);
+        std::atomic<bool> written(false);
+        std::thread writer([service, &written]() {
+            lms::ServiceHandle<CalibrationService> handle(service);
+            handle->scale(2.0);
+            written = true;
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        EXPECT_FALSE(written);
+        reader = lms::SharedServiceHandle<CalibrationService>();
+        writer.join();
+        EXPECT_TRUE(written);
+    }
+    EXPECT_DOUBLE_EQ(2.0, lms::SharedServiceHandle<CalibrationService>(service)->scale());
+}
+
+TEST(SharedServiceHandle, benchmark) {
+    std::shared_ptr<CalibrationService> service = std::make_shared<CalibrationService>();
+    const int modules = 4;
+    const int accesses = 50;
+
+    const lms::Time exclusive =
+        accessConcurrently<lms::ServiceHandle<CalibrationService>>(service, modules, accesses);
+    const lms::Time shared =
+        accessConcurrently<lms::SharedServiceHandle<CalibrationService>>(service, modules, accesses);
+
+    std::cout << modules << " modules, ServiceHandle: " << exclusive.micros() / 1000
+              << " ms, SharedServiceHandle: " << shared.micros() / 1000
+              << " ms" << std::endl;
+    EXPECT_LT(shared, exclusive);
+}